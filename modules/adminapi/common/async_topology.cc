@@ -23,6 +23,13 @@
 
 #include "modules/adminapi/common/async_topology.h"
 
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "modules/adminapi/common/async_replication_options.h"
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/dba_errors.h"
@@ -30,6 +37,7 @@
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/mysql/async_replication.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
 namespace dba {
@@ -300,24 +308,64 @@ void async_change_primary(mysqlshdk::mysql::IInstance *primary,
                           mysqlshdk::mysql::IInstance *old_primary,
                           shcore::Scoped_callback_list *undo_list,
                           bool dry_run) {
-  for (const auto &slave : secondaries) {
-    if (slave.get() != primary && slave.get() != old_primary) {
-      // make sure it's fenced
-      if (!dry_run) fence_instance(slave.get());
+  std::list<Scoped_instance> slaves;
+  std::copy_if(secondaries.begin(), secondaries.end(),
+               std::back_inserter(slaves), [=](const Scoped_instance &i) {
+                 return i.get() != primary && i.get() != old_primary;
+               });
+
+  // Secondaries are fenced and re-pointed in parallel, the instances that were
+  // touched are tracked so that only their changes are reverted on error.
+  std::mutex changed_mutex;
+  std::set<mysqlshdk::mysql::IInstance *> changed;
+
+  std::list<shcore::Dictionary_t> errors = execute_in_parallel(
+      slaves.begin(), slaves.end(),
+      [=, &changed_mutex, &changed](const Scoped_instance &slave) {
+        // make sure it's fenced
+        if (!dry_run) fence_instance(slave.get());
+
+        {
+          std::lock_guard<std::mutex> lock(changed_mutex);
+          changed.insert(slave.get());
+        }
+
+        // This will re-point the slave to the new master without changing any
+        // other replication parameter.
+        change_master_instance(slave.get(), primary, k_channel_name, dry_run);
 
-      // This will re-point the slave to the new master without changing any
-      // other replication parameter.
+        log_info("PRIMARY changed for instance %s", slave->descr().c_str());
+      });
 
+  // Register the undo actions in a deterministic order, regardless of the
+  // order in which the threads finished.
+  if (old_primary) {
+    for (const auto &slave : slaves) {
       auto slave_ptr = slave.get();
 
-      undo_list->push_front([=]() {
-        change_master_instance(slave_ptr, old_primary, k_channel_name, dry_run);
-      });
+      if (changed.count(slave_ptr)) {
+        undo_list->push_front([=]() {
+          change_master_instance(slave_ptr, old_primary, k_channel_name,
+                                 dry_run);
+        });
+      }
+    }
+  }
 
-      change_master_instance(slave_ptr, primary, k_channel_name, dry_run);
+  if (!errors.empty()) {
+    // errors are reported by the caller, include all of them in the message
+    std::vector<std::string> messages;
 
-      log_info("PRIMARY changed for instance %s", slave->descr().c_str());
+    for (const auto &err : errors) {
+      messages.emplace_back(err->get_string("from") + ": " +
+                            err->get_string("errmsg"));
     }
+
+    throw shcore::Exception(
+        shcore::str_format(
+            "%zi SECONDARY instance(s) failed to change replication source: %s",
+            errors.size(), shcore::str_join(messages, "; ").c_str()),
+        SHERR_DBA_SWITCHOVER_ERROR);
   }
 }
 
@@ -102,7 +102,9 @@ void undo_async_force_primary(mysqlshdk::mysql::IInstance *promoted,
 /**
  * Change the primary of one or more secondary instances.
  *
- * Reuses the same credentials as currently in use.
+ * Reuses the same credentials as currently in use. Secondaries are fenced and
+ * re-pointed in parallel, undo actions are added to undo_list only for the
+ * secondaries that were actually changed.
  */
 void async_change_primary(mysqlshdk::mysql::IInstance *primary,
                           const std::list<Scoped_instance> &secondaries,
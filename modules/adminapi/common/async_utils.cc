@@ -21,7 +21,11 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <list>
+#include <mutex>
 #include <string>
 
 #include "modules/adminapi/common/async_utils.h"
@@ -53,6 +57,18 @@ void wait_pending_master_transactions(const std::string &master_gtid_set,
 }
 }  // namespace
 
+int gtid_sync_time_left(std::chrono::steady_clock::time_point deadline,
+                        std::chrono::steady_clock::time_point now) {
+  const std::chrono::duration<double> remaining = deadline - now;
+
+  if (remaining.count() <= 0) {
+    throw shcore::Exception("Timeout waiting for replica to synchronize",
+                            SHERR_DBA_GTID_SYNC_TIMEOUT);
+  }
+
+  return std::max(1, static_cast<int>(std::ceil(remaining.count())));
+}
+
 /*
  * Synchronize all slaves to the master in parallel and then FTWRL on
  * everyone.
@@ -153,26 +169,54 @@ void Global_locks::sync_and_lock_all(
   // applied on the secondaries (lost).
   master_gtid_set = mysqlshdk::mysql::get_executed_gtid_set(*m_master);
 
-  for (const auto &inst : instances) {
-    if (m_master->get_uuid() != inst->get_uuid()) {
-      try {
-        wait_pending_master_transactions(master_gtid_set, inst.get(),
-                                         gtid_sync_timeout);
-      } catch (const shcore::Exception &e) {
-        console->print_error(shcore::str_format("%s: GTID sync failed: %s",
-                                                inst->descr().c_str(),
-                                                e.format().c_str()));
-        throw;
-      }
-      try {
-        inst->execute("FLUSH TABLES WITH READ LOCK");
-      } catch (const shcore::Exception &e) {
-        console->print_error(
-            inst->descr() +
-            ": FLUSH TABLES WITH READ LOCK failed: " + e.format());
-        throw;
-      }
+  // The master is not accepting writes anymore, all slaves share the same
+  // deadline, so that the time it takes to lock all of them is bounded by the
+  // sync timeout, regardless of the number of slaves. Timeout of 0 means
+  // there's no limit.
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::seconds(gtid_sync_timeout);
+
+  std::mutex failures_mutex;
+  std::list<std::string> failures;
+
+  errors = execute_in_parallel(
+      m_slaves.begin(), m_slaves.end(),
+      [&master_gtid_set, &failures_mutex, &failures, deadline,
+       gtid_sync_timeout](const Scoped_instance &inst) {
+        const auto failed = [&](const std::string &msg) {
+          std::lock_guard<std::mutex> lock(failures_mutex);
+          failures.emplace_back(inst->descr() + ": " + msg);
+        };
+
+        try {
+          wait_pending_master_transactions(
+              master_gtid_set, inst.get(),
+              0 == gtid_sync_timeout ? 0 : gtid_sync_time_left(deadline));
+        } catch (const shcore::Exception &e) {
+          failed("GTID sync failed: " + e.format());
+          return;
+        }
+
+        try {
+          inst->execute("FLUSH TABLES WITH READ LOCK");
+        } catch (const shcore::Exception &e) {
+          failed("FLUSH TABLES WITH READ LOCK failed: " + e.format());
+        }
+      });
+
+  for (const auto &err : errors) {
+    failures.emplace_back(err->get_string("from") + ": " +
+                          err->get_string("errmsg"));
+  }
+
+  if (!failures.empty()) {
+    for (const auto &msg : failures) {
+      console->print_error(msg);
     }
+    throw shcore::Exception(
+        shcore::str_format("%zi SECONDARY instance(s) failed to synchronize",
+                           failures.size()),
+        SHERR_DBA_GTID_SYNC_ERROR);
   }
 }
 
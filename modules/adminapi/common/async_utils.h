@@ -24,11 +24,26 @@
 #ifndef MODULES_ADMINAPI_COMMON_ASYNC_UTILS_H_
 #define MODULES_ADMINAPI_COMMON_ASYNC_UTILS_H_
 
+#include <chrono>
+#include <list>
+#include <string>
+
 #include "modules/adminapi/common/instance_pool.h"
 
 namespace mysqlsh {
 namespace dba {
 
+/**
+ * Number of seconds left until the deadline, rounded up, to be used as the
+ * timeout of a GTID sync.
+ *
+ * @throws shcore::Exception with SHERR_DBA_GTID_SYNC_TIMEOUT if the deadline
+ * has passed, since a timeout of 0 would wait forever.
+ */
+int gtid_sync_time_left(std::chrono::steady_clock::time_point deadline,
+                        std::chrono::steady_clock::time_point now =
+                            std::chrono::steady_clock::now());
+
 /** Executes a FTWRL on all instances in the replicaset, after a GTID sync.
  *
  * Locks are held in sessions that are owned by the object. Both locks and
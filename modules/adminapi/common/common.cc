@@ -1501,7 +1501,6 @@ std::string resolve_gr_local_address(
 }
 
 std::vector<Instance_gtid_info> filter_primary_candidates(
-    const mysqlshdk::mysql::IInstance &server,
     const std::vector<Instance_gtid_info> &gtid_info) {
   using mysqlshdk::mysql::Gtid_set_relation;
 
@@ -1518,7 +1517,7 @@ std::vector<Instance_gtid_info> filter_primary_candidates(
       rel = Gtid_set_relation::CONTAINED;
     else
       rel = mysqlshdk::mysql::compare_gtid_sets(
-          server, freshest_instance->gtid_executed, inst.gtid_executed);
+          freshest_instance->gtid_executed, inst.gtid_executed);
 
     switch (rel) {
       // Conflicting GTID sets
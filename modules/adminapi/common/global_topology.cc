@@ -24,6 +24,7 @@
 #include "modules/adminapi/common/global_topology.h"
 #include <algorithm>
 #include <list>
+#include <map>
 #include <vector>
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/dba_errors.h"
@@ -31,7 +32,9 @@
 #include "modules/adminapi/common/parallel_applier_options.h"
 #include "mysqlshdk/include/scripting/types.h"
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/libs/mysql/gtid_set.h"
 #include "mysqlshdk/libs/mysql/repl_config.h"
+#include "mysqlshdk/libs/mysql/replication.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -417,6 +420,8 @@ const Node *Global_topology::get_primary_master_node() const {
 }
 
 void Global_topology::check_gtid_consistency(bool use_configured_primary) {
+  using mysqlshdk::mysql::Gtid_set;
+
   auto ipool = current_ipool();
 
   if (nodes().size() <= 1) {
@@ -424,6 +429,9 @@ void Global_topology::check_gtid_consistency(bool use_configured_primary) {
   }
 
   const Node *master_node = nullptr;
+  // GTID sets of masters, fetched only once per master
+  std::map<const Node *, Gtid_set> master_gtids;
+
   // check that slaves have fewer transactions than the PRIMARY
   if (use_configured_primary) master_node = get_primary_master_node();
 
@@ -434,15 +442,27 @@ void Global_topology::check_gtid_consistency(bool use_configured_primary) {
       if (!master_node->get_primary_member()->executed_gtid_set.is_null() &&
           !node->get_primary_member()->executed_gtid_set.is_null()) {
         try {
-          Scoped_instance master(ipool->connect_unchecked_endpoint(
-              master_node->get_primary_member()->endpoint));
+          auto master_gtid = master_gtids.find(master_node);
+
+          if (master_gtids.end() == master_gtid) {
+            Scoped_instance master(ipool->connect_unchecked_endpoint(
+                master_node->get_primary_member()->endpoint));
+
+            master_gtid =
+                master_gtids
+                    .emplace(master_node,
+                             Gtid_set::from_string(
+                                 mysqlshdk::mysql::get_executed_gtid_set(
+                                     *master)))
+                    .first;
+          }
 
-          std::string errant_gtids = master->queryf_one_string(
-              0, "", "SELECT GTID_SUBTRACT(?, @@global.gtid_executed)",
+          auto errant = Gtid_set::from_string(
               *node->get_primary_member()->executed_gtid_set);
+          errant.subtract(master_gtid->second);
 
-          size_t gtid_diff_size =
-              mysqlshdk::mysql::estimate_gtid_set_size(errant_gtids);
+          const std::string errant_gtids = errant.str();
+          const size_t gtid_diff_size = errant.count();
 
           log_debug("GTIDs that exist in %s but not its source %s: '%s' (%zi)",
                     node->label.c_str(), master_node->label.c_str(),
@@ -22,6 +22,9 @@
  */
 
 #include "modules/adminapi/common/instance_monitoring.h"
+
+#include <algorithm>
+
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/dba_errors.h"
 #include "mysqlshdk/include/shellcore/interrupt_handler.h"
@@ -33,6 +36,70 @@
 namespace mysqlsh {
 namespace dba {
 
+namespace {
+// granularity used to check the stop flag while waiting
+constexpr const int k_status_poll_stop_check_ms = 50;
+}  // namespace
+
+Status_poller::Status_poller(int max_interval_ms, int timeout_sec,
+                             const bool *stop, int min_interval_ms)
+    : m_max_interval_ms(std::max(1, max_interval_ms)),
+      m_min_interval_ms(
+          std::min(std::max(1, min_interval_ms), m_max_interval_ms)),
+      m_stop(stop),
+      m_has_deadline(timeout_sec >= 0),
+      m_deadline(std::chrono::steady_clock::now() +
+                 std::chrono::seconds(std::max(0, timeout_sec))),
+      m_interval_ms(m_min_interval_ms) {}
+
+void Status_poller::observe(const std::string &state) {
+  if (m_observed && state == m_state) return;
+
+  if (m_observed) m_changed = true;
+
+  m_observed = true;
+  m_state = state;
+}
+
+void Status_poller::reset() { m_changed = true; }
+
+void Status_poller::wait() {
+  if (m_changed) {
+    m_interval_ms = m_min_interval_ms;
+  } else {
+    m_interval_ms = std::min(m_interval_ms * 2, m_max_interval_ms);
+  }
+  m_changed = false;
+
+  auto until = std::chrono::steady_clock::now() +
+               std::chrono::milliseconds(m_interval_ms);
+  if (m_has_deadline) until = std::min(until, m_deadline);
+
+  while (!(m_stop && *m_stop)) {
+    const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          until - std::chrono::steady_clock::now())
+                          .count();
+    if (left <= 0) break;
+
+    shcore::sleep_ms(static_cast<uint32_t>(
+        m_stop ? std::min<int64_t>(left, k_status_poll_stop_check_ms) : left));
+  }
+}
+
+bool Status_poller::expired() const {
+  return m_has_deadline && std::chrono::steady_clock::now() >= m_deadline;
+}
+
+int Status_poller::remaining_sec() const {
+  if (!m_has_deadline) return 0;
+
+  const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        m_deadline - std::chrono::steady_clock::now())
+                        .count();
+
+  return left > 0 ? static_cast<int>((left + 999) / 1000) : 0;
+}
+
 std::shared_ptr<mysqlsh::dba::Instance> wait_server_startup(
     const mysqlshdk::db::Connection_options &instance_def, int timeout,
     Recovery_progress_style progress_style) {
@@ -44,8 +111,13 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_server_startup(
     stick.done("");
   }
 
-  timeout = adjust_timeout(timeout, k_server_restart_poll_interval_ms);
-  while (timeout > 0) {
+  // connection attempts are retried quickly at first, as a restart is often
+  // short, backing off if the server takes longer to come back
+  Status_poller poller(k_server_restart_poll_interval_ms,
+                       std::max(0, timeout));
+  while (!poller.expired()) {
+    int error_code = 0;
+
     try {
       out_instance = Instance::connect(instance_def);
 
@@ -58,6 +130,7 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_server_startup(
       return out_instance;
     } catch (const shcore::Error &e) {
       log_debug2("While waiting for server to start: %s", e.format().c_str());
+      error_code = e.code();
 
       if (e.code() == ER_SERVER_SHUTDOWN ||
           mysqlshdk::db::is_mysql_client_error(e.code())) {
@@ -74,8 +147,8 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_server_startup(
         progress_style != Recovery_progress_style::NOINFO) {
       stick.update();
     }
-    timeout--;
-    shcore::sleep_ms(k_server_restart_poll_interval_ms);
+    poller.observe(std::to_string(error_code));
+    poller.wait();
   }
 
   if (progress_style != Recovery_progress_style::NOWAIT &&
@@ -24,6 +24,9 @@
 #ifndef MODULES_ADMINAPI_COMMON_INSTANCE_MONITORING_H_
 #define MODULES_ADMINAPI_COMMON_INSTANCE_MONITORING_H_
 
+#include <chrono>
+#include <string>
+
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/instance_pool.h"
 
@@ -31,9 +34,67 @@ namespace mysqlsh {
 namespace dba {
 
 constexpr const int k_server_restart_poll_interval_ms = 1000;
+constexpr const int k_status_poll_min_interval_ms = 250;
 
 class stop_wait {};
 
+/**
+ * Paces the status probes issued while monitoring an instance.
+ *
+ * Probes start at min_interval_ms (k_status_poll_min_interval_ms by default)
+ * and the interval doubles, up to max_interval_ms, for as long as the
+ * observed state stays the same. Any change of the observed state brings it
+ * back to the minimum, so transitions are noticed promptly without querying
+ * the server at a high rate during long steady phases (e.g. a big clone or a
+ * slow restart).
+ *
+ * A negative timeout means waiting without a time limit. When a stop flag is
+ * given, wait() returns as soon as it gets set (i.e. by a ^C handler).
+ */
+class Status_poller final {
+ public:
+  explicit Status_poller(int max_interval_ms, int timeout_sec = -1,
+                         const bool *stop = nullptr,
+                         int min_interval_ms = k_status_poll_min_interval_ms);
+
+  /**
+   * Records the state seen by the last probe, so that the next wait() is
+   * shortened if it differs from the previous one.
+   */
+  void observe(const std::string &state);
+
+  /**
+   * Forces the next wait() to use the minimum interval.
+   */
+  void reset();
+
+  /**
+   * Sleeps until the next probe is due, the timeout expires or the stop flag
+   * is set.
+   */
+  void wait();
+
+  bool expired() const;
+
+  /**
+   * Number of seconds left until the timeout, rounded up.
+   */
+  int remaining_sec() const;
+
+  int interval_ms() const { return m_interval_ms; }
+
+ private:
+  const int m_max_interval_ms;
+  const int m_min_interval_ms;
+  const bool *m_stop;
+  bool m_has_deadline;
+  std::chrono::steady_clock::time_point m_deadline;
+  int m_interval_ms;
+  bool m_changed = true;
+  bool m_observed = false;
+  std::string m_state;
+};
+
 /**
  * Wait for the target MySQL instance to start
  *
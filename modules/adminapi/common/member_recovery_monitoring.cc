@@ -109,6 +109,14 @@ void throw_distributed_recovery_error(
   }
 }
 
+// Clone stage transitions are what the monitoring loops need to notice
+// promptly, the amount of work done within a stage only changes the progress
+// shown.
+std::string clone_stage_signature(
+    const mysqlshdk::mysql::Clone_status &status) {
+  return status.state + "/" + std::to_string(status.current_stage());
+}
+
 // show_progress:
 // - 0 no wait and no progress
 // - 1 wait without progress info
@@ -224,7 +232,8 @@ void do_monitor_gr_recovery_status(
 
 mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
     const mysqlshdk::db::Connection_options &instance_def,
-    const std::string &begin_time, int timeout_sec) {
+    const std::string &begin_time, int timeout_sec,
+    Scoped_instance *out_instance) {
   // We wait in this loop until:
   // - group_replication_recovery channel pops up
   // - something shows up in PFS.clone_status
@@ -234,7 +243,6 @@ mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
   // It's also possible that the target instance restarts during our checks.
   // In that case, the instance may or may not come back.
 
-  timeout_sec = adjust_timeout(timeout_sec, k_recovery_status_poll_interval_ms);
   bool reconnect = true;
 
   Scoped_instance instance;
@@ -244,12 +252,16 @@ mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
     stop = true;
     return true;
   });
-  while (timeout_sec > 0 && !stop) {
+
+  Status_poller poller(k_recovery_status_poll_interval_ms, timeout_sec, &stop);
+  while (!poller.expired() && !stop) {
     if (reconnect) {
       try {
-        instance = Scoped_instance(wait_server_startup(
-            instance_def, timeout_sec, Recovery_progress_style::NOWAIT));
+        instance = Scoped_instance(
+            wait_server_startup(instance_def, poller.remaining_sec(),
+                                Recovery_progress_style::NOWAIT));
         reconnect = false;
+        poller.reset();
       } catch (const shcore::Exception &e) {
         if (e.code() == SHERR_DBA_SERVER_RESTART_TIMEOUT) break;
         throw;
@@ -262,6 +274,7 @@ mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
             mysqlshdk::gr::detect_recovery_status(*instance, begin_time);
         if (rm != mysqlshdk::gr::Group_member_recovery_status::UNKNOWN) {
           // We keep trying until we can detect which method is in use
+          if (out_instance) *out_instance = instance;
           return rm;
         }
         reconnect = false;
@@ -277,12 +290,14 @@ mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
         }
       }
     }
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
-    timeout_sec--;
+    poller.observe(reconnect ? "reconnect" : "connected");
+    poller.wait();
   }
 
   if (stop) throw stop_monitoring();
 
+  if (out_instance && !reconnect) *out_instance = instance;
+
   return mysqlshdk::gr::Group_member_recovery_status::UNKNOWN;
 }
 
@@ -290,8 +305,6 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_clone_start(
     const mysqlshdk::db::Connection_options &instance_def,
     const std::string &begin_time, int timeout_sec) {
   // We wait in this loop until something shows up in PFS.clone_status
-  timeout_sec = adjust_timeout(timeout_sec, k_recovery_status_poll_interval_ms);
-
   std::shared_ptr<mysqlsh::dba::Instance> out_instance;
 
   bool reconnect = true;
@@ -302,12 +315,14 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_clone_start(
     return true;
   });
 
-  while (timeout_sec > 0 && !stop) {
+  Status_poller poller(k_recovery_status_poll_interval_ms, timeout_sec, &stop);
+  while (!poller.expired() && !stop) {
     if (reconnect) {
       try {
-        out_instance = wait_server_startup(instance_def, timeout_sec,
+        out_instance = wait_server_startup(instance_def, poller.remaining_sec(),
                                            Recovery_progress_style::NOWAIT);
         reconnect = false;
+        poller.reset();
       } catch (const shcore::Exception &e) {
         if (e.code() == SHERR_DBA_SERVER_RESTART_TIMEOUT) break;
         throw;
@@ -323,6 +338,7 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_clone_start(
           // We keep trying until we can detect clone has started
           break;
         }
+        poller.observe(status.state);
         reconnect = false;
       } catch (const shcore::Error &err) {
         log_warning("Error during clone start check: %s", err.format().c_str());
@@ -338,8 +354,7 @@ std::shared_ptr<mysqlsh::dba::Instance> wait_clone_start(
       }
     }
 
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
-    timeout_sec--;
+    poller.wait();
   }
 
   if (stop) throw stop_monitoring();
@@ -364,6 +379,7 @@ void monitor_distributed_recovery(const mysqlshdk::mysql::IInstance &instance,
   bool first = true;
 
   std::string last_error_time;
+  Status_poller poller(k_recovery_status_poll_interval_ms, -1, &stop);
   while (!stop) {
     mysqlshdk::gr::Member_state state =
         mysqlshdk::gr::get_member_state(instance);
@@ -393,10 +409,14 @@ void monitor_distributed_recovery(const mysqlshdk::mysql::IInstance &instance,
             "'");
         first = false;
       }
+
+      poller.observe(
+          mysqlshdk::gr::to_string(state) + "/" + last_error_time + "/" +
+          mysqlshdk::utils::make_host_and_port(channel.host, channel.port));
     }
     assert(state == mysqlshdk::gr::Member_state::RECOVERING);
 
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
+    poller.wait();
   }
 
   if (stop) throw stop_monitoring();
@@ -444,6 +464,7 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
 
   bool first = true;
   console->print_info("* Waiting for clone to finish...");
+  Status_poller poller(k_clone_status_poll_interval_ms, -1, &stop);
   while (!stop) {
     mysqlshdk::mysql::Clone_status status;
 
@@ -492,7 +513,8 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
       break;
     }
 
-    shcore::sleep_ms(k_clone_status_poll_interval_ms);
+    poller.observe(clone_stage_signature(status));
+    poller.wait();
   }
   if (stop && !ignore_cancel) throw stop_monitoring();
 
@@ -524,6 +546,7 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
     }
   }
   // Wait for clone recovery to finish
+  poller.reset();
   while (!stop) {
     mysqlshdk::mysql::Clone_status status;
 
@@ -572,7 +595,9 @@ std::shared_ptr<mysqlsh::dba::Instance> monitor_clone_recovery(
       console->print_info();
       break;
     }
-    shcore::sleep_ms(k_clone_status_poll_interval_ms);
+
+    poller.observe(clone_stage_signature(status));
+    poller.wait();
   }
   if (stop && !ignore_cancel) throw stop_monitoring();
 
@@ -597,10 +622,9 @@ void monitor_post_clone_gr_recovery_status(
   mysqlshdk::gr::Group_member_recovery_status rm =
       mysqlshdk::gr::Group_member_recovery_status::UNKNOWN;
 
-  int startup_timeout_iters =
-      adjust_timeout(startup_timeout_sec, k_recovery_status_poll_interval_ms);
-
-  while (startup_timeout_iters > 0 && !stop) {
+  Status_poller poller(k_recovery_status_poll_interval_ms, startup_timeout_sec,
+                       &stop);
+  while (!poller.expired() && !stop) {
     try {
       rm = mysqlshdk::gr::detect_recovery_status(*instance, begin_time);
       if (rm != mysqlshdk::gr::Group_member_recovery_status::CLONE) {
@@ -613,8 +637,7 @@ void monitor_post_clone_gr_recovery_status(
       log_warning("During post-clone recovery start check: %s", err.what());
       throw;
     }
-    shcore::sleep_ms(k_recovery_status_poll_interval_ms);
-    startup_timeout_iters--;
+    poller.wait();
   }
 
   if (stop) throw stop_monitoring();
@@ -647,11 +670,15 @@ void monitor_gr_recovery_status(
 
     for (int attempt = 0; attempt < 2; ++attempt) {
       try {
+        // the session used to detect the recovery method is kept to
+        // monitor it too, instead of opening a new one
+        Scoped_instance instance;
         mysqlshdk::gr::Group_member_recovery_status method =
             wait_recovery_start(connection_options, begin_time,
-                                startup_timeout_sec);
+                                startup_timeout_sec, &instance);
 
-        auto instance = mysqlsh::dba::Instance::connect(instance_def);
+        if (!instance)
+          instance = Scoped_instance(Instance::connect(instance_def));
 
         do_monitor_gr_recovery_status(instance.get(), post_clone_coptions,
                                       method, begin_time, progress_style,
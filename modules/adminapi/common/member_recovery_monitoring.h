@@ -34,15 +34,24 @@
 namespace mysqlsh {
 namespace dba {
 
+// Maximum intervals between status probes, reached while the monitored state
+// doesn't change (see Status_poller)
 constexpr const int k_recovery_status_poll_interval_ms = 1000;
 constexpr const int k_clone_status_poll_interval_ms = 500;
 
 class stop_monitoring {};
 class restart_timeout {};
 
+/**
+ * Waits until the recovery method used by the target instance can be detected
+ *
+ * If out_instance is given, it's set to the session used for the detection,
+ * so that it can be reused to monitor the recovery.
+ */
 mysqlshdk::gr::Group_member_recovery_status wait_recovery_start(
     const mysqlshdk::db::Connection_options &instance_def,
-    const std::string &begin_time, int timeout_sec);
+    const std::string &begin_time, int timeout_sec,
+    Scoped_instance *out_instance = nullptr);
 
 std::shared_ptr<mysqlsh::dba::Instance> wait_clone_start(
     const mysqlshdk::db::Connection_options &instance_def,
@@ -31,6 +31,7 @@
 #include "modules/adminapi/common/instance_validations.h"
 #include "modules/adminapi/dba/check_instance.h"
 #include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/libs/mysql/gtid_set.h"
 #include "mysqlshdk/libs/mysql/replication.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 
@@ -141,9 +142,13 @@ void ensure_user_privileges(const mysqlshdk::mysql::IInstance &instance) {
 bool ensure_gtid_sync_possible(const mysqlshdk::mysql::IInstance &master,
                                const mysqlshdk::mysql::IInstance &instance,
                                bool fatal) {
-  std::string missing_gtids = master.queryf_one_string(
-      0, "", "SELECT GTID_SUBTRACT(@@global.gtid_purged, ?)",
-      mysqlshdk::mysql::get_executed_gtid_set(instance));
+  using mysqlshdk::mysql::Gtid_set;
+
+  const auto missing =
+      Gtid_set::from_string(mysqlshdk::mysql::get_purged_gtid_set(master))
+          .subtract(Gtid_set::from_string(
+              mysqlshdk::mysql::get_executed_gtid_set(instance)));
+  const std::string missing_gtids = missing.str();
 
   if (!missing_gtids.empty()) {
     log_info("Transactions missing at %s that were purged from primary %s: %s",
@@ -151,8 +156,7 @@ bool ensure_gtid_sync_possible(const mysqlshdk::mysql::IInstance &master,
              missing_gtids.c_str());
 
     std::string msg = instance.descr() + " is missing " +
-                      std::to_string(mysqlshdk::mysql::estimate_gtid_set_size(
-                          missing_gtids)) +
+                      std::to_string(missing.count()) +
                       " transactions that have been purged from the "
                       "current PRIMARY (" +
                       master.descr() + ")";
@@ -173,12 +177,13 @@ bool ensure_gtid_sync_possible(const mysqlshdk::mysql::IInstance &master,
 bool ensure_gtid_no_errants(const mysqlshdk::mysql::IInstance &master,
                             const mysqlshdk::mysql::IInstance &instance,
                             bool fatal) {
-  std::string slave_gtid_executed =
-      mysqlshdk::mysql::get_executed_gtid_set(instance);
+  using mysqlshdk::mysql::Gtid_set;
 
-  std::string errant_gtids = master.queryf_one_string(
-      0, "", "SELECT GTID_SUBTRACT(?, @@global.gtid_executed)",
-      slave_gtid_executed);
+  const auto errant =
+      Gtid_set::from_string(mysqlshdk::mysql::get_executed_gtid_set(instance))
+          .subtract(Gtid_set::from_string(
+              mysqlshdk::mysql::get_executed_gtid_set(master)));
+  const std::string errant_gtids = errant.str();
 
   if (!errant_gtids.empty()) {
     log_info("Errant transactions at %s compared to %s: %s",
@@ -186,8 +191,7 @@ bool ensure_gtid_no_errants(const mysqlshdk::mysql::IInstance &master,
              errant_gtids.c_str());
 
     std::string msg =
-        instance.descr() + " has " +
-        std::to_string(mysqlshdk::mysql::estimate_gtid_set_size(errant_gtids)) +
+        instance.descr() + " has " + std::to_string(errant.count()) +
         " errant transactions that have not originated from the current "
         "PRIMARY (" +
         master.descr() + ")";
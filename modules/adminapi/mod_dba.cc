@@ -3365,8 +3365,7 @@ void Dba::validate_instances_gtid_reboot_cluster(
   std::vector<Instance_gtid_info> primary_candidates;
 
   try {
-    primary_candidates =
-        filter_primary_candidates(target_instance, instance_gtids);
+    primary_candidates = filter_primary_candidates(instance_gtids);
 
     // Returned list should have at least 1 element
     assert(!primary_candidates.empty());
@@ -25,6 +25,8 @@
 
 #include <mysql.h>
 #include <mysqld_error.h>
+#include <chrono>
+#include <cstring>
 #include <future>
 #include <thread>
 #include <utility>
@@ -55,6 +57,7 @@
 #include "mysqlshdk/libs/mysql/utils.h"
 #include "mysqlshdk/libs/textui/textui.h"
 #include "mysqlshdk/libs/utils/debug.h"
+#include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 #include "mysqlshdk/shellcore/shell_console.h"
@@ -70,6 +73,36 @@ constexpr const char *k_async_cluster_user_name = "mysql_innodb_rs_";
 constexpr const int k_clone_start_timeout = 30;
 
 namespace {
+/**
+ * Logs the duration of each of the phases of a primary change, along with the
+ * time during which the replicaset was not accepting writes (from the start of
+ * the first phase in which writes are blocked until the end of the last one).
+ */
+void log_primary_change_timings(const char *operation,
+                                const mysqlshdk::utils::Profile_timer &timer,
+                                const char *first_blocking_phase) {
+  std::string phases;
+  const mysqlshdk::utils::Profile_timer::Trace_point *blocked = nullptr;
+
+  for (const auto &tp : timer.trace_points()) {
+    if (!phases.empty()) phases += ", ";
+    phases += shcore::str_format(
+        "%s: %.3fs", tp.note,
+        std::chrono::duration<double>(tp.end - tp.start).count());
+
+    if (!blocked && 0 == strcmp(tp.note, first_blocking_phase)) blocked = &tp;
+  }
+
+  log_info("%s phase timings: %s", operation, phases.c_str());
+
+  if (blocked) {
+    log_info("%s write-unavailability window: %.3fs", operation,
+             std::chrono::duration<double>(timer.trace_points().back().end -
+                                           blocked->start)
+                 .count());
+  }
+}
+
 std::unique_ptr<topology::Server_global_topology> discover_unmanaged_topology(
     Instance *instance) {
   auto console = current_console();
@@ -1366,12 +1399,17 @@ void Replica_set_impl::set_primary_instance(const std::string &instance_def,
   // the router will begin sending RW traffic to the new primary. We won't lose
   // consistency because they should fail with SRO errors, but we should try
   // to minimize the amount of time spent in that state.
+  mysqlshdk::utils::Profile_timer timer;
+
   console->print_info("* Synchronizing transaction backlog at " +
                       new_master->descr());
+  timer.stage_begin("pre-synchronization");
   if (!dry_run)
     sync_transactions(*new_master, {k_async_cluster_channel_name}, timeout);
+  timer.stage_end();
   console->print_info();
 
+  timer.stage_begin("metadata update");
   console->print_info("* Updating metadata");
   // Re-generate a new password for the master being demoted.
   Async_replication_options ar_options;
@@ -1382,13 +1420,16 @@ void Replica_set_impl::set_primary_instance(const std::string &instance_def,
            m_metadata_storage->get_md_server()->descr().c_str());
   if (!dry_run)
     m_metadata_storage->record_async_primary_switch(promoted->instance_id);
+  timer.stage_end();
   console->print_info();
 
   // Synchronize all slaves and lock all instances.
   Global_locks global_locks;
+  timer.stage_begin("global locks");
   try {
     global_locks.acquire(lock_instances, demoted->get_primary_member()->uuid,
                          timeout, dry_run);
+    timer.stage_end();
   } catch (const std::exception &e) {
     console->print_error(shcore::str_format(
         "An error occurred while preparing replicaset instances for a PRIMARY "
@@ -1409,10 +1450,12 @@ void Replica_set_impl::set_primary_instance(const std::string &instance_def,
   }
 
   console->print_info("* Updating replication topology");
+  timer.stage_begin("topology change");
   // Update the topology but revert if it fails
   try {
     do_set_primary_instance(master.get(), new_master.get(), instances,
                             ar_options, dry_run);
+    timer.stage_end();
   } catch (...) {
     console->print_note("Reverting metadata changes");
     if (!dry_run)
@@ -1421,6 +1464,8 @@ void Replica_set_impl::set_primary_instance(const std::string &instance_def,
   }
   console->print_info();
 
+  log_primary_change_timings("Switchover", timer, "global locks");
+
   // This will update the MD object to use the new primary
   if (!dry_run) {
     primary_instance_did_change(new_master.ptr);
@@ -1564,11 +1609,15 @@ void Replica_set_impl::force_primary_instance(const std::string &instance_def,
                                    invalidate_error_instances, &instances_md,
                                    &invalidate_ids);
 
+  mysqlshdk::utils::Profile_timer timer;
+
   // Wait for all instances to apply retrieved transactions (relay log) first.
   // NOTE: Otherwise GTID_EXECUTED set might be missing trx when checking most
   //       up-to-date instances.
+  timer.stage_begin("apply retrieved transactions");
   wait_all_apply_retrieved_trx(&instances, timeout, invalidate_error_instances,
                                &instances_md, &invalidate_ids);
+  timer.stage_end();
 
   // Find a candidate to be promoted.
   // NOTE: Use updated (current) GTID_EXECUTED set from instance and not the
@@ -1624,12 +1673,15 @@ void Replica_set_impl::force_primary_instance(const std::string &instance_def,
   try {
     console->print_info("* Promoting " + new_master->descr() +
                         " to a PRIMARY...");
+    timer.stage_begin("promotion");
     async_force_primary(new_master.get(), ar_options, dry_run);
+    timer.stage_end();
     console->print_info();
 
     // MD update has to happen after the failover, since there's no PRIMARY
     // before that
     console->print_info("* Updating metadata...");
+    timer.stage_begin("metadata update");
     if (!dry_run) {
       new_master->steal();
 
@@ -1659,6 +1711,7 @@ void Replica_set_impl::force_primary_instance(const std::string &instance_def,
                                 SHERR_DBA_FAILOVER_ERROR);
       }
     }
+    timer.stage_end();
     console->print_info();
 
     console->print_info(promoted->label + " was force-promoted to PRIMARY.");
@@ -1676,10 +1729,12 @@ void Replica_set_impl::force_primary_instance(const std::string &instance_def,
   }
 
   console->print_info("* Updating source of remaining SECONDARY instances");
+  timer.stage_begin("secondaries update");
   shcore::Scoped_callback_list undo_list;
   try {
     async_change_primary(new_master.get(), instances, ar_options, nullptr,
                          &undo_list, dry_run);
+    timer.stage_end();
   } catch (...) {
     console->print_error("Error changing replication source: " +
                          format_active_exception());
@@ -1694,6 +1749,8 @@ void Replica_set_impl::force_primary_instance(const std::string &instance_def,
 
   console->print_info();
 
+  log_primary_change_timings("Failover", timer, "apply retrieved transactions");
+
   // Clear replication configs from the promoted instance. Do it after
   // everything is done, to make reverting easier.
   reset_channel(new_master.get(), true, dry_run);
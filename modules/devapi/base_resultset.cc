@@ -238,17 +238,27 @@ object if two conditions are met:
 In the case a field does not met these conditions, it must be retrieved through
 the this function.
 )*");
-Row::Row() {
-  add_property("length", "getLength");
-  expose("getField", &Row::get_field, "fieldName");
+const std::shared_ptr<Row::Function_map> &Row::method_table() {
+  // rows are created in large numbers, all of them share the same methods
+  static const auto table = []() {
+    auto t = make_method_table();
+    add_property_getter(t.get(), "length", "getLength");
+    expose(t.get(), "getField", &Row::get_field, "fieldName");
+    return t;
+  }();
+
+  return table;
+}
+
+Row::Row() : shcore::Cpp_object_bridge(method_table()) {
+  add_property("length");
   names.reset(new std::vector<std::string>());
 }
 
 Row::Row(std::shared_ptr<std::vector<std::string>> names_,
          const mysqlshdk::db::IRow &row)
-    : names(names_) {
-  add_property("length", "getLength");
-  expose("getField", &Row::get_field, "fieldName");
+    : shcore::Cpp_object_bridge(method_table()), names(names_) {
+  add_property("length");
 
   for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
     const std::string &key = (*names_)[i];
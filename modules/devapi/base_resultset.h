@@ -295,6 +295,9 @@ class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
   void add_item(const std::string &key, shcore::Value value);
 
   shcore::Dictionary_t as_object();
+
+ private:
+  static const std::shared_ptr<Function_map> &method_table();
 };
 }  // namespace mysqlsh
 
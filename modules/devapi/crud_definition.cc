@@ -58,7 +58,11 @@ Crud_definition::Crud_definition(std::shared_ptr<DatabaseObject> owner)
         "Invalid connection used on CRUD operation.");
   }
 }
-Crud_definition::~Crud_definition() { reset_prepared_statement(); }
+Crud_definition::~Crud_definition() {
+  // prepared statement is owned by the session's cache, it's going to be
+  // reused by the operations created in the future, and deallocated once it's
+  // evicted from the cache or the session is closed
+}
 
 void Crud_definition::parse_string_list(const shcore::Argument_list &args,
                                         std::vector<std::string> &data) {
@@ -110,31 +114,33 @@ std::shared_ptr<mysqlshdk::db::mysqlx::Result> Crud_definition::safe_exec(
 
   std::shared_ptr<mysqlshdk::db::IResult> result;
 
-  // Prepared statements are used when the statement is executed a
-  // more than once after the last statement update and if the operation
-  // allows prepared statements
-  if (use_prepared()) {
+  // Prepared statements are used when the statement is executed more than
+  // once in this session (not necessarily by this object) and if the
+  // operation allows prepared statements
+  if (allow_prepared_statements()) {
     try {
-      // If the statement has not been prepared, then it gets prepared
-      if (!m_prep_stmt.has_stmt_id()) {
-        m_prep_stmt.set_stmt_id(
-            this->session()->session()->next_prep_stmt_id());
-        set_prepared_stmt();
-        this->session()->session()->prepare_stmt(m_prep_stmt);
-      } else {
-        update_limits();
-      }
+      // The statement is looked up on each execution, as it might have been
+      // evicted from the cache, it gets prepared if it was seen before
+      const auto stmt_id = find_prepared_statement();
+
+      if (0 != stmt_id) {
+        m_prep_stmt.set_stmt_id(stmt_id);
 
-      Mysqlx::Prepare::Execute execute;
-      execute.set_stmt_id(m_prep_stmt.stmt_id());
-      insert_bound_values(execute.mutable_args());
+        Mysqlx::Prepare::Execute execute;
+        execute.set_stmt_id(stmt_id);
+        insert_bound_values(execute.mutable_args());
 
-      result = this->session()->session()->execute_prep_stmt(execute);
+        result = this->session()->session()->execute_prep_stmt(execute);
+      } else {
+        m_prep_stmt.clear_stmt_id();
+        result = func();
+      }
     } catch (const mysqlshdk::db::Error &error) {
       m_prep_stmt.clear_stmt_id();
 
       if (ER_UNKNOWN_COM_ERROR == error.code()) {
         this->session()->disable_prepared_statements();
+        this->session()->statement_cache().clear_prepared_statements();
         result = func();
       } else {
         throw;
@@ -338,13 +344,41 @@ void Crud_definition::reset_prepared_statement() {
   if (m_prep_stmt.has_stmt_id()) {
     auto s = session();
 
-    if (s && s->is_open())
-      s->session()->deallocate_prep_stmt(m_prep_stmt.stmt_id());
+    if (s) {
+      s->statement_cache().release_prepared_statement(
+          m_prep_stmt.stmt(), s->is_open() ? s->session() : nullptr);
+    }
 
     m_prep_stmt.Clear();
   }
 }
 
+uint32_t Crud_definition::find_prepared_statement() {
+  // statement is built in the prepared form, so it can be found regardless of
+  // the number of times it was executed by this object
+  m_build_prepared = true;
+  shcore::Scoped_callback restore([this]() { m_build_prepared = false; });
+
+  set_prepared_stmt();
+  restore.call();
+
+  const auto s = session();
+  return s->statement_cache().prepared_statement(m_prep_stmt.stmt(),
+                                                 s->session());
+}
+
+Mysqlx::Expr::Expr *Crud_definition::parse_filter(const std::string &filter,
+                                                  bool document_mode) {
+  if (const auto s = session()) {
+    return s->statement_cache().parse_filter(filter, document_mode,
+                                             &_placeholders);
+  }
+
+  return document_mode
+             ? ::mysqlx::parser::parse_collection_filter(filter, &_placeholders)
+             : ::mysqlx::parser::parse_table_filter(filter, &_placeholders);
+}
+
 REGISTER_HELP(
     LIMIT_EXECUTION_MODE,
     "This function can be called every time the statement is executed.");
@@ -82,6 +82,8 @@ class Crud_definition : public Dynamic_object {
  protected:
   Mysqlx::Prepare::Prepare m_prep_stmt;
   uint64_t m_execution_count;
+  // statement is being built in the form used by prepared statements
+  bool m_build_prepared = false;
   mysqlshdk::utils::nullable<uint64_t> m_limit;
   mysqlshdk::utils::nullable<uint64_t> m_offset;
   std::vector<std::string> _placeholders;
@@ -109,9 +111,17 @@ class Crud_definition : public Dynamic_object {
   virtual void update_limits(){};
   void reset_prepared_statement();
   bool use_prepared() {
-    return allow_prepared_statements() && m_execution_count;
+    return allow_prepared_statements() &&
+           (m_execution_count || m_build_prepared);
   }
 
+  /**
+   * Parses a filter expression, reusing the result of parsing the same
+   * expression by other CRUD operations of the session.
+   */
+  Mysqlx::Expr::Expr *parse_filter(const std::string &filter,
+                                   bool document_mode);
+
   virtual shcore::Value this_object() { return shcore::Value(); }
   shcore::Value limit(const shcore::Argument_list &args,
                       Dynamic_object::Allowed_function_mask limit_func_id,
@@ -162,6 +172,7 @@ class Crud_definition : public Dynamic_object {
 
  private:
   void validate_placeholders();
+  uint32_t find_prepared_statement();
 };
 }  // namespace mysqlx
 }  // namespace mysqlsh
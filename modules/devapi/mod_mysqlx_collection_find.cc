@@ -218,8 +218,7 @@ shcore::Value CollectionFind::find(const shcore::Argument_list &args) {
 }
 
 CollectionFind &CollectionFind::set_filter(const std::string &filter) {
-  message_.set_allocated_criteria(
-      ::mysqlx::parser::parse_collection_filter(filter, &_placeholders));
+  message_.set_allocated_criteria(parse_filter(filter, true));
 
   return *this;
 }
@@ -578,8 +577,7 @@ shcore::Value CollectionFind::having(const shcore::Argument_list &args) {
 
   try {
     message_.set_allocated_grouping_criteria(
-        ::mysqlx::parser::parse_collection_filter(args.string_at(0),
-                                                  &_placeholders));
+        parse_filter(args.string_at(0), true));
 
     update_functions(F::having);
 
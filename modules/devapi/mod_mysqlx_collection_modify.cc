@@ -242,8 +242,7 @@ std::shared_ptr<CollectionModify> CollectionModify::modify(
 }
 
 CollectionModify &CollectionModify::set_filter(const std::string &filter) {
-  message_.set_allocated_criteria(
-      ::mysqlx::parser::parse_collection_filter(filter, &_placeholders));
+  message_.set_allocated_criteria(parse_filter(filter, true));
 
   return *this;
 }
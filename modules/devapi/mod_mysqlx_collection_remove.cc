@@ -198,8 +198,7 @@ shcore::Value CollectionRemove::remove(const shcore::Argument_list &args) {
 }
 
 CollectionRemove &CollectionRemove::set_filter(const std::string &filter) {
-  message_.set_allocated_criteria(
-      ::mysqlx::parser::parse_collection_filter(filter, &_placeholders));
+  message_.set_allocated_criteria(parse_filter(filter, true));
 
   return *this;
 }
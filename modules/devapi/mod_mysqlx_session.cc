@@ -127,6 +127,7 @@ void Session::init() {
   expose("createSchema", &Session::_create_schema, "name");
   expose("getSchema", &Session::get_schema, "name");
   expose("getSchemas", &Session::get_schemas);
+  expose("getStatementCacheStats", &Session::get_statement_cache_stats);
   expose("dropSchema", &Session::drop_schema, "name");
   expose("setSavepoint", &Session::set_savepoint, "?name");
   expose("releaseSavepoint", &Session::release_savepoint, "name");
@@ -194,6 +195,9 @@ void Session::connect(const mysqlshdk::db::Connection_options &data) {
   try {
     _connection_options = data;
 
+    // statements prepared using the previous connection are gone
+    m_statement_cache.clear_prepared_statements();
+
     _session->connect(_connection_options);
 
     _connection_id = _session->get_connection_id();
@@ -259,6 +263,7 @@ void Session::close() {
     log_warning("Error occurred closing session: %s", e.what());
   }
 
+  m_statement_cache.clear_prepared_statements();
   _session = mysqlshdk::db::mysqlx::Session::create();
 }
 
@@ -564,6 +569,59 @@ shcore::Array_t Session::get_schemas() {
   return schemas;
 }
 
+REGISTER_HELP_FUNCTION(getStatementCacheStats, Session);
+REGISTER_HELP_FUNCTION_TEXT(SESSION_GETSTATEMENTCACHESTATS, R"*(
+Returns the statistics of the statement cache of this session.
+
+@returns A dictionary with the statistics of the statement cache.
+
+CRUD operations created through this session share the parsed filter
+expressions and the server side prepared statements, so that the operations
+created repeatedly (i.e. in a loop) do not need to parse and prepare the same
+statement again. A limited number of statements is kept prepared on the
+server, the least recently used one is deallocated when another statement
+needs to be prepared.
+
+The returned dictionary contains the following entries:
+
+@li expressions: statistics of the cache of the parsed expressions.
+@li preparedStatements: statistics of the cache of the prepared statements.
+
+Each entry is a dictionary containing the following entries:
+
+@li hits: number of times the cached entry was used.
+@li misses: number of times the entry was not found in the cache.
+@li size: current number of entries in the cache, in case of
+preparedStatements this is the number of statements prepared on the server.
+)*");
+/**
+ * $(SESSION_GETSTATEMENTCACHESTATS_BRIEF)
+ *
+ * $(SESSION_GETSTATEMENTCACHESTATS)
+ */
+#if DOXYGEN_JS
+Dictionary Session::getStatementCacheStats() {}
+#elif DOXYGEN_PY
+dict Session::get_statement_cache_stats() {}
+#endif
+shcore::Dictionary_t Session::get_statement_cache_stats() const {
+  const auto to_dict = [](const Statement_cache::Stats &stats) {
+    auto dict = shcore::make_dict();
+    (*dict)["hits"] = shcore::Value(stats.hits);
+    (*dict)["misses"] = shcore::Value(stats.misses);
+    (*dict)["size"] = shcore::Value(static_cast<uint64_t>(stats.size));
+    return dict;
+  };
+
+  auto ret_val = shcore::make_dict();
+  (*ret_val)["expressions"] =
+      shcore::Value(to_dict(m_statement_cache.expression_stats()));
+  (*ret_val)["preparedStatements"] =
+      shcore::Value(to_dict(m_statement_cache.statement_stats()));
+
+  return ret_val;
+}
+
 REGISTER_HELP_FUNCTION(setFetchWarnings, Session);
 REGISTER_HELP_FUNCTION_TEXT(SESSION_SETFETCHWARNINGS, R"*(
 Enables or disables warning generation.
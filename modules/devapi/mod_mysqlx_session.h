@@ -29,6 +29,7 @@
 #include "db/mysqlx/mysqlxclient_clean.h"
 #include "db/mysqlx/session.h"
 #include "modules/devapi/mod_mysqlx_resultset.h"
+#include "modules/devapi/statement_cache.h"
 #include "modules/mod_common.h"
 #include "scripting/types.h"
 #include "scripting/types_cpp.h"
@@ -82,6 +83,7 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
   Schema getCurrentSchema();
   Schema setCurrentSchema(String name);
   List getSchemas();
+  Dictionary getStatementCacheStats();
   String getUri();
   Undefined close();
   Undefined setFetchWarnings(Boolean enable);
@@ -110,6 +112,7 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
   Schema get_current_schema();
   Schema set_current_schema(str name);
   list get_schemas();
+  dict get_statement_cache_stats();
   str get_uri();
   None close();
   None set_fetch_warnings(bool enable);
@@ -181,6 +184,8 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
 
   shcore::Array_t get_schemas();
 
+  shcore::Dictionary_t get_statement_cache_stats() const;
+
   std::string db_object_exists(std::string &type, const std::string &name,
                                const std::string &owner) override;
 
@@ -217,6 +222,8 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
   void disable_prepared_statements() { m_allow_prepared_statements = false; }
   bool allow_prepared_statements() { return m_allow_prepared_statements; }
 
+  Statement_cache &statement_cache() { return m_statement_cache; }
+
  protected:
   friend class SqlExecute;
 
@@ -247,6 +254,7 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
 
  private:
   bool m_allow_prepared_statements = true;
+  Statement_cache m_statement_cache;
   void reset_session();
 };
 
@@ -212,8 +212,7 @@ shcore::Value TableDelete::where(const shcore::Argument_list &args) {
 
   if (table) {
     try {
-      message_.set_allocated_criteria(::mysqlx::parser::parse_table_filter(
-          args.string_at(0), &_placeholders));
+      message_.set_allocated_criteria(parse_filter(args.string_at(0), false));
 
       // Updates the exposed functions
       update_functions(F::where);
@@ -319,8 +319,7 @@ shcore::Value TableSelect::where(const shcore::Argument_list &args) {
   args.ensure_count(1, get_function_name("where").c_str());
 
   try {
-    message_.set_allocated_criteria(::mysqlx::parser::parse_table_filter(
-        args.string_at(0), &_placeholders));
+    message_.set_allocated_criteria(parse_filter(args.string_at(0), false));
 
     update_functions(F::where);
     reset_prepared_statement();
@@ -509,8 +508,7 @@ shcore::Value TableSelect::having(const shcore::Argument_list &args) {
 
   try {
     message_.set_allocated_grouping_criteria(
-        ::mysqlx::parser::parse_table_filter(args.string_at(0),
-                                             &_placeholders));
+        parse_filter(args.string_at(0), false));
 
     update_functions(F::having);
     reset_prepared_statement();
@@ -331,8 +331,7 @@ shcore::Value TableUpdate::where(const shcore::Argument_list &args) {
   args.ensure_count(1, get_function_name("where").c_str());
 
   try {
-    message_.set_allocated_criteria(::mysqlx::parser::parse_table_filter(
-        args.string_at(0), &_placeholders));
+    message_.set_allocated_criteria(parse_filter(args.string_at(0), false));
 
     // Updates the exposed functions
     update_functions(F::where);
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/devapi/statement_cache.h"
+
+#include "db/mysqlx/mysqlx_parser.h"
+#include "db/mysqlx/tokenizer.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace mysqlx {
+
+namespace {
+
+/**
+ * Builds the representation of a filter expression which does not depend on
+ * the whitespace or the quoting used.
+ */
+std::string normalize_filter(const std::string &filter) {
+  ::mysqlx::Tokenizer tokenizer(filter);
+  tokenizer.get_tokens();
+
+  std::string normalized;
+
+  for (const auto &token : tokenizer) {
+    normalized += std::to_string(static_cast<int>(token.get_type()));
+    normalized += ':';
+    normalized += std::to_string(token.get_length());
+    normalized += ':';
+    normalized += token.get_text();
+  }
+
+  return normalized;
+}
+
+}  // namespace
+
+constexpr size_t Statement_cache::k_default_expression_capacity;
+constexpr size_t Statement_cache::k_default_statement_capacity;
+constexpr size_t Statement_cache::k_default_seen_statement_capacity;
+
+Statement_cache::Statement_cache(size_t expression_capacity,
+                                 size_t statement_capacity,
+                                 size_t seen_statement_capacity)
+    : m_expressions(expression_capacity),
+      m_statements(statement_capacity),
+      m_seen_statements(seen_statement_capacity) {}
+
+Mysqlx::Expr::Expr *Statement_cache::parse_filter(
+    const std::string &filter, bool document_mode,
+    std::vector<std::string> *placeholders) {
+  // positions of the placeholders depend on the ones which were already used
+  std::string key = document_mode ? "D" : "T";
+  key += shcore::str_join(*placeholders, ",");
+  key += '\0';
+  key += normalize_filter(filter);
+
+  if (const auto cached = m_expressions.find(key)) {
+    ++m_expression_hits;
+    *placeholders = cached->placeholders;
+    return new Mysqlx::Expr::Expr(*cached->expr);
+  }
+
+  ++m_expression_misses;
+
+  std::unique_ptr<Mysqlx::Expr::Expr> expr(
+      document_mode
+          ? ::mysqlx::parser::parse_collection_filter(filter, placeholders)
+          : ::mysqlx::parser::parse_table_filter(filter, placeholders));
+
+  Expression entry;
+  entry.expr.reset(new Mysqlx::Expr::Expr(*expr));
+  entry.placeholders = *placeholders;
+  m_expressions.insert(key, std::move(entry));
+
+  return expr.release();
+}
+
+uint32_t Statement_cache::prepared_statement(
+    const Mysqlx::Prepare::Prepare_OneOfMessage &stmt,
+    mysqlshdk::db::mysqlx::Session *session) {
+  const auto key = stmt.SerializeAsString();
+
+  if (const auto id = m_statements.find(key)) {
+    ++m_statement_hits;
+    return *id;
+  }
+
+  ++m_statement_misses;
+
+  if (!m_seen_statements.erase(key)) {
+    // first execution, statement is executed directly
+    m_seen_statements.insert(key, true);
+    return 0;
+  }
+
+  // second execution, statement is prepared now
+  Mysqlx::Prepare::Prepare prepare;
+  prepare.set_stmt_id(session->next_prep_stmt_id());
+  *prepare.mutable_stmt() = stmt;
+  session->prepare_stmt(prepare);
+
+  // the least recently used statement is deallocated if there are too many
+  const auto evicted = m_statements.insert(key, prepare.stmt_id());
+
+  if (evicted) {
+    deallocate(*evicted, session);
+  }
+
+  return prepare.stmt_id();
+}
+
+void Statement_cache::release_prepared_statement(
+    const Mysqlx::Prepare::Prepare_OneOfMessage &stmt,
+    mysqlshdk::db::mysqlx::Session *session) {
+  const auto key = stmt.SerializeAsString();
+
+  m_seen_statements.erase(key);
+
+  const auto released = m_statements.erase(key);
+
+  if (released) {
+    deallocate(*released, session);
+  }
+}
+
+void Statement_cache::clear_prepared_statements(
+    mysqlshdk::db::mysqlx::Session *session) {
+  m_seen_statements.clear([](bool) {});
+  m_statements.clear([session](uint32_t id) { deallocate(id, session); });
+}
+
+void Statement_cache::deallocate(uint32_t id,
+                                 mysqlshdk::db::mysqlx::Session *session) {
+  if (0 != id && session && session->is_open()) {
+    try {
+      session->deallocate_prep_stmt(id);
+    } catch (const std::exception &e) {
+      log_warning("Failed to deallocate prepared statement %u: %s", id,
+                  e.what());
+    }
+  }
+}
+
+Statement_cache::Stats Statement_cache::expression_stats() const {
+  Stats stats;
+  stats.hits = m_expression_hits;
+  stats.misses = m_expression_misses;
+  stats.size = m_expressions.size();
+  return stats;
+}
+
+Statement_cache::Stats Statement_cache::statement_stats() const {
+  Stats stats;
+  stats.hits = m_statement_hits;
+  stats.misses = m_statement_misses;
+  stats.size = m_statements.size();
+  return stats;
+}
+
+}  // namespace mysqlx
+}  // namespace mysqlsh
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_DEVAPI_STATEMENT_CACHE_H_
+#define MODULES_DEVAPI_STATEMENT_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "db/mysqlx/mysqlxclient_clean.h"
+#include "db/mysqlx/session.h"
+
+namespace mysqlsh {
+namespace mysqlx {
+
+/**
+ * Session-wide cache of the work done to build and execute CRUD statements,
+ * so that statements created by new CRUD objects (i.e. in a loop) don't need
+ * to redo it:
+ *  - parsed filter expressions, keyed by the tokens of the expression, so
+ *    that i.e. differences in whitespace do not matter,
+ *  - server-side prepared statements, keyed by the serialized statement.
+ *
+ * A statement is prepared the second time it is executed in the session (by
+ * any CRUD object), the same rule which was used by a single CRUD object.
+ * Statements stay prepared when CRUD objects are destroyed, at most
+ * statement_capacity of them are kept on the server, the least recently used
+ * one is deallocated when another statement needs to be prepared.
+ * All caches are bounded, least recently used entries are evicted first.
+ */
+class Statement_cache final {
+ public:
+  static constexpr size_t k_default_expression_capacity = 256;
+  static constexpr size_t k_default_statement_capacity = 16;
+  static constexpr size_t k_default_seen_statement_capacity = 256;
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t size = 0;
+  };
+
+  explicit Statement_cache(
+      size_t expression_capacity = k_default_expression_capacity,
+      size_t statement_capacity = k_default_statement_capacity,
+      size_t seen_statement_capacity = k_default_seen_statement_capacity);
+
+  Statement_cache(const Statement_cache &) = delete;
+  Statement_cache(Statement_cache &&) = delete;
+  Statement_cache &operator=(const Statement_cache &) = delete;
+  Statement_cache &operator=(Statement_cache &&) = delete;
+
+  ~Statement_cache() = default;
+
+  /**
+   * Parses a filter expression, same as parse_collection_filter() or
+   * parse_table_filter() from mysqlx::parser.
+   *
+   * @param filter expression to be parsed
+   * @param document_mode true if expression refers to a collection
+   * @param placeholders placeholders used so far, new ones are appended
+   *
+   * @returns parsed expression, owned by the caller
+   */
+  Mysqlx::Expr::Expr *parse_filter(const std::string &filter,
+                                   bool document_mode,
+                                   std::vector<std::string> *placeholders);
+
+  /**
+   * Finds the prepared statement for the given statement, preparing it if it
+   * was already seen before.
+   *
+   * @param stmt statement to be executed
+   * @param session session to prepare the statement with
+   *
+   * @returns ID of the prepared statement, 0 if statement should be executed
+   *          directly
+   */
+  uint32_t prepared_statement(
+      const Mysqlx::Prepare::Prepare_OneOfMessage &stmt,
+      mysqlshdk::db::mysqlx::Session *session);
+
+  /**
+   * Deallocates the prepared statement for the given statement, i.e. when CRUD
+   * object which was using it is modified. Next executions of this statement
+   * are going to start from scratch.
+   *
+   * @param stmt statement which is no longer going to be executed
+   * @param session session to deallocate the statement with
+   */
+  void release_prepared_statement(
+      const Mysqlx::Prepare::Prepare_OneOfMessage &stmt,
+      mysqlshdk::db::mysqlx::Session *session);
+
+  /**
+   * Forgets all prepared statements, i.e. when session is closed. If session
+   * is given, statements are deallocated on the server.
+   */
+  void clear_prepared_statements(
+      mysqlshdk::db::mysqlx::Session *session = nullptr);
+
+  Stats expression_stats() const;
+
+  Stats statement_stats() const;
+
+ private:
+  template <typename T>
+  class Lru_map final {
+   public:
+    explicit Lru_map(size_t capacity) : m_capacity(capacity) {}
+
+    T *find(const std::string &key) {
+      const auto it = m_index.find(key);
+
+      if (m_index.end() == it) {
+        return nullptr;
+      }
+
+      // move to the front, most recently used
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      return &it->second->second;
+    }
+
+    /**
+     * Adds a new entry, returns the evicted one (if any).
+     */
+    std::unique_ptr<T> insert(const std::string &key, T &&value) {
+      std::unique_ptr<T> evicted;
+
+      if (m_entries.size() >= m_capacity && !m_entries.empty()) {
+        evicted.reset(new T(std::move(m_entries.back().second)));
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+      }
+
+      m_entries.emplace_front(key, std::move(value));
+      m_index[key] = m_entries.begin();
+
+      return evicted;
+    }
+
+    /**
+     * Removes an entry, returns it (if any).
+     */
+    std::unique_ptr<T> erase(const std::string &key) {
+      std::unique_ptr<T> erased;
+      const auto it = m_index.find(key);
+
+      if (m_index.end() != it) {
+        erased.reset(new T(std::move(it->second->second)));
+        m_entries.erase(it->second);
+        m_index.erase(it);
+      }
+
+      return erased;
+    }
+
+    template <typename F>
+    void clear(F &&on_clear) {
+      for (auto &entry : m_entries) {
+        on_clear(entry.second);
+      }
+
+      m_entries.clear();
+      m_index.clear();
+    }
+
+    size_t size() const { return m_entries.size(); }
+
+   private:
+    using Entries = std::list<std::pair<std::string, T>>;
+
+    size_t m_capacity;
+    Entries m_entries;
+    std::unordered_map<std::string, typename Entries::iterator> m_index;
+  };
+
+  static void deallocate(uint32_t id, mysqlshdk::db::mysqlx::Session *session);
+
+  struct Expression {
+    std::unique_ptr<Mysqlx::Expr::Expr> expr;
+    std::vector<std::string> placeholders;
+  };
+
+  Lru_map<Expression> m_expressions;
+  // statements prepared on the server, with their IDs
+  Lru_map<uint32_t> m_statements;
+  // statements executed once, these are prepared on the next execution
+  Lru_map<bool> m_seen_statements;
+
+  uint64_t m_expression_hits = 0;
+  uint64_t m_expression_misses = 0;
+  uint64_t m_statement_hits = 0;
+  uint64_t m_statement_misses = 0;
+};
+
+}  // namespace mysqlx
+}  // namespace mysqlsh
+
+#endif  // MODULES_DEVAPI_STATEMENT_CACHE_H_
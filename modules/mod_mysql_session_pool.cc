@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/mod_mysql_session_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <utility>
+
+#include "modules/mod_mysql_resultset.h"
+#include "modules/mod_utils.h"
+#include "mysqlshdk/include/scripting/shexcept.h"
+#include "mysqlshdk/include/shellcore/base_session.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/include/shellcore/utils_help.h"
+#include "mysqlshdk/libs/db/mysql/session.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlsh {
+namespace mysql {
+
+// Documentation of the Future class
+REGISTER_HELP_CLASS(Future, mysql);
+REGISTER_HELP_CLASS_TEXT(FUTURE, R"*(
+Handle to the result of a query executed asynchronously by a SessionPool.
+
+The query is executed by one of the sessions of the pool, in a background
+thread, the result can be retrieved using <<<wait>>>() once it is needed.
+)*");
+
+Future::Future(const std::shared_ptr<State> &state) : m_state(state) {
+  init();
+}
+
+Future::Future(const std::shared_ptr<Future> &parent,
+               const shcore::Function_base_ref &callback)
+    : m_parent(parent), m_callback(callback) {
+  init();
+}
+
+void Future::init() {
+  expose("wait", &Future::wait);
+  expose("then", &Future::then, "callback");
+  expose("isDone", &Future::is_done);
+}
+
+REGISTER_HELP_FUNCTION(wait, Future);
+REGISTER_HELP_FUNCTION_TEXT(FUTURE_WAIT, R"*(
+Waits for the result of the asynchronous operation.
+
+@returns The result of the operation, a ClassicResult object or the value
+returned by the callback given to <<<then>>>().
+
+If the operation failed, the error is thrown by this function. Calling this
+function multiple times returns the same result.
+
+Waiting can be interrupted with CTRL+C, the operation is not cancelled and its
+result can be retrieved by calling this function again.
+)*");
+/**
+ * $(FUTURE_WAIT_BRIEF)
+ *
+ * $(FUTURE_WAIT)
+ */
+#if DOXYGEN_JS
+Any Future::wait() {}
+#elif DOXYGEN_PY
+any Future::wait() {}
+#endif
+shcore::Value Future::wait() {
+  if (!m_has_value) {
+    try {
+      if (m_parent) {
+        shcore::Argument_list args;
+        args.push_back(m_parent->wait());
+        m_value = m_callback->invoke(args);
+      } else {
+        wait_for_result();
+
+        if (m_state->exception) {
+          std::rethrow_exception(m_state->exception);
+        }
+
+        m_value = shcore::Value(
+            std::make_shared<ClassicResult>(std::move(m_state->result)));
+      }
+    } catch (const shcore::cancelled &) {
+      // interrupted wait can be retried
+      throw;
+    } catch (...) {
+      m_exception = std::current_exception();
+    }
+
+    m_has_value = true;
+  }
+
+  if (m_exception) {
+    std::rethrow_exception(m_exception);
+  }
+
+  return m_value;
+}
+
+REGISTER_HELP_FUNCTION(then, Future);
+REGISTER_HELP_FUNCTION_TEXT(FUTURE_THEN, R"*(
+Chains a callback to be called with the result of this operation.
+
+@param callback Function which is going to be called with the result of this
+operation.
+
+@returns A Future object holding the value returned by the callback.
+
+The callback is called by the thread which runs the script, once <<<wait>>>()
+is called on the returned object. If this operation fails, the callback is not
+called and the error is thrown by <<<wait>>>().
+)*");
+/**
+ * $(FUTURE_THEN_BRIEF)
+ *
+ * $(FUTURE_THEN)
+ */
+#if DOXYGEN_JS
+Future Future::then(Function callback) {}
+#elif DOXYGEN_PY
+Future Future::then(function callback) {}
+#endif
+std::shared_ptr<Future> Future::then(
+    const shcore::Function_base_ref &callback) {
+  if (!callback) {
+    throw shcore::Exception::argument_error("A callback is required.");
+  }
+
+  return std::make_shared<Future>(shared_from_this(), callback);
+}
+
+REGISTER_HELP_FUNCTION(isDone, Future);
+REGISTER_HELP_FUNCTION_TEXT(FUTURE_ISDONE, R"*(
+Checks if the asynchronous operation is finished.
+
+@returns true if the operation is finished and <<<wait>>>() is not going to
+block.
+)*");
+/**
+ * $(FUTURE_ISDONE_BRIEF)
+ *
+ * $(FUTURE_ISDONE)
+ */
+#if DOXYGEN_JS
+Bool Future::isDone() {}
+#elif DOXYGEN_PY
+bool Future::is_done() {}
+#endif
+bool Future::is_done() const {
+  if (m_has_value) {
+    return true;
+  }
+
+  if (m_parent) {
+    return m_parent->is_done();
+  }
+
+  std::lock_guard<std::mutex> lock(m_state->mutex);
+  return m_state->done;
+}
+
+void Future::wait_for_result() {
+  std::atomic<bool> interrupted{false};
+
+  shcore::Interrupt_handler intr([&interrupted]() {
+    interrupted = true;
+    return false;
+  });
+
+  std::unique_lock<std::mutex> lock(m_state->mutex);
+
+  while (!m_state->done) {
+    if (interrupted) {
+      throw shcore::cancelled("Interrupted while waiting for the result");
+    }
+
+    m_state->done_cv.wait_for(lock, std::chrono::milliseconds(100));
+  }
+}
+
+// Documentation of the SessionPool class
+REGISTER_HELP_CLASS(SessionPool, mysql);
+REGISTER_HELP_CLASS_TEXT(SESSIONPOOL, R"*(
+Executes queries asynchronously using a pool of MySQL Protocol sessions.
+
+Each session of the pool is used by a dedicated background thread, queries
+are executed in the order they were submitted, by the first available session.
+Results are returned as Future objects, while the queries are executing, the
+script can continue its work.
+
+Since queries can be executed by any of the sessions, session state (i.e.
+variables, temporary tables, transactions) should not be relied upon.
+)*");
+
+Session_pool::Session_pool(
+    const mysqlshdk::db::Connection_options &connection_options, int size) {
+  if (size < 1) {
+    throw shcore::Exception::argument_error(
+        "The size of the pool must be a positive number.");
+  }
+
+  expose("runSql", &Session_pool::run_sql, "query", "?args");
+  expose("all", &Session_pool::all, "futures");
+  expose("close", &Session_pool::close);
+
+  // first session prompts for a password if needed, the remaining ones reuse
+  // its connection options
+  m_sessions.emplace_back(establish_mysql_session(
+      connection_options, current_shell_options()->get().wizards));
+
+  const auto co = m_sessions.front()->get_connection_options();
+
+  for (int i = 1; i < size; ++i) {
+    m_sessions.emplace_back(establish_mysql_session(co, false));
+  }
+
+  for (const auto &session : m_sessions) {
+    m_workers.emplace_back(
+        mysqlsh::spawn_scoped_thread([this, s = session.get()]() {
+          mysqlsh::Mysql_thread mysql_thread;
+
+          while (const auto task = m_tasks.pop()) {
+            task(s);
+          }
+        }));
+  }
+}
+
+Session_pool::~Session_pool() {
+  try {
+    close();
+  } catch (const std::exception &e) {
+    log_error("Failed to close the session pool: %s", e.what());
+  }
+}
+
+REGISTER_HELP_FUNCTION(runSql, SessionPool);
+REGISTER_HELP_FUNCTION_TEXT(SESSIONPOOL_RUNSQL, R"*(
+Executes a query asynchronously and returns a Future object.
+
+@param query the SQL query to execute against the database.
+@param args Optional list of literals to use when replacing ? placeholders in
+the query string.
+
+@returns A Future object, its <<<wait>>>() function returns a ClassicResult.
+
+Rows and warnings of the result are fetched by the background thread, only
+the first result set of the query is available.
+
+@throw LogicError if the pool is closed.
+@throw ArgumentError if the parameters are invalid.
+)*");
+/**
+ * $(SESSIONPOOL_RUNSQL_BRIEF)
+ *
+ * $(SESSIONPOOL_RUNSQL)
+ */
+#if DOXYGEN_JS
+Future Session_pool::runSql(String query, Array args) {}
+#elif DOXYGEN_PY
+Future Session_pool::run_sql(str query, list args) {}
+#endif
+std::shared_ptr<Future> Session_pool::run_sql(const std::string &query,
+                                              const shcore::Array_t &args) {
+  if (m_closed) {
+    throw shcore::Exception::logic_error("The session pool is closed.");
+  }
+
+  if (query.empty()) {
+    throw shcore::Exception::argument_error("No query specified.");
+  }
+
+  auto state = std::make_shared<Future::State>();
+
+  m_tasks.push([state, sql = ShellBaseSession::sub_query_placeholders(
+                           query, args)](mysqlshdk::db::ISession *s) {
+    std::shared_ptr<mysqlshdk::db::mysql::Result> result;
+    std::exception_ptr exception;
+
+    try {
+      result = std::dynamic_pointer_cast<mysqlshdk::db::mysql::Result>(
+          s->query(sql));
+      result->buffer_and_detach();
+    } catch (const mysqlshdk::db::Error &error) {
+      exception = std::make_exception_ptr(
+          shcore::Exception::mysql_error_with_code_and_state(
+              error.what(), error.code(), error.sqlstate()));
+    } catch (...) {
+      exception = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->result = std::move(result);
+      state->exception = std::move(exception);
+      state->done = true;
+    }
+
+    state->done_cv.notify_all();
+  });
+
+  return std::make_shared<Future>(state);
+}
+
+REGISTER_HELP_FUNCTION(all, SessionPool);
+REGISTER_HELP_FUNCTION_TEXT(SESSIONPOOL_ALL, R"*(
+Waits for all the given asynchronous operations.
+
+@param futures List of Future objects.
+
+@returns A list with the results of the operations, in the same order as the
+given Future objects.
+
+If any of the operations failed, its error is thrown by this function.
+)*");
+/**
+ * $(SESSIONPOOL_ALL_BRIEF)
+ *
+ * $(SESSIONPOOL_ALL)
+ */
+#if DOXYGEN_JS
+Array Session_pool::all(Array futures) {}
+#elif DOXYGEN_PY
+list Session_pool::all(list futures) {}
+#endif
+shcore::Array_t Session_pool::all(const shcore::Array_t &futures) {
+  auto results = shcore::make_array();
+
+  if (futures) {
+    for (const auto &f : *futures) {
+      const auto future = f.as_object<Future>();
+
+      if (!future) {
+        throw shcore::Exception::argument_error(
+            "Argument #1 is expected to be a list of Future objects.");
+      }
+
+      results->emplace_back(future->wait());
+    }
+  }
+
+  return results;
+}
+
+REGISTER_HELP_FUNCTION(close, SessionPool);
+REGISTER_HELP_FUNCTION_TEXT(SESSIONPOOL_CLOSE, R"*(
+Closes the pool.
+
+Waits for all the pending queries to be executed, then closes all the
+sessions. Results of the executed queries remain available.
+)*");
+/**
+ * $(SESSIONPOOL_CLOSE_BRIEF)
+ *
+ * $(SESSIONPOOL_CLOSE)
+ */
+#if DOXYGEN_JS
+Undefined Session_pool::close() {}
+#elif DOXYGEN_PY
+None Session_pool::close() {}
+#endif
+void Session_pool::close() {
+  if (m_closed) {
+    return;
+  }
+
+  m_closed = true;
+  // workers stop once all the pending queries are executed
+  m_tasks.shutdown(m_workers.size());
+
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+
+  m_workers.clear();
+
+  for (const auto &session : m_sessions) {
+    session->close();
+  }
+
+  m_sessions.clear();
+}
+
+}  // namespace mysql
+}  // namespace mysqlsh
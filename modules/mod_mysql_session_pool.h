@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_MOD_MYSQL_SESSION_POOL_H_
+#define MODULES_MOD_MYSQL_SESSION_POOL_H_
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/mysql/result.h"
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+namespace mysqlsh {
+namespace mysql {
+
+/**
+ * \ingroup ShellAPI
+ * $(FUTURE_BRIEF)
+ *
+ * $(FUTURE)
+ */
+class SHCORE_PUBLIC Future : public shcore::Cpp_object_bridge,
+                             public std::enable_shared_from_this<Future> {
+ public:
+  /**
+   * Shared between the Future and the task which produces the result.
+   */
+  struct State {
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    bool done = false;
+    std::shared_ptr<mysqlshdk::db::mysql::Result> result;
+    std::exception_ptr exception;
+  };
+
+#if DOXYGEN_JS
+  Any wait();
+  Future then(Function callback);
+  Bool isDone();
+#elif DOXYGEN_PY
+  any wait();
+  Future then(function callback);
+  bool is_done();
+#endif
+
+  explicit Future(const std::shared_ptr<State> &state);
+
+  Future(const std::shared_ptr<Future> &parent,
+         const shcore::Function_base_ref &callback);
+
+  std::string class_name() const override { return "Future"; }
+
+  shcore::Value wait();
+  std::shared_ptr<Future> then(const shcore::Function_base_ref &callback);
+  bool is_done() const;
+
+ private:
+  void init();
+
+  void wait_for_result();
+
+  std::shared_ptr<State> m_state;
+  std::shared_ptr<Future> m_parent;
+  shcore::Function_base_ref m_callback;
+
+  bool m_has_value = false;
+  shcore::Value m_value;
+  std::exception_ptr m_exception;
+};
+
+/**
+ * \ingroup ShellAPI
+ * $(SESSIONPOOL_BRIEF)
+ *
+ * $(SESSIONPOOL)
+ */
+class SHCORE_PUBLIC Session_pool : public shcore::Cpp_object_bridge {
+ public:
+#if DOXYGEN_JS
+  Future runSql(String query, Array args);
+  Array all(Array futures);
+  Undefined close();
+#elif DOXYGEN_PY
+  Future run_sql(str query, list args);
+  list all(list futures);
+  None close();
+#endif
+
+  Session_pool(const mysqlshdk::db::Connection_options &connection_options,
+               int size);
+
+  Session_pool(const Session_pool &) = delete;
+  Session_pool(Session_pool &&) = delete;
+
+  Session_pool &operator=(const Session_pool &) = delete;
+  Session_pool &operator=(Session_pool &&) = delete;
+
+  ~Session_pool() override;
+
+  std::string class_name() const override { return "SessionPool"; }
+
+  std::shared_ptr<Future> run_sql(const std::string &query,
+                                  const shcore::Array_t &args = {});
+  shcore::Array_t all(const shcore::Array_t &futures);
+  void close();
+
+ private:
+  using Task = std::function<void(mysqlshdk::db::ISession *)>;
+
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> m_sessions;
+  // queries are executed in the order they were submitted, an empty task
+  // tells the worker to stop
+  shcore::Synchronized_queue<Task> m_tasks;
+  std::vector<std::thread> m_workers;
+  bool m_closed = false;
+};
+
+}  // namespace mysql
+}  // namespace mysqlsh
+
+#endif  // MODULES_MOD_MYSQL_SESSION_POOL_H_
@@ -200,6 +200,8 @@ void Shell::init() {
   expose("connectToPrimary", &Shell::connect_to_primary, "?connectionData",
          "?password");
   expose("openSession", &Shell::open_session, "connectionData", "?password");
+  expose("createSessionPool", &Shell::create_session_pool, "connectionData",
+         "size");
 }
 
 Shell::~Shell() {}
@@ -2076,4 +2078,41 @@ int Shell::dump_rows(const std::shared_ptr<ShellBaseResult> &resultset,
   return dumper.dump("row", false, false);
 }
 
+REGISTER_HELP_FUNCTION(createSessionPool, shell);
+REGISTER_HELP_FUNCTION_TEXT(SHELL_CREATESESSIONPOOL, R"*(
+Creates a pool of sessions which execute queries asynchronously.
+
+@param connectionData the connection data to be used to establish the
+sessions.
+@param size the number of sessions in the pool.
+
+@returns A SessionPool object.
+
+Each session of the pool is used by a dedicated background thread. Queries
+are submitted using SessionPool.<<<runSql>>>(), which immediately returns a
+Future object, the result is retrieved using Future.<<<wait>>>(). Results of
+multiple queries can be retrieved at once using SessionPool.<<<all>>>().
+
+In Python, the Global Interpreter Lock is released while the result is being
+waited for, allowing other Python threads to run.
+
+${TOPIC_CONNECTION_MORE_INFO}
+)*");
+/**
+ * $(SHELL_CREATESESSIONPOOL_BRIEF)
+ *
+ * $(SHELL_CREATESESSIONPOOL)
+ */
+#if DOXYGEN_JS
+SessionPool Shell::createSessionPool(ConnectionData connectionData,
+                                     Integer size) {}
+#elif DOXYGEN_PY
+SessionPool Shell::create_session_pool(ConnectionData connectionData,
+                                       int size) {}
+#endif
+std::shared_ptr<mysql::Session_pool> Shell::create_session_pool(
+    const mysqlshdk::db::Connection_options &connection_options, int size) {
+  return std::make_shared<mysql::Session_pool>(connection_options, size);
+}
+
 }  // namespace mysqlsh
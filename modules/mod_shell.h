@@ -28,6 +28,7 @@
 #include <string>
 #include "modules/devapi/base_resultset.h"
 #include "modules/mod_extensible_object.h"
+#include "modules/mod_mysql_session_pool.h"
 #include "modules/mod_shell_options.h"
 #include "modules/mod_shell_reports.h"
 #include "mysqlshdk/libs/db/connection_options.h"
@@ -116,6 +117,7 @@ class SHCORE_PUBLIC Shell : public shcore::Cpp_object_bridge
                                      Dictionary definition);
   Undefined registerGlobal(String name, Object object, Dictionary definition);
   Integer dumpRows(ShellBaseResult result, String format);
+  SessionPool createSessionPool(ConnectionData connectionData, Integer size);
 #elif DOXYGEN_PY
   Options options;
   Reports reports;
@@ -146,6 +148,7 @@ class SHCORE_PUBLIC Shell : public shcore::Cpp_object_bridge
                                         dict definition);
   Undefined register_global(str name, Object object, dict definition);
   int dump_rows(ShellBaseResult result, str format);
+  SessionPool create_session_pool(ConnectionData connectionData, int size);
 #endif
 
   shcore::Array_t list_credential_helpers();
@@ -185,6 +188,9 @@ class SHCORE_PUBLIC Shell : public shcore::Cpp_object_bridge
   int dump_rows(const std::shared_ptr<ShellBaseResult> &resultset,
                 const std::string &format);
 
+  std::shared_ptr<mysql::Session_pool> create_session_pool(
+      const mysqlshdk::db::Connection_options &connection_options, int size);
+
  protected:
   void init();
 
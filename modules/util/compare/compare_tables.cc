@@ -0,0 +1,672 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/compare/compare_tables.h"
+
+#include <mysqld_error.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <thread>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/db/utils/diff.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+#include "modules/mod_utils.h"
+
+namespace mysqlsh {
+namespace compare {
+
+namespace {
+
+// once a mismatching chunk has less rows than this, its rows are compared
+constexpr uint64_t k_max_rows_to_compare = 1000;
+
+// maximum number of differing rows reported for each table
+constexpr uint64_t k_max_reported_rows = 100;
+
+struct Checksum {
+  uint64_t rows = 0;
+  uint64_t hash = 0;
+};
+
+inline bool operator==(const Checksum &l, const Checksum &r) {
+  return l.rows == r.rows && l.hash == r.hash;
+}
+
+inline bool operator!=(const Checksum &l, const Checksum &r) {
+  return !(l == r);
+}
+
+std::string quote_value(const std::string &value, mysqlshdk::db::Type type) {
+  if (is_string_type(type)) {
+    return shcore::quote_sql_string(value);
+  } else if (mysqlshdk::db::Type::Decimal == type) {
+    return "'" + value + "'";
+  } else {
+    return value;
+  }
+}
+
+std::string tuple(const std::vector<std::string> &values) {
+  return 1 == values.size() ? values.front()
+                            : "(" + shcore::str_join(values, ",") + ")";
+}
+
+Checksum checksum(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+                  const std::string &query) {
+  const auto result = session->query(query);
+  const auto row = result->fetch_one();
+  Checksum checksum;
+
+  if (row) {
+    checksum.rows = row->get_uint(0, 0);
+    checksum.hash = row->get_uint(1, 0);
+  }
+
+  return checksum;
+}
+
+}  // namespace
+
+struct Compare_tables::Table_info {
+  std::string schema;
+  std::string name;
+  std::string quoted_name;
+  const dump::Instance_cache::Table *cache = nullptr;
+
+  // SELECT COUNT(*), hash of rows FROM table
+  std::string checksum_query;
+  // SELECT all columns FROM table
+  std::string rows_query;
+  // SELECT key columns FROM table
+  std::string key_query;
+  // key columns, as a tuple if there's more than one
+  std::string key;
+  // ORDER BY clause which matches the order of the index
+  std::string order_by;
+  // ORDER BY clause which matches the order used when comparing the rows
+  std::string compare_order_by;
+  // ORDER BY clause which sorts the rows by all the columns, used to compare
+  // rows with NULL values in the key
+  std::string row_order_by;
+  // condition which matches rows which have NULL values in the key
+  std::string key_has_nulls;
+  // positions of the key columns in the result of rows_query
+  std::vector<uint32_t> key_fields;
+  // positions of all the columns in the result of rows_query
+  std::vector<uint32_t> row_fields;
+  // whether the key column is selected as a hex string
+  std::vector<bool> key_hex;
+  std::vector<mysqlshdk::db::Type> key_types;
+  uint64_t rows_per_chunk = 0;
+
+  std::atomic<uint64_t> rows_compared{0};
+  std::atomic<uint64_t> differences{0};
+  std::atomic<bool> failed{false};
+};
+
+struct Compare_tables::Range {
+  // inclusive, unbounded if empty
+  std::vector<std::string> begin;
+  // exclusive, unbounded if empty
+  std::vector<std::string> end;
+  // whether this range holds rows with NULL values in a unique key
+  bool nulls = false;
+};
+
+struct Compare_tables::Worker {
+  std::shared_ptr<mysqlshdk::db::ISession> source;
+  std::shared_ptr<mysqlshdk::db::ISession> target;
+};
+
+Compare_tables::Compare_tables(const Compare_tables_options &options)
+    : m_options(options) {}
+
+Compare_tables::~Compare_tables() = default;
+
+std::string Compare_tables::where(const Table_info &table,
+                                  const Range &range) {
+  if (range.nulls) {
+    return " WHERE " + table.key_has_nulls;
+  }
+
+  std::vector<std::string> conditions;
+
+  if (!table.key_has_nulls.empty()) {
+    conditions.emplace_back("NOT " + table.key_has_nulls);
+  }
+
+  if (!range.begin.empty()) {
+    conditions.emplace_back(table.key + ">=" + tuple(range.begin));
+  }
+
+  if (!range.end.empty()) {
+    conditions.emplace_back(table.key + "<" + tuple(range.end));
+  }
+
+  return conditions.empty() ? ""
+                            : " WHERE " + shcore::str_join(conditions, " AND ");
+}
+
+std::vector<std::string> Compare_tables::key_values(
+    const Table_info &table, const mysqlshdk::db::IRow *row) {
+  std::vector<std::string> values;
+
+  for (uint32_t i = 0; i < row->num_fields(); ++i) {
+    if (row->is_null(i)) {
+      values.emplace_back("NULL");
+    } else if (table.key_hex[i]) {
+      values.emplace_back("X'" + row->get_as_string(i) + "'");
+    } else {
+      values.emplace_back(
+          quote_value(row->get_as_string(i), table.key_types[i]));
+    }
+  }
+
+  return values;
+}
+
+void Compare_tables::run() {
+  m_options.validate();
+
+  {
+    // connect once, so the user is asked for the password only once
+    const auto target = establish_session(
+        m_options.target(), current_shell_options()->get().wizards);
+    m_target = target->get_connection_options();
+    target->close();
+  }
+
+  create_table_infos();
+
+  current_console()->print_status(
+      "Comparing " + std::to_string(m_tables.size()) + " table" +
+      (m_tables.size() == 1 ? "" : "s") + " using " +
+      std::to_string(m_options.threads()) + " thread" +
+      (m_options.threads() > 1 ? "s" : "") + ".");
+
+  compare();
+
+  if (m_exception) {
+    std::rethrow_exception(m_exception);
+  }
+
+  if (!summarize()) {
+    throw std::runtime_error("Compared tables are different");
+  }
+}
+
+void Compare_tables::create_table_infos() {
+  m_cache = dump::Instance_cache_builder(
+                m_options.session(), m_options.included_schemas(),
+                m_options.included_tables(), {}, {}, true)
+                .build();
+
+  for (const auto &schema : m_options.included_schemas()) {
+    if (m_cache.schemas.end() == m_cache.schemas.find(schema)) {
+      throw std::invalid_argument("The requested schema '" + schema +
+                                  "' was not found in the database.");
+    }
+  }
+
+  for (const auto &schema : m_options.included_tables()) {
+    const auto &tables = m_cache.schemas.at(schema.first).tables;
+    std::vector<std::string> missing;
+
+    for (const auto &table : schema.second) {
+      if (tables.end() == tables.find(table)) {
+        missing.emplace_back("'" + table + "'");
+      }
+    }
+
+    if (!missing.empty()) {
+      throw std::invalid_argument(
+          "Following tables were not found in the schema '" + schema.first +
+          "': " + shcore::str_join(missing, ", "));
+    }
+  }
+
+  for (const auto &schema : m_options.included_schemas()) {
+    const auto &tables = m_cache.schemas.at(schema).tables;
+    std::vector<std::string> names;
+
+    for (const auto &table : tables) {
+      names.emplace_back(table.first);
+    }
+
+    std::sort(names.begin(), names.end());
+
+    for (const auto &name : names) {
+      const auto &cache = tables.at(name);
+      auto info = std::make_unique<Table_info>();
+      std::vector<std::string> columns;
+      std::vector<std::string> values;
+      std::vector<std::string> nulls;
+
+      info->schema = schema;
+      info->name = name;
+      info->quoted_name = shcore::quote_identifier(schema) + "." +
+                          shcore::quote_identifier(name);
+      info->cache = &cache;
+
+      for (const auto &column : cache.columns) {
+        const auto quoted = shcore::quote_identifier(column.name);
+
+        const auto cast = "CAST(" + quoted + " AS BINARY)";
+
+        columns.emplace_back(quoted);
+        // values are prefixed with their length, so that separator found in
+        // a value cannot make two different rows look the same
+        values.emplace_back("CONCAT(LENGTH(" + cast + "),':'," + cast + ")");
+        nulls.emplace_back("ISNULL(" + quoted + ")");
+      }
+
+      // CONCAT_WS() skips NULL values, hence the extra NULL markers
+      info->checksum_query = "SELECT COUNT(*),BIT_XOR(CRC32(CONCAT_WS('#'," +
+                             shcore::str_join(values, ",") + ",CONCAT(" +
+                             shcore::str_join(nulls, ",") + "))))FROM " +
+                             info->quoted_name;
+      info->rows_query = "SELECT " + shcore::str_join(columns, ",") +
+                         " FROM " + info->quoted_name;
+
+      if (cache.index.valid()) {
+        std::vector<std::string> key;
+        std::vector<std::string> key_select;
+        std::vector<std::string> key_nulls;
+
+        for (const auto &column : cache.index.columns) {
+          const auto quoted = shcore::quote_identifier(column);
+          const auto it = std::find_if(
+              cache.columns.begin(), cache.columns.end(),
+              [&column](const auto &c) { return c.name == column; });
+          const auto hex = cache.columns.end() != it && it->csv_unsafe;
+
+          key.emplace_back(quoted);
+          key_select.emplace_back(hex ? "HEX(" + quoted + ")" : quoted);
+          key_nulls.emplace_back(quoted + " IS NULL");
+          info->key_fields.emplace_back(
+              static_cast<uint32_t>(it - cache.columns.begin()));
+          info->key_hex.emplace_back(hex);
+        }
+
+        info->key = tuple(key);
+        info->key_query = "SELECT " + shcore::str_join(key_select, ",") +
+                          " FROM " + info->quoted_name;
+        info->order_by = " ORDER BY " + shcore::str_join(key, ",");
+
+        if (!cache.index.primary) {
+          info->key_has_nulls = "(" + shcore::str_join(key_nulls, " OR ") + ")";
+        }
+
+        info->rows_per_chunk =
+            std::max<uint64_t>(m_options.bytes_per_chunk() /
+                                   std::max<uint64_t>(cache.average_row_length,
+                                                      1),
+                               k_max_rows_to_compare);
+      }
+
+      m_tables.emplace_back(std::move(info));
+    }
+  }
+}
+
+void Compare_tables::compare() {
+  const auto threads = m_options.threads();
+  std::vector<std::thread> workers;
+  const auto source = get_classic_connection_options(m_options.session());
+
+  m_executor = std::make_unique<Executor>(threads, "Compare");
+
+  shcore::Interrupt_handler intr_handler([this]() -> bool {
+    current_console()->print_warning("Interrupted by user. Canceling...");
+    m_executor->cancel();
+    return false;
+  });
+
+  for (auto &table : m_tables) {
+    auto t = table.get();
+    m_executor->submit(
+        [this, t](Worker *worker) { compare_table(worker, t); },
+        shcore::Queue_priority::MEDIUM);
+  }
+
+  m_executor->finish();
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers.emplace_back(mysqlsh::spawn_scoped_thread([this, i, &source]() {
+      mysqlsh::Mysql_thread mysql_thread;
+      Worker worker;
+
+      shcore::on_leave_scope close_sessions([&worker]() {
+        if (worker.source) {
+          worker.source->close();
+        }
+
+        if (worker.target) {
+          worker.target->close();
+        }
+      });
+
+      try {
+        worker.source = establish_session(source, false);
+        worker.target = establish_session(m_target, false);
+
+        m_executor->run(i, &worker);
+      } catch (const std::exception &e) {
+        current_console()->print_error(
+            shcore::str_format("[Worker%03zu]: ", i) + e.what());
+
+        {
+          std::lock_guard<std::mutex> lock(m_exception_mutex);
+
+          if (!m_exception) {
+            m_exception = std::current_exception();
+          }
+        }
+
+        m_executor->cancel();
+      }
+    }));
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  if (m_executor->cancelled() && !m_exception) {
+    throw std::runtime_error("Interrupted by user");
+  }
+}
+
+void Compare_tables::compare_table(Worker *worker, Table_info *table) {
+  {
+    // check if table exists and has the same columns on both servers
+    const auto query = table->rows_query + " LIMIT 0";
+    const auto source = worker->source->query(query);
+    std::shared_ptr<mysqlshdk::db::IResult> target;
+
+    try {
+      target = worker->target->query(query);
+    } catch (const mysqlshdk::db::Error &e) {
+      if (ER_NO_SUCH_TABLE != e.code() && ER_BAD_FIELD_ERROR != e.code()) {
+        throw;
+      }
+
+      table->failed = true;
+      report(table, ER_NO_SUCH_TABLE == e.code()
+                        ? "table does not exist on target"
+                        : "table has different columns on target");
+      return;
+    }
+
+    if (source->get_metadata() != target->get_metadata()) {
+      table->failed = true;
+      report(table, "table has different column definitions on target");
+      return;
+    }
+
+    if (table->cache->index.valid()) {
+      std::vector<std::string> order_by;
+      const auto &metadata = source->get_metadata();
+
+      for (std::size_t i = 0; i < table->key_fields.size(); ++i) {
+        const auto &column = metadata[table->key_fields[i]];
+        const auto quoted = shcore::quote_identifier(column.get_column_name());
+
+        table->key_types.emplace_back(column.get_type());
+        // rows are compared byte by byte, ORDER BY needs to match this
+        order_by.emplace_back(is_string_type(column.get_type())
+                                  ? "CAST(" + quoted + " AS BINARY)"
+                                  : quoted);
+      }
+
+      table->compare_order_by = " ORDER BY " + shcore::str_join(order_by, ",");
+
+      if (!table->key_has_nulls.empty()) {
+        // several rows may have the same key with NULL values, their order is
+        // not defined unless they are sorted by all the columns
+        order_by.clear();
+
+        for (uint32_t i = 0; i < metadata.size(); ++i) {
+          const auto &column = metadata[i];
+          const auto quoted =
+              shcore::quote_identifier(column.get_column_name());
+
+          table->row_fields.emplace_back(i);
+          order_by.emplace_back(is_string_type(column.get_type())
+                                    ? "CAST(" + quoted + " AS BINARY)"
+                                    : quoted);
+        }
+
+        table->row_order_by = " ORDER BY " + shcore::str_join(order_by, ",");
+      }
+    }
+  }
+
+  if (!table->cache->index.valid()) {
+    compare_range(worker, table, Range{});
+    return;
+  }
+
+  const auto submit = [this, table](Range &&range) {
+    auto r = std::make_shared<Range>(std::move(range));
+    m_executor->submit([this, table, r](Worker *w) {
+      compare_range(w, table, *r);
+    });
+  };
+
+  if (!table->key_has_nulls.empty()) {
+    Range nulls;
+    nulls.nulls = true;
+    submit(std::move(nulls));
+  }
+
+  // ranges are created by walking the index on the source server
+  Range range;
+
+  while (!m_executor->cancelled()) {
+    const auto result = worker->source->query(
+        table->key_query + where(*table, range) + table->order_by +
+        " LIMIT 1 OFFSET " + std::to_string(table->rows_per_chunk));
+    const auto row = result->fetch_one();
+
+    if (!row) {
+      break;
+    }
+
+    Range chunk;
+    chunk.begin = std::move(range.begin);
+    chunk.end = key_values(*table, row);
+    range.begin = chunk.end;
+
+    submit(std::move(chunk));
+  }
+
+  submit(std::move(range));
+}
+
+void Compare_tables::compare_range(Worker *worker, Table_info *table,
+                                   const Range &range) {
+  if (table->failed) {
+    return;
+  }
+
+  const auto condition = where(*table, range);
+  const auto query = table->checksum_query + condition;
+  const auto source = checksum(worker->source, query);
+  const auto target = checksum(worker->target, query);
+
+  if (source == target) {
+    table->rows_compared += source.rows;
+    return;
+  }
+
+  if (!table->cache->index.valid()) {
+    report(table,
+           "checksum differs, table has no primary key or unique index, "
+           "differing rows cannot be identified");
+    return;
+  }
+
+  const auto rows = std::max(source.rows, target.rows);
+
+  if (range.nulls || rows <= k_max_rows_to_compare) {
+    compare_rows(worker, table, range);
+    return;
+  }
+
+  // split the range in half, using the server which has more rows in it
+  const auto &session =
+      source.rows >= target.rows ? worker->source : worker->target;
+  const auto result = session->query(table->key_query + condition +
+                                     table->order_by + " LIMIT 1 OFFSET " +
+                                     std::to_string(rows / 2));
+  const auto row = result->fetch_one();
+
+  if (!row) {
+    // rows were modified in the meantime
+    compare_rows(worker, table, range);
+    return;
+  }
+
+  auto middle = key_values(*table, row);
+
+  auto lower = std::make_shared<Range>();
+  lower->begin = range.begin;
+  lower->end = middle;
+
+  auto upper = std::make_shared<Range>();
+  upper->begin = std::move(middle);
+  upper->end = range.end;
+
+  for (const auto &r : {lower, upper}) {
+    m_executor->submit(
+        [this, table, r](Worker *w) { compare_range(w, table, *r); },
+        shcore::Queue_priority::HIGH);
+  }
+}
+
+void Compare_tables::compare_rows(Worker *worker, Table_info *table,
+                                  const Range &range) {
+  // rows with NULL values in the key cannot be matched by the key, they are
+  // compared as a whole, hence all their columns are used as a key
+  const auto &fields = range.nulls ? table->row_fields : table->key_fields;
+  const auto query =
+      table->rows_query + where(*table, range) +
+      (range.nulls ? table->row_order_by : table->compare_order_by);
+  const auto source = worker->source->query(query);
+  const auto target = worker->target->query(query);
+
+  const auto key = [&fields](const mysqlshdk::db::IRow *row) {
+    std::vector<std::string> values;
+
+    for (const auto i : fields) {
+      values.emplace_back(row->is_null(i) ? "NULL" : row->get_as_string(i));
+    }
+
+    return "(" + shcore::str_join(values, ", ") + ")";
+  };
+
+  uint64_t identical = 0;
+
+  mysqlshdk::db::find_different_rows_with_key_indexes(
+      source.get(), target.get(), fields,
+      [this, table, &key, &identical](const mysqlshdk::db::IRow *l,
+                                      const mysqlshdk::db::IRow *r,
+                                      mysqlshdk::db::Row_difference d) {
+        using mysqlshdk::db::Row_difference;
+
+        switch (d) {
+          case Row_difference::Identical:
+            ++identical;
+            return true;
+
+          case Row_difference::Fields_differ:
+            report(table, "row " + key(l) + " differs");
+            break;
+
+          case Row_difference::Row_missing:
+            report(table, "row " + key(l) + " does not exist on target");
+            break;
+
+          case Row_difference::Row_added:
+            report(table, "row " + key(r) + " exists only on target");
+            break;
+        }
+
+        return true;
+      },
+      true);
+
+  table->rows_compared += identical;
+}
+
+void Compare_tables::report(Table_info *table,
+                            const std::string &message) const {
+  if (!table->failed && ++table->differences > k_max_reported_rows) {
+    return;
+  }
+
+  current_console()->print_info(table->quoted_name + ": " + message);
+}
+
+bool Compare_tables::summarize() const {
+  const auto console = current_console();
+  std::size_t different = 0;
+  uint64_t rows = 0;
+
+  for (const auto &table : m_tables) {
+    rows += table->rows_compared;
+
+    if (table->failed || table->differences > 0) {
+      ++different;
+    }
+
+    if (!table->failed && table->differences > k_max_reported_rows) {
+      console->print_info(shcore::str_format(
+          "%s: %" PRIu64 " differences found, only the first %" PRIu64
+          " were reported",
+          table->quoted_name.c_str(), table->differences.load(),
+          k_max_reported_rows));
+    }
+  }
+
+  console->print_status(shcore::str_format(
+      "%" PRIu64 " identical rows found, %zu out of %zu tables are different.",
+      rows, different, m_tables.size()));
+
+  return 0 == different;
+}
+
+}  // namespace compare
+}  // namespace mysqlsh
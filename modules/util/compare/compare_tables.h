@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMPARE_COMPARE_TABLES_H_
+#define MODULES_UTIL_COMPARE_COMPARE_TABLES_H_
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/utils/executor.h"
+
+#include "modules/util/compare/compare_tables_options.h"
+#include "modules/util/dump/instance_cache.h"
+
+namespace mysqlsh {
+namespace compare {
+
+/**
+ * Compares contents of tables on two instances.
+ *
+ * Tables are split into chunks using their primary key (or unique index), both
+ * servers compute a checksum of each chunk, and only chunks which do not match
+ * are split further. Once a mismatching chunk is small enough, its rows are
+ * fetched from both servers and compared to find the differing rows.
+ */
+class Compare_tables final {
+ public:
+  Compare_tables() = delete;
+
+  explicit Compare_tables(const Compare_tables_options &options);
+
+  Compare_tables(const Compare_tables &) = delete;
+  Compare_tables(Compare_tables &&) = delete;
+
+  Compare_tables &operator=(const Compare_tables &) = delete;
+  Compare_tables &operator=(Compare_tables &&) = delete;
+
+  ~Compare_tables();
+
+  void run();
+
+ private:
+  struct Table_info;
+  struct Range;
+  struct Worker;
+
+  using Executor = mysqlshdk::utils::Executor<Worker *>;
+
+  static std::string where(const Table_info &table, const Range &range);
+
+  static std::vector<std::string> key_values(const Table_info &table,
+                                             const mysqlshdk::db::IRow *row);
+
+  void create_table_infos();
+
+  void compare();
+
+  void compare_table(Worker *worker, Table_info *table);
+
+  void compare_range(Worker *worker, Table_info *table, const Range &range);
+
+  void compare_rows(Worker *worker, Table_info *table, const Range &range);
+
+  bool summarize() const;
+
+  void report(Table_info *table, const std::string &message) const;
+
+  Compare_tables_options m_options;
+  mysqlshdk::db::Connection_options m_target;
+  dump::Instance_cache m_cache;
+  std::vector<std::unique_ptr<Table_info>> m_tables;
+  std::unique_ptr<Executor> m_executor;
+  std::mutex m_exception_mutex;
+  std::exception_ptr m_exception;
+};
+
+}  // namespace compare
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMPARE_COMPARE_TABLES_H_
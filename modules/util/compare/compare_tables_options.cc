@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/compare/compare_tables_options.h"
+
+#include "mysqlshdk/libs/utils/nullable.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+
+namespace mysqlsh {
+namespace compare {
+
+using mysqlshdk::utils::expand_to_bytes;
+
+namespace {
+
+constexpr auto k_minimum_chunk_size = "128k";
+
+// chunks are only hashed by the servers, their size determines how much data
+// is transferred when a difference is found
+constexpr auto k_default_chunk_size = "16M";
+
+}  // namespace
+
+Compare_tables_options::Compare_tables_options(
+    const std::string &schema, const std::vector<std::string> &tables,
+    const mysqlshdk::db::Connection_options &target)
+    : m_target(target),
+      m_bytes_per_chunk(expand_to_bytes(k_default_chunk_size)) {
+  if (schema.empty()) {
+    throw std::invalid_argument(
+        "The 'schema' parameter cannot be an empty string.");
+  }
+
+  if (tables.empty()) {
+    throw std::invalid_argument(
+        "The 'tables' parameter cannot be an empty list.");
+  }
+
+  m_included_schemas.emplace(schema);
+  m_included_tables[schema].insert(tables.begin(), tables.end());
+}
+
+Compare_tables_options::Compare_tables_options(
+    const std::vector<std::string> &schemas,
+    const mysqlshdk::db::Connection_options &target)
+    : m_target(target),
+      m_bytes_per_chunk(expand_to_bytes(k_default_chunk_size)) {
+  if (schemas.empty()) {
+    throw std::invalid_argument(
+        "The 'schemas' parameter cannot be an empty list.");
+  }
+
+  m_included_schemas.insert(schemas.begin(), schemas.end());
+}
+
+void Compare_tables_options::set_options(const shcore::Dictionary_t &options) {
+  shcore::Option_unpacker unpacker{options};
+  mysqlshdk::db::nullable<std::string> bytes_per_chunk;
+
+  unpacker.optional("threads", &m_threads)
+      .optional("bytesPerChunk", &bytes_per_chunk)
+      .end();
+
+  if (bytes_per_chunk) {
+    if (bytes_per_chunk->empty()) {
+      throw std::invalid_argument(
+          "The option 'bytesPerChunk' cannot be set to an empty string.");
+    }
+
+    m_bytes_per_chunk = expand_to_bytes(*bytes_per_chunk);
+  }
+}
+
+void Compare_tables_options::validate() const {
+  if (m_bytes_per_chunk < expand_to_bytes(k_minimum_chunk_size)) {
+    throw std::invalid_argument(
+        "The value of 'bytesPerChunk' option must be greater or equal to " +
+        std::string{k_minimum_chunk_size} + ".");
+  }
+
+  if (0 == m_threads) {
+    throw std::invalid_argument(
+        "The value of 'threads' option must be greater than 0.");
+  }
+}
+
+}  // namespace compare
+}  // namespace mysqlsh
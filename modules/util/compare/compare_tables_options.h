@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMPARE_COMPARE_TABLES_OPTIONS_H_
+#define MODULES_UTIL_COMPARE_COMPARE_TABLES_OPTIONS_H_
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/session.h"
+
+namespace mysqlsh {
+namespace compare {
+
+class Compare_tables_options final {
+ public:
+  using Objects = std::set<std::string>;
+  using Schema_objects = std::unordered_map<std::string, Objects>;
+
+  Compare_tables_options() = delete;
+
+  /**
+   * Compares the given tables of a schema.
+   */
+  Compare_tables_options(const std::string &schema,
+                         const std::vector<std::string> &tables,
+                         const mysqlshdk::db::Connection_options &target);
+
+  /**
+   * Compares all tables of the given schemas.
+   */
+  Compare_tables_options(const std::vector<std::string> &schemas,
+                         const mysqlshdk::db::Connection_options &target);
+
+  Compare_tables_options(const Compare_tables_options &) = default;
+  Compare_tables_options(Compare_tables_options &&) = default;
+
+  Compare_tables_options &operator=(const Compare_tables_options &) = default;
+  Compare_tables_options &operator=(Compare_tables_options &&) = default;
+
+  ~Compare_tables_options() = default;
+
+  void set_options(const shcore::Dictionary_t &options);
+
+  void set_session(const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+    m_session = session;
+  }
+
+  void validate() const;
+
+  const std::shared_ptr<mysqlshdk::db::ISession> &session() const {
+    return m_session;
+  }
+
+  const mysqlshdk::db::Connection_options &target() const { return m_target; }
+
+  const Objects &included_schemas() const { return m_included_schemas; }
+
+  const Schema_objects &included_tables() const { return m_included_tables; }
+
+  uint64_t threads() const { return m_threads; }
+
+  uint64_t bytes_per_chunk() const { return m_bytes_per_chunk; }
+
+ private:
+  mysqlshdk::db::Connection_options m_target;
+  std::shared_ptr<mysqlshdk::db::ISession> m_session;
+  Objects m_included_schemas;
+  Schema_objects m_included_tables;
+  uint64_t m_threads = 4;
+  uint64_t m_bytes_per_chunk;
+};
+
+}  // namespace compare
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMPARE_COMPARE_TABLES_OPTIONS_H_
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/columnar_dump_writer.h"
+
+#include <utility>
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+constexpr uint32_t k_max_rows_in_group = 128 * 1024;
+
+constexpr uint64_t k_max_row_group_data_size = 64 * 1024 * 1024;
+
+}  // namespace
+
+Columnar_dump_writer::Columnar_dump_writer(
+    std::unique_ptr<mysqlshdk::storage::IFile> out)
+    : Dump_writer(std::move(out)) {}
+
+void Columnar_dump_writer::store_preamble(
+    const std::vector<mysqlshdk::db::Column> &metadata,
+    const std::vector<Encoding_type> &) {
+  // values are stored in binary form, they are never pre-encoded
+  m_row_group.set_columns(metadata);
+}
+
+void Columnar_dump_writer::store_row(const mysqlshdk::db::IRow *row) {
+  m_row_group.append(row);
+
+  if (m_row_group.rows() >= k_max_rows_in_group ||
+      m_row_group.data_size() >= k_max_row_group_data_size) {
+    store_row_group();
+  }
+}
+
+void Columnar_dump_writer::store_postamble() {
+  if (m_row_group.rows() > 0) {
+    store_row_group();
+  }
+}
+
+void Columnar_dump_writer::store_row_group() {
+  m_encoded.clear();
+  m_row_group.encode(&m_encoded);
+  m_row_group.clear();
+
+  buffer()->will_write(m_encoded.length());
+  buffer()->append(m_encoded.data(), m_encoded.length());
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_COLUMNAR_DUMP_WRITER_H_
+#define MODULES_UTIL_DUMP_COLUMNAR_DUMP_WRITER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/util/dump/columnar_format.h"
+#include "modules/util/dump/dump_writer.h"
+
+namespace mysqlsh {
+namespace dump {
+
+/**
+ * Writes rows in the columnar format (see columnar::Row_group). Rows are
+ * buffered and written as a row group once the group is full, remaining rows
+ * are written when postamble is stored, so each chunk of a dump ends with a
+ * complete row group.
+ */
+class Columnar_dump_writer : public Dump_writer {
+ public:
+  Columnar_dump_writer() = delete;
+  explicit Columnar_dump_writer(
+      std::unique_ptr<mysqlshdk::storage::IFile> out);
+
+  Columnar_dump_writer(const Columnar_dump_writer &) = delete;
+  Columnar_dump_writer(Columnar_dump_writer &&) = default;
+
+  Columnar_dump_writer &operator=(const Columnar_dump_writer &) = delete;
+  Columnar_dump_writer &operator=(Columnar_dump_writer &&) = default;
+
+  ~Columnar_dump_writer() override = default;
+
+ private:
+  void store_preamble(
+      const std::vector<mysqlshdk::db::Column> &metadata,
+      const std::vector<Encoding_type> &pre_encoded_columns) override;
+
+  void store_row(const mysqlshdk::db::IRow *row) override;
+
+  void store_postamble() override;
+
+  void store_row_group();
+
+  columnar::Row_group m_row_group;
+
+  std::string m_encoded;
+};
+
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_COLUMNAR_DUMP_WRITER_H_
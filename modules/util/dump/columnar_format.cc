@@ -0,0 +1,723 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/columnar_format.h"
+
+#include <cctype>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "mysqlshdk/libs/storage/compression/zstd_buffer.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace columnar {
+
+namespace {
+
+constexpr char k_magic[] = {'M', 'S', 'H', 'C'};
+
+constexpr uint8_t k_version = 2;
+
+constexpr std::size_t k_header_size = sizeof(k_magic) + sizeof(uint8_t) +
+                                      2 * sizeof(uint32_t) + sizeof(uint64_t);
+
+constexpr uint8_t k_uncompressed = 0;
+
+constexpr uint8_t k_zstd = 1;
+
+constexpr int k_compression_level = 1;
+
+constexpr uint8_t k_binary_flag = 1;
+
+constexpr uint32_t k_binary_collation = 63;
+
+[[noreturn]] void corrupted() {
+  throw std::runtime_error("The columnar data is corrupted.");
+}
+
+inline void check_available(const char *ptr, const char *end,
+                            uint64_t length) {
+  if (static_cast<uint64_t>(end - ptr) < length) {
+    corrupted();
+  }
+}
+
+template <typename T>
+void put_int(T value, std::string *out) {
+  char buffer[sizeof(T)];
+
+  for (std::size_t i = sizeof(T); i > 0; --i) {
+    buffer[i - 1] = static_cast<char>(value & 0xFF);
+    value = static_cast<T>(value >> 8);
+  }
+
+  out->append(buffer, sizeof(T));
+}
+
+template <typename T>
+T get_int(const char **ptr, const char *end) {
+  check_available(*ptr, end, sizeof(T));
+
+  T value = 0;
+
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    value = static_cast<T>((value << 8) | static_cast<uint8_t>((*ptr)[i]));
+  }
+
+  *ptr += sizeof(T);
+
+  return value;
+}
+
+inline void put_varint(uint64_t value, std::string *out) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+
+  out->push_back(static_cast<char>(value));
+}
+
+inline uint64_t get_varint(const char **ptr, const char *end) {
+  uint64_t value = 0;
+
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (*ptr == end) {
+      corrupted();
+    }
+
+    const auto byte = static_cast<uint8_t>(*(*ptr)++);
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+    if (!(byte & 0x80)) {
+      return value;
+    }
+  }
+
+  corrupted();
+}
+
+inline void put_bytes(const char *data, std::size_t length, std::string *out) {
+  put_varint(length, out);
+  out->append(data, length);
+}
+
+inline const char *get_bytes(const char **ptr, const char *end,
+                             std::size_t *out_length) {
+  const auto length = get_varint(ptr, end);
+  check_available(*ptr, end, length);
+
+  const auto data = *ptr;
+  *ptr += length;
+  *out_length = length;
+
+  return data;
+}
+
+inline uint64_t zigzag(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^
+         static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t unzigzag(uint64_t value) {
+  return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+/**
+ * Parses an unsigned integer, only if it's in the canonical form (no sign, no
+ * leading zeros), so that it can be restored without any changes.
+ */
+bool parse_unsigned(const char *data, std::size_t length, uint64_t *out) {
+  if (0 == length || ('0' == data[0] && length > 1)) {
+    return false;
+  }
+
+  uint64_t value = 0;
+
+  for (std::size_t i = 0; i < length; ++i) {
+    if (data[i] < '0' || data[i] > '9') {
+      return false;
+    }
+
+    const uint64_t digit = data[i] - '0';
+
+    if (value > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+      return false;
+    }
+
+    value = value * 10 + digit;
+  }
+
+  *out = value;
+  return true;
+}
+
+bool parse_signed(const char *data, std::size_t length, int64_t *out) {
+  constexpr auto k_max = static_cast<uint64_t>(
+      std::numeric_limits<int64_t>::max());
+  const bool negative = length > 0 && '-' == data[0];
+  uint64_t magnitude = 0;
+
+  if (!parse_unsigned(data + negative, length - negative, &magnitude)) {
+    return false;
+  }
+
+  if (negative) {
+    // -0 is not in the canonical form
+    if (0 == magnitude || magnitude > k_max + 1) {
+      return false;
+    }
+
+    *out = magnitude == k_max + 1 ? std::numeric_limits<int64_t>::min()
+                                  : -static_cast<int64_t>(magnitude);
+  } else {
+    if (magnitude > k_max) {
+      return false;
+    }
+
+    *out = static_cast<int64_t>(magnitude);
+  }
+
+  return true;
+}
+
+std::size_t read_fully(mysqlshdk::storage::IFile *file, char *buffer,
+                       std::size_t length) {
+  std::size_t total = 0;
+
+  while (total < length) {
+    const auto bytes = file->read(buffer + total, length - total);
+
+    if (bytes < 0) {
+      throw std::runtime_error("Failed to read from " + file->full_path());
+    }
+
+    if (0 == bytes) {
+      break;
+    }
+
+    total += bytes;
+  }
+
+  return total;
+}
+
+}  // namespace
+
+void Row_group::set_columns(
+    const std::vector<mysqlshdk::db::Column> &metadata) {
+  m_columns.clear();
+  m_columns.resize(metadata.size());
+
+  m_is_number_type.clear();
+  m_is_number_type.resize(metadata.size());
+
+  for (std::size_t i = 0; i < metadata.size(); ++i) {
+    const auto type = metadata[i].get_type();
+
+    m_columns[i].name = metadata[i].get_column_name();
+    m_columns[i].type = type;
+    // numbers and temporal types are also reported using the binary collation
+    m_columns[i].binary =
+        mysqlshdk::db::Type::Geometry == type ||
+        mysqlshdk::db::Type::Bit == type ||
+        ((mysqlshdk::db::Type::Bytes == type ||
+          mysqlshdk::db::Type::String == type) &&
+         k_binary_collation == metadata[i].get_collation());
+    m_is_number_type[i] = !mysqlshdk::db::is_string_type(type) &&
+                          mysqlshdk::db::Type::Bit != type;
+  }
+
+  clear();
+}
+
+void Row_group::clear() {
+  for (auto &column : m_columns) {
+    column.data.clear();
+    column.offsets.assign(1, 0);
+    column.nulls.clear();
+  }
+
+  m_rows = 0;
+  m_data_size = 0;
+}
+
+void Row_group::append(const mysqlshdk::db::IRow *row) {
+  for (uint32_t i = 0; i < m_columns.size(); ++i) {
+    const char *data = nullptr;
+    std::size_t length = 0;
+    row->get_raw_data(i, &data, &length);
+
+    bool is_null = nullptr == data;
+
+    if (!is_null && m_is_number_type[i]) {
+      // convert any strings ("inf", "-inf", "nan") into NULL, just like the
+      // text writer does
+      if ((length > 0 && std::isalpha(static_cast<unsigned char>(data[0]))) ||
+          (length > 1 && '-' == data[0] &&
+           std::isalpha(static_cast<unsigned char>(data[1])))) {
+        is_null = true;
+      }
+    }
+
+    auto &column = m_columns[i];
+
+    if (is_null) {
+      column.offsets.push_back(column.data.size());
+      column.nulls.push_back(1);
+    } else {
+      append_value(&column, data, length);
+    }
+  }
+
+  ++m_rows;
+}
+
+void Row_group::append_value(Column *column, const char *data,
+                             std::size_t length) {
+  column->data.append(data, length);
+  column->offsets.push_back(column->data.size());
+  column->nulls.push_back(0);
+
+  m_data_size += length;
+}
+
+void Row_group::encode(std::string *out) const {
+  out->append(k_magic, sizeof(k_magic));
+  out->push_back(static_cast<char>(k_version));
+  put_int<uint32_t>(m_rows, out);
+  put_int<uint32_t>(static_cast<uint32_t>(m_columns.size()), out);
+
+  // size of the body is known once all columns are encoded
+  const auto size_offset = out->size();
+  put_int<uint64_t>(0, out);
+
+  for (const auto &column : m_columns) {
+    encode_column(column, out);
+  }
+
+  std::string size;
+  put_int<uint64_t>(out->size() - size_offset - sizeof(uint64_t), &size);
+  out->replace(size_offset, size.length(), size);
+}
+
+void Row_group::encode_column(const Column &column, std::string *out) const {
+  using mysqlshdk::db::Type;
+
+  put_int<uint16_t>(static_cast<uint16_t>(column.name.length()), out);
+  out->append(column.name);
+  out->push_back(static_cast<char>(column.type));
+  out->push_back(static_cast<char>(column.binary ? k_binary_flag : 0));
+
+  const auto value = [&column](uint32_t row, std::size_t *length) {
+    *length = column.offsets[row + 1] - column.offsets[row];
+    return column.data.data() + column.offsets[row];
+  };
+
+  auto &encoded = m_encoded;
+  encoded.assign((m_rows + 7) / 8, '\0');
+
+  // bitmap of NULL values, count runs of equal values at the same time
+  uint32_t non_null = 0;
+  uint32_t runs = 0;
+  const char *previous = nullptr;
+  std::size_t previous_length = 0;
+
+  for (uint32_t row = 0; row < m_rows; ++row) {
+    if (column.nulls[row]) {
+      encoded[row / 8] |= static_cast<char>(1 << (row % 8));
+      continue;
+    }
+
+    std::size_t length = 0;
+    const auto data = value(row, &length);
+
+    if (0 == non_null || length != previous_length ||
+        0 != memcmp(data, previous, length)) {
+      ++runs;
+    }
+
+    ++non_null;
+    previous = data;
+    previous_length = length;
+  }
+
+  auto encoding = Encoding::PLAIN;
+  std::unordered_map<std::string, uint32_t> dictionary;
+  std::vector<const std::string *> dictionary_values;
+  std::vector<uint64_t> integers;
+
+  if (0 == non_null) {
+    // nop, only the bitmap is stored
+  } else if (runs * 4ull <= non_null) {
+    encoding = Encoding::RLE;
+  } else {
+    // use the dictionary if on average each value is repeated at least twice
+    std::vector<uint64_t> indexes;
+    indexes.reserve(non_null);
+
+    for (uint32_t row = 0; row < m_rows; ++row) {
+      if (column.nulls[row]) {
+        continue;
+      }
+
+      std::size_t length = 0;
+      const auto data = value(row, &length);
+      const auto it = dictionary.emplace(std::string(data, length),
+                                         static_cast<uint32_t>(
+                                             dictionary_values.size()));
+
+      if (it.second) {
+        dictionary_values.emplace_back(&it.first->first);
+
+        if (2 * dictionary_values.size() > non_null) {
+          break;
+        }
+      }
+
+      indexes.emplace_back(it.first->second);
+    }
+
+    if (2 * dictionary_values.size() <= non_null) {
+      encoding = Encoding::DICTIONARY;
+      integers = std::move(indexes);
+    } else if (Type::Integer == column.type || Type::UInteger == column.type) {
+      const bool is_signed = Type::Integer == column.type;
+      bool canonical = true;
+
+      integers.reserve(non_null);
+
+      for (uint32_t row = 0; canonical && row < m_rows; ++row) {
+        if (column.nulls[row]) {
+          continue;
+        }
+
+        std::size_t length = 0;
+        const auto data = value(row, &length);
+
+        if (is_signed) {
+          int64_t i = 0;
+          canonical = parse_signed(data, length, &i);
+          integers.emplace_back(zigzag(i));
+        } else {
+          uint64_t u = 0;
+          canonical = parse_unsigned(data, length, &u);
+          integers.emplace_back(u);
+        }
+      }
+
+      if (canonical) {
+        encoding = is_signed ? Encoding::SIGNED : Encoding::UNSIGNED;
+      }
+    }
+  }
+
+  switch (encoding) {
+    case Encoding::PLAIN:
+      for (uint32_t row = 0; row < m_rows; ++row) {
+        if (!column.nulls[row]) {
+          std::size_t length = 0;
+          const auto data = value(row, &length);
+          put_bytes(data, length, &encoded);
+        }
+      }
+      break;
+
+    case Encoding::SIGNED:
+    case Encoding::UNSIGNED:
+      for (const auto i : integers) {
+        put_varint(i, &encoded);
+      }
+      break;
+
+    case Encoding::DICTIONARY:
+      put_varint(dictionary_values.size(), &encoded);
+
+      for (const auto v : dictionary_values) {
+        put_bytes(v->data(), v->length(), &encoded);
+      }
+
+      for (const auto i : integers) {
+        put_varint(i, &encoded);
+      }
+      break;
+
+    case Encoding::RLE: {
+      uint64_t run = 0;
+
+      const auto flush = [&run, &previous, &previous_length, &encoded]() {
+        if (run > 0) {
+          put_varint(run, &encoded);
+          put_bytes(previous, previous_length, &encoded);
+        }
+      };
+
+      for (uint32_t row = 0; row < m_rows; ++row) {
+        if (column.nulls[row]) {
+          continue;
+        }
+
+        std::size_t length = 0;
+        const auto data = value(row, &length);
+
+        if (run > 0 && length == previous_length &&
+            0 == memcmp(data, previous, length)) {
+          ++run;
+        } else {
+          flush();
+
+          run = 1;
+          previous = data;
+          previous_length = length;
+        }
+      }
+
+      flush();
+      break;
+    }
+  }
+
+  mysqlshdk::storage::compression::zstd_compress(
+      encoded.data(), encoded.size(), k_compression_level, &m_compressed);
+
+  const bool compressed = m_compressed.size() < encoded.size();
+  const auto &stored = compressed ? m_compressed : encoded;
+
+  out->push_back(static_cast<char>(encoding));
+  out->push_back(static_cast<char>(compressed ? k_zstd : k_uncompressed));
+  put_int<uint64_t>(encoded.size(), out);
+  put_int<uint64_t>(stored.size(), out);
+  out->append(stored);
+}
+
+bool Row_group::decode(mysqlshdk::storage::IFile *file) {
+  char header[k_header_size];
+  const auto bytes_read = read_fully(file, header, k_header_size);
+
+  if (0 == bytes_read) {
+    return false;
+  }
+
+  if (k_header_size != bytes_read ||
+      0 != memcmp(header, k_magic, sizeof(k_magic))) {
+    corrupted();
+  }
+
+  const char *ptr = header + sizeof(k_magic);
+  const char *end = header + k_header_size;
+
+  const auto version = get_int<uint8_t>(&ptr, end);
+
+  if (k_version != version) {
+    throw std::runtime_error("Unsupported version of the columnar format: " +
+                             std::to_string(version));
+  }
+
+  const auto rows = get_int<uint32_t>(&ptr, end);
+  const auto columns = get_int<uint32_t>(&ptr, end);
+  const auto body_size = get_int<uint64_t>(&ptr, end);
+
+  if (columns > body_size) {
+    corrupted();
+  }
+
+  m_body.resize(body_size);
+
+  if (read_fully(file, &m_body[0], body_size) != body_size) {
+    corrupted();
+  }
+
+  m_rows = rows;
+  m_data_size = 0;
+  m_columns.resize(columns);
+
+  ptr = m_body.data();
+  end = ptr + m_body.size();
+
+  for (auto &column : m_columns) {
+    decode_column(&ptr, end, &column);
+    m_data_size += column.data.size();
+  }
+
+  if (ptr != end) {
+    corrupted();
+  }
+
+  return true;
+}
+
+void Row_group::decode_column(const char **ptr, const char *end,
+                              Column *column) {
+  const auto name_length = get_int<uint16_t>(ptr, end);
+  check_available(*ptr, end, name_length);
+  column->name.assign(*ptr, name_length);
+  *ptr += name_length;
+
+  column->type = static_cast<mysqlshdk::db::Type>(get_int<uint8_t>(ptr, end));
+  column->binary = 0 != (k_binary_flag & get_int<uint8_t>(ptr, end));
+
+  const auto encoding = static_cast<Encoding>(get_int<uint8_t>(ptr, end));
+  const auto compression = get_int<uint8_t>(ptr, end);
+  const auto encoded_size = get_int<uint64_t>(ptr, end);
+  const auto stored_size = get_int<uint64_t>(ptr, end);
+
+  check_available(*ptr, end, stored_size);
+
+  const char *p = *ptr;
+  *ptr += stored_size;
+
+  if (k_zstd == compression) {
+    mysqlshdk::storage::compression::zstd_decompress(p, stored_size,
+                                                     encoded_size, &m_encoded);
+    p = m_encoded.data();
+  } else if (k_uncompressed != compression || encoded_size != stored_size) {
+    corrupted();
+  }
+
+  const char *data_end = p + encoded_size;
+  const auto bitmap_size = (m_rows + 7) / 8;
+
+  check_available(p, data_end, bitmap_size);
+
+  column->data.clear();
+  column->offsets.assign(1, 0);
+  column->nulls.resize(m_rows);
+
+  for (uint32_t row = 0; row < m_rows; ++row) {
+    column->nulls[row] = (p[row / 8] >> (row % 8)) & 1;
+  }
+
+  p += bitmap_size;
+
+  const auto append = [column](const char *data, std::size_t length) {
+    column->data.append(data, length);
+    column->offsets.push_back(column->data.size());
+  };
+
+  const auto append_null = [column]() {
+    column->offsets.push_back(column->data.size());
+  };
+
+  switch (encoding) {
+    case Encoding::PLAIN:
+      for (uint32_t row = 0; row < m_rows; ++row) {
+        if (column->nulls[row]) {
+          append_null();
+        } else {
+          std::size_t length = 0;
+          const auto data = get_bytes(&p, data_end, &length);
+          append(data, length);
+        }
+      }
+      break;
+
+    case Encoding::SIGNED:
+    case Encoding::UNSIGNED:
+      for (uint32_t row = 0; row < m_rows; ++row) {
+        if (column->nulls[row]) {
+          append_null();
+        } else {
+          const auto i = get_varint(&p, data_end);
+          const auto s = Encoding::SIGNED == encoding
+                             ? std::to_string(unzigzag(i))
+                             : std::to_string(i);
+          append(s.data(), s.length());
+        }
+      }
+      break;
+
+    case Encoding::DICTIONARY: {
+      const auto size = get_varint(&p, data_end);
+      check_available(p, data_end, size);
+
+      std::vector<std::pair<const char *, std::size_t>> dictionary;
+      dictionary.reserve(size);
+
+      for (uint64_t i = 0; i < size; ++i) {
+        std::size_t length = 0;
+        const auto data = get_bytes(&p, data_end, &length);
+        dictionary.emplace_back(data, length);
+      }
+
+      for (uint32_t row = 0; row < m_rows; ++row) {
+        if (column->nulls[row]) {
+          append_null();
+        } else {
+          const auto i = get_varint(&p, data_end);
+
+          if (i >= size) {
+            corrupted();
+          }
+
+          append(dictionary[i].first, dictionary[i].second);
+        }
+      }
+      break;
+    }
+
+    case Encoding::RLE: {
+      uint64_t run = 0;
+      const char *data = nullptr;
+      std::size_t length = 0;
+
+      for (uint32_t row = 0; row < m_rows; ++row) {
+        if (column->nulls[row]) {
+          append_null();
+        } else {
+          if (0 == run) {
+            run = get_varint(&p, data_end);
+
+            if (0 == run) {
+              corrupted();
+            }
+
+            data = get_bytes(&p, data_end, &length);
+          }
+
+          append(data, length);
+          --run;
+        }
+      }
+
+      if (0 != run) {
+        corrupted();
+      }
+      break;
+    }
+
+    default:
+      corrupted();
+  }
+
+  if (p != data_end) {
+    corrupted();
+  }
+}
+
+}  // namespace columnar
+}  // namespace dump
+}  // namespace mysqlsh
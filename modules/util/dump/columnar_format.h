@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_COLUMNAR_FORMAT_H_
+#define MODULES_UTIL_DUMP_COLUMNAR_FORMAT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace columnar {
+
+/**
+ * Encoding of the values of a column chunk.
+ */
+enum class Encoding : uint8_t {
+  PLAIN,       // length-prefixed values
+  SIGNED,      // zig-zag varints, used by integer columns
+  UNSIGNED,    // varints, used by unsigned integer columns
+  DICTIONARY,  // dictionary of distinct values, followed by their indexes
+  RLE,         // run length, followed by the value
+};
+
+/**
+ * A group of rows, stored column by column.
+ *
+ * File in the columnar format is a sequence of row groups, each one is
+ * self-contained: holds names and types of columns and can be decoded on its
+ * own, so files can be concatenated. Each row group starts with a header:
+ *
+ *  - magic: "MSHC"
+ *  - version: uint8
+ *  - number of rows: uint32
+ *  - number of columns: uint32
+ *  - size of the body: uint64
+ *
+ * Header is followed by the column chunks:
+ *
+ *  - name: uint16 length + bytes
+ *  - type: uint8 (mysqlshdk::db::Type)
+ *  - flags: uint8 (1 - values are binary data)
+ *  - encoding: uint8 (Encoding)
+ *  - compression: uint8 (0 - none, 1 - zstd)
+ *  - size of the encoded data: uint64
+ *  - size of the stored data: uint64
+ *  - stored data
+ *
+ * Encoded data holds a bitmap of NULL values, followed by the non-NULL values
+ * in the given encoding. Integers are stored in network byte order.
+ */
+class Row_group final {
+ public:
+  struct Column {
+    std::string name;
+    mysqlshdk::db::Type type = mysqlshdk::db::Type::String;
+    bool binary = false;
+    std::string data;
+    std::vector<uint64_t> offsets;
+    std::vector<char> nulls;
+  };
+
+  Row_group() = default;
+
+  Row_group(const Row_group &) = delete;
+  Row_group(Row_group &&) = default;
+
+  Row_group &operator=(const Row_group &) = delete;
+  Row_group &operator=(Row_group &&) = default;
+
+  ~Row_group() = default;
+
+  /**
+   * Initializes the columns, removes all rows.
+   */
+  void set_columns(const std::vector<mysqlshdk::db::Column> &metadata);
+
+  /**
+   * Appends values of the given row.
+   */
+  void append(const mysqlshdk::db::IRow *row);
+
+  /**
+   * Removes all rows, keeps the columns.
+   */
+  void clear();
+
+  uint32_t rows() const { return m_rows; }
+
+  /**
+   * Number of bytes held by the values.
+   */
+  uint64_t data_size() const { return m_data_size; }
+
+  const std::vector<Column> &columns() const { return m_columns; }
+
+  bool is_null(std::size_t column, uint32_t row) const {
+    return m_columns[column].nulls[row];
+  }
+
+  const char *value(std::size_t column, uint32_t row,
+                    std::size_t *out_length) const {
+    const auto &c = m_columns[column];
+    *out_length = c.offsets[row + 1] - c.offsets[row];
+    return c.data.data() + c.offsets[row];
+  }
+
+  /**
+   * Encodes the rows, appending them to the output buffer.
+   */
+  void encode(std::string *out) const;
+
+  /**
+   * Reads and decodes the next row group from the given file.
+   *
+   * @returns false if there are no more row groups.
+   *
+   * @throws std::runtime_error if file is truncated or corrupted.
+   */
+  bool decode(mysqlshdk::storage::IFile *file);
+
+ private:
+  void append_value(Column *column, const char *data, std::size_t length);
+
+  void encode_column(const Column &column, std::string *out) const;
+
+  void decode_column(const char **ptr, const char *end, Column *column);
+
+  std::vector<Column> m_columns;
+  std::vector<int> m_is_number_type;
+  uint32_t m_rows = 0;
+  uint64_t m_data_size = 0;
+
+  // reused between calls
+  mutable std::string m_encoded;
+  mutable std::string m_compressed;
+  std::string m_body;
+};
+
+}  // namespace columnar
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_COLUMNAR_FORMAT_H_
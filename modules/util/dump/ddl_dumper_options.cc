@@ -65,7 +65,10 @@ void Ddl_dumper_options::unpack_options(shcore::Option_unpacker *unpacker) {
       .optional("dryRun", &m_dry_run)
       .optional("consistent", &m_consistent_dump)
       .optional("ocimds", &mds)
-      .optional("compatibility", &compatibility_options);
+      .optional("compatibility", &compatibility_options)
+      .optional("trackChanges", &m_track_changes)
+      .optional("baseDump", &m_base_dump)
+      .optional("useServerSideFiles", &m_use_server_side_files);
 
   if (bytes_per_chunk) {
     if (bytes_per_chunk->empty()) {
@@ -107,6 +110,18 @@ void Ddl_dumper_options::validate_options() const {
     throw std::invalid_argument(
         "The 'ddlOnly' and 'dataOnly' options cannot be both set to true.");
   }
+
+  if (m_ddl_only && track_changes()) {
+    throw std::invalid_argument(
+        "The 'ddlOnly' option cannot be used if the 'trackChanges' or "
+        "'baseDump' option is set.");
+  }
+
+  if (m_data_only && !m_base_dump.empty()) {
+    throw std::invalid_argument(
+        "The 'dataOnly' option cannot be used if the 'baseDump' option is "
+        "set.");
+  }
 }
 
 }  // namespace dump
@@ -66,6 +66,16 @@ class Ddl_dumper_options : public Dump_options {
 
   bool use_timezone_utc() const override { return m_timezone_utc; }
 
+  bool use_server_side_files() const override {
+    return m_use_server_side_files;
+  }
+
+  bool track_changes() const override {
+    return m_track_changes || !m_base_dump.empty();
+  }
+
+  std::string base_dump() const override { return m_base_dump; }
+
   const Compatibility_options &compatibility_options() const {
     return m_compatibility_options;
   }
@@ -95,6 +105,9 @@ class Ddl_dumper_options : public Dump_options {
   bool m_data_only = false;
   bool m_dry_run = false;
   bool m_consistent_dump = true;
+  bool m_use_server_side_files = false;
+  bool m_track_changes = false;
+  std::string m_base_dump;
 
   Compatibility_options m_compatibility_options;
 };
@@ -49,9 +49,11 @@ void Dump_options::set_options(const shcore::Dictionary_t &options) {
 
   shcore::Option_unpacker unpacker{options};
   std::string rate;
+  std::string total_rate;
   mysqlshdk::db::nullable<std::string> compression;
 
   unpacker.optional("maxRate", &rate)
+      .optional("maxTotalRate", &total_rate)
       .optional("showProgress", &m_show_progress)
       .optional("compression", &compression)
       .optional("defaultCharacterSet", &m_character_set);
@@ -67,6 +69,10 @@ void Dump_options::set_options(const shcore::Dictionary_t &options) {
     m_max_rate = mysqlshdk::utils::expand_to_bytes(rate);
   }
 
+  if (!total_rate.empty()) {
+    m_max_total_rate = mysqlshdk::utils::expand_to_bytes(total_rate);
+  }
+
   if (compression) {
     if (compression->empty()) {
       throw std::invalid_argument(
@@ -71,6 +71,8 @@ class Dump_options {
 
   int64_t max_rate() const { return m_max_rate; }
 
+  int64_t max_total_rate() const { return m_max_total_rate; }
+
   bool show_progress() const { return m_show_progress; }
 
   mysqlshdk::storage::Compression compression() const { return m_compression; }
@@ -144,6 +146,24 @@ class Dump_options {
 
   virtual bool use_timezone_utc() const = 0;
 
+  /**
+   * Whether the server should write the data files itself, if it runs on this
+   * host.
+   */
+  virtual bool use_server_side_files() const = 0;
+
+  /**
+   * Whether checksums of the tables should be stored in the dump, so that it
+   * can be used as a base of an incremental dump.
+   */
+  virtual bool track_changes() const = 0;
+
+  /**
+   * URL of the dump this dump is based on, if empty then a full dump is
+   * created.
+   */
+  virtual std::string base_dump() const = 0;
+
  protected:
   void set_compression(mysqlshdk::storage::Compression compression) {
     m_compression = compression;
@@ -217,6 +237,7 @@ class Dump_options {
 
   // common options
   int64_t m_max_rate = 0;
+  int64_t m_max_total_rate = 0;
   bool m_show_progress;
   mysqlshdk::storage::Compression m_compression =
       mysqlshdk::storage::Compression::ZSTD;
@@ -46,6 +46,13 @@ class Dump_write_result final {
   Dump_write_result(const std::string &schema, const std::string &table)
       : m_schema(schema), m_table(table) {}
 
+  Dump_write_result(const std::string &schema, const std::string &table,
+                    uint64_t data_bytes, uint64_t bytes_written)
+      : m_schema(schema),
+        m_table(table),
+        m_data_bytes(data_bytes),
+        m_bytes_written(bytes_written) {}
+
   Dump_write_result(const Dump_write_result &) = default;
   Dump_write_result(Dump_write_result &&) = default;
 
@@ -27,8 +27,11 @@
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iterator>
+#include <regex>
+#include <type_traits>
 #include <utility>
 
 #include <mysqld_error.h>
@@ -43,6 +46,7 @@
 #include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
+#include "mysqlshdk/libs/mysql/utils.h"
 #include "mysqlshdk/libs/mysql/user_privileges.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
@@ -56,10 +60,12 @@
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "modules/mod_utils.h"
+#include "modules/util/dump/columnar_dump_writer.h"
 #include "modules/util/dump/compatibility_option.h"
 #include "modules/util/dump/console_with_progress.h"
 #include "modules/util/dump/dialect_dump_writer.h"
@@ -120,6 +126,115 @@ void write_json(std::unique_ptr<mysqlshdk::storage::IFile> file,
   file->close();
 }
 
+template <typename T>
+bool histogram_value(const rapidjson::Value &value, T *out) {
+  if (std::is_signed<T>::value ? !value.IsInt64() : !value.IsUint64()) {
+    return false;
+  }
+
+  *out = std::is_signed<T>::value ? static_cast<T>(value.GetInt64())
+                                  : static_cast<T>(value.GetUint64());
+  return true;
+}
+
+/**
+ * Computes the inclusive upper boundaries of the chunks of an integer column,
+ * using its histogram (as stored in information_schema.column_statistics), so
+ * that each chunk holds approximately the same number of rows. The last chunk
+ * always ends at max and it's not included in the result.
+ *
+ * Returns an empty list if histogram cannot be used, i.e. it's not an integer
+ * histogram, or it's stale: rows outside of its range exceed half of a chunk.
+ */
+template <typename T>
+std::vector<T> histogram_chunk_ends(const rapidjson::Document &histogram,
+                                    const T min, const T max,
+                                    const uint64_t chunks) {
+  std::vector<T> ends;
+
+  if (chunks < 2 || !histogram.IsObject()) {
+    return ends;
+  }
+
+  const auto type = histogram.FindMember("histogram-type");
+  const auto buckets = histogram.FindMember("buckets");
+
+  if (histogram.MemberEnd() == type || !type->value.IsString() ||
+      histogram.MemberEnd() == buckets || !buckets->value.IsArray() ||
+      buckets->value.Empty()) {
+    return ends;
+  }
+
+  // singleton: [value, cumulative frequency]
+  // equi-height: [lower, upper, cumulative frequency, distinct values]
+  const auto singleton = 0 == strcmp("singleton", type->value.GetString());
+  const rapidjson::SizeType upper_index = singleton ? 0 : 1;
+  const rapidjson::SizeType frequency_index = singleton ? 1 : 2;
+
+  const auto valid_bucket = [frequency_index](const rapidjson::Value &b) {
+    return b.IsArray() && b.Size() > frequency_index &&
+           b[frequency_index].IsNumber();
+  };
+
+  const auto &first_bucket = buckets->value[0];
+  const auto &last_bucket = buckets->value[buckets->value.Size() - 1];
+  T lowest;
+  T highest;
+
+  if (!valid_bucket(first_bucket) || !valid_bucket(last_bucket) ||
+      !histogram_value(first_bucket[0], &lowest) ||
+      !histogram_value(last_bucket[upper_index], &highest)) {
+    return ends;
+  }
+
+  // frequencies do not include NULL values, normalize them
+  const auto total = last_bucket[frequency_index].GetDouble();
+  const auto step = 1.0 / chunks;
+  const auto tolerance =
+      (static_cast<long double>(highest) - lowest) * step / 2;
+
+  if (total <= 0.0 || static_cast<long double>(lowest) - min > tolerance ||
+      static_cast<long double>(max) - highest > tolerance) {
+    return ends;
+  }
+
+  auto target = step;
+  auto previous = 0.0;
+
+  for (const auto &bucket : buckets->value.GetArray()) {
+    T lower;
+    T upper;
+
+    if (!valid_bucket(bucket) || !histogram_value(bucket[0], &lower) ||
+        !histogram_value(bucket[upper_index], &upper)) {
+      return {};
+    }
+
+    const auto frequency = bucket[frequency_index].GetDouble() / total;
+
+    // stop before the last chunk, it always ends at max
+    while (target < frequency && target < 1.0 - step / 2) {
+      // assume that values are evenly distributed within the bucket
+      const auto ratio = (target - previous) / (frequency - previous);
+      const auto end = std::min<long double>(
+          std::max<long double>(
+              lower + (static_cast<long double>(upper) - lower) * ratio, min),
+          max);
+      const auto value = static_cast<T>(end);
+
+      if (value < max && (ends.empty() || value > ends.back())) {
+        ends.emplace_back(value);
+      }
+
+      target += step;
+    }
+
+    previous = frequency;
+  }
+
+  return ends;
+}
+
 }  // namespace
 
 class Dumper::Synchronize_workers final {
@@ -178,22 +293,10 @@ class Dumper::Table_worker final {
       m_rate_limit =
           mysqlshdk::utils::Rate_limit(m_dumper->m_options.max_rate());
 
-      while (true) {
-        const auto func = m_dumper->m_worker_tasks.pop();
-
-        if (m_dumper->m_worker_interrupt) {
-          return;
-        }
-
-        if (!func) {
-          break;
-        }
+      m_dumper->m_worker_tasks->run(m_id, this);
 
-        func(this);
-
-        if (m_dumper->m_worker_interrupt) {
-          return;
-        }
+      if (m_dumper->m_worker_interrupt) {
+        return;
       }
 
       m_dumper->assert_transaction_is_open(m_session);
@@ -223,10 +326,12 @@ class Dumper::Table_worker final {
       const Table_data_task &table,
       std::vector<Dump_writer::Encoding_type> *out_pre_encoded_columns) const {
     const auto base64 = m_dumper->m_options.use_base64();
+    // columnar format stores binary values as they are
+    const auto encode = !m_dumper->m_options.dialect().columnar_format;
     std::string query = "SELECT SQL_NO_CACHE ";
 
     for (const auto &column : table.cache->columns) {
-      if (column.csv_unsafe) {
+      if (encode && column.csv_unsafe) {
         query += shcore::sqlstring(base64 ? "TO_BASE64(!)" : "HEX(!)", 0)
                  << column.name;
 
@@ -268,7 +373,130 @@ class Dumper::Table_worker final {
     return query;
   }
 
+  bool dump_table_data_server_side(const Table_data_task &table) {
+    std::vector<Dump_writer::Encoding_type> pre_encoded_columns;
+    mysqlshdk::utils::Profile_timer timer;
+    const auto output = table.writer->output();
+    auto query = prepare_query(table, &pre_encoded_columns);
+
+    query += shcore::sqlstring(" INTO OUTFILE ? CHARACTER SET ? ", 0)
+             << output->full_path() << m_dumper->m_options.character_set();
+    query += import_table::Dialect(m_dumper->m_options.dialect()).build_sql();
+
+    timer.stage_begin("dumping");
+
+    std::shared_ptr<mysqlshdk::db::IResult> result;
+
+    try {
+      result = m_session->query(query);
+    } catch (const mysqlshdk::db::Error &e) {
+      switch (e.code()) {
+        case ER_OPTION_PREVENTS_STATEMENT:
+        case ER_CANT_CREATE_FILE:
+        case ER_FILE_EXISTS_ERROR:
+        case ER_ACCESS_DENIED_ERROR:
+        case ER_SPECIFIC_ACCESS_DENIED_ERROR:
+          if (m_dumper->m_use_server_side_files.exchange(false)) {
+            current_console()->print_note(
+                "Server was unable to write the file '" + output->full_path() +
+                "' (" + e.format() +
+                "), falling back to writing the data by the client.");
+          }
+
+          return false;
+
+        default:
+          throw;
+      }
+    }
+
+    const auto rows = result->get_affected_row_count();
+    const auto bytes = output->file_size();
+
+    timer.stage_end();
+
+    if (table.index_file) {
+      write_server_side_index(table, bytes);
+    }
+
+    log_debug("Dump of `%s`.`%s` into '%s' by the server took %f seconds",
+              table.schema.c_str(), table.name.c_str(),
+              output->full_path().c_str(), timer.total_seconds_elapsed());
+
+    m_dumper->finish_writing(table.writer, bytes);
+    m_dumper->update_progress(
+        table.cache, rows,
+        Dump_write_result{table.schema, table.name, bytes, bytes});
+
+    return true;
+  }
+
+  void write_server_side_index(const Table_data_task &table,
+                               uint64_t total_bytes) const {
+    const uint64_t write_idx_every = 1024 * 1024;  // bytes
+    const auto output = table.writer->output();
+
+    table.index_file->open(Mode::WRITE);
+
+    shcore::on_leave_scope close_index_file([&table]() {
+      try {
+        if (table.index_file->is_open()) {
+          table.index_file->close();
+        }
+      } catch (const std::runtime_error &error) {
+        log_error("%s", error.what());
+      }
+    });
+
+    // the file was written by the server, offsets of row boundaries are
+    // found by scanning it for unescaped line terminators; it was verified
+    // earlier that such files can be read, failure here is an error
+    try {
+      output->open(Mode::READ);
+
+      shcore::on_leave_scope close_output([&output]() { output->close(); });
+
+      char buffer[64 * 1024];
+      uint64_t offset = 0;
+      uint64_t last_idx = 0;
+      bool escaped = false;
+      ssize_t bytes_read;
+
+      while ((bytes_read = output->read(buffer, sizeof(buffer))) > 0) {
+        for (ssize_t i = 0; i < bytes_read; ++i) {
+          ++offset;
+
+          if (escaped) {
+            escaped = false;
+          } else if ('\\' == buffer[i]) {
+            escaped = true;
+          } else if ('\n' == buffer[i] &&
+                     offset - last_idx >= write_idx_every &&
+                     offset < total_bytes) {
+            const auto idx = mysqlshdk::utils::host_to_network(offset);
+            table.index_file->write(&idx, sizeof(uint64_t));
+            last_idx = offset;
+          }
+        }
+      }
+    } catch (const std::exception &e) {
+      throw std::runtime_error("Unable to read the file '" +
+                               output->full_path() +
+                               "' written by the server to create its "
+                               "index: " +
+                               e.what());
+    }
+
+    const auto total = mysqlshdk::utils::host_to_network(total_bytes);
+    table.index_file->write(&total, sizeof(uint64_t));
+  }
+
   void dump_table_data(const Table_data_task &table) {
+    if (m_dumper->m_use_server_side_files &&
+        dump_table_data_server_side(table)) {
+      return;
+    }
+
     Dump_write_result bytes_written_per_file;
     Dump_write_result bytes_written_per_update{table.schema, table.name};
     uint64_t rows_written_per_update = 0;
@@ -327,7 +555,7 @@ class Dumper::Table_worker final {
       }
 
       if (update_every == rows_written_per_update) {
-        m_dumper->update_progress(rows_written_per_update,
+        m_dumper->update_progress(table.cache, rows_written_per_update,
                                   bytes_written_per_update);
 
         // we don't know how much data was read from the server, number of
@@ -336,6 +564,11 @@ class Dumper::Table_worker final {
           m_rate_limit.throttle(bytes_written_per_update.data_bytes());
         }
 
+        if (m_dumper->m_total_rate_limit.enabled()) {
+          m_dumper->m_total_rate_limit.throttle(
+              bytes_written_per_update.data_bytes());
+        }
+
         rows_written_per_update = 0;
         bytes_written_per_update.reset();
       }
@@ -360,7 +593,7 @@ class Dumper::Table_worker final {
               timer.total_seconds_elapsed());
 
     m_dumper->finish_writing(table.writer, bytes_written_per_file.data_bytes());
-    m_dumper->update_progress(rows_written_per_update,
+    m_dumper->update_progress(table.cache, rows_written_per_update,
                               bytes_written_per_update);
   }
 
@@ -369,7 +602,7 @@ class Dumper::Table_worker final {
     // can be move-captured by lambda
     std::shared_ptr<Table_data_task> t =
         std::make_shared<Table_data_task>(std::move(task));
-    m_dumper->m_worker_tasks.push(
+    m_dumper->m_worker_tasks->submit(
         [task = std::move(t)](Table_worker *worker) {
           ++worker->m_dumper->m_num_threads_dumping;
 
@@ -407,8 +640,11 @@ class Dumper::Table_worker final {
     data_task.cache = table.cache;
     data_task.range = std::move(range);
     data_task.include_nulls = 0 == idx;
-    data_task.writer = m_dumper->get_table_data_writer(
-        m_dumper->get_table_data_filename(table.basename, idx, last_chunk));
+    data_task.writer =
+        m_dumper->m_options.use_single_file()
+            ? m_dumper->get_table_data_segment_writer(idx)
+            : m_dumper->get_table_data_writer(m_dumper->get_table_data_filename(
+                  table.basename, idx, last_chunk));
     if (!m_dumper->m_options.is_export_only()) {
       data_task.index_file = m_dumper->make_file(
           m_dumper->get_table_data_filename(table.basename, idx, last_chunk) +
@@ -423,7 +659,70 @@ class Dumper::Table_worker final {
     m_dumper->write_table_metadata(table, m_session);
   }
 
+  std::string checksum_table(const Table_task &table) const {
+    // AUTO_INCREMENT value may change even if data does not
+    static const std::regex k_auto_increment(" AUTO_INCREMENT=[0-9]+");
+    const auto ddl = std::regex_replace(
+        m_session->queryf("SHOW CREATE TABLE !.!", table.schema, table.name)
+            ->fetch_one_or_throw()
+            ->get_string(1),
+        k_auto_increment, "");
+
+    std::string columns;
+    std::string nulls;
+
+    for (const auto &column : table.cache->columns) {
+      // columns may use different collations, which cannot be mixed
+      columns +=
+          (shcore::sqlstring("CAST(! AS BINARY),", 0) << column.name).str();
+      nulls += (shcore::sqlstring("ISNULL(!),", 0) << column.name).str();
+    }
+
+    // remove last comma
+    nulls.pop_back();
+
+    const auto row_hash =
+        "MD5(CONCAT_WS('#'," + columns + "CONCAT(" + nulls + ")))";
+    const auto sum_of = [&row_hash](int offset) {
+      return "COALESCE(SUM(CAST(CONV(SUBSTRING(" + row_hash + ", " +
+             std::to_string(offset) + ", 16), 16, 10) AS UNSIGNED)), 0)";
+    };
+
+    // CONCAT_WS() skips NULL values, information about NULLs is appended to
+    // the checksummed string, order of rows does not matter; row hashes are
+    // summed rather than XOR-ed, so that duplicate rows do not cancel out
+    const auto query =
+        (shcore::sqlstring("SELECT SQL_NO_CACHE MD5(?), COUNT(*), ", 0) << ddl)
+            .str() +
+        sum_of(1) + ", " + sum_of(17) +
+        (shcore::sqlstring(" FROM !.! ", 0) << table.schema << table.name)
+            .str() +
+        m_dumper->get_query_comment(table.schema, table.name, "", "checksum");
+
+    const auto row = m_session->query(query)->fetch_one_or_throw();
+
+    return row->get_string(0) + ":" + row->get_as_string(1) + ":" +
+           row->get_as_string(2) + ":" + row->get_as_string(3);
+  }
+
   void create_table_data_tasks(const Table_task &table) {
+    if (m_dumper->m_options.track_changes()) {
+      const auto unchanged =
+          m_dumper->store_checksum(table, checksum_table(table));
+
+      write_table_metadata(table);
+
+      if (unchanged) {
+        current_console()->print_status(
+            "Table " + Dumper::quote(table.schema, table.name) +
+            " has not changed since the base dump, its data will not be "
+            "dumped");
+
+        m_dumper->chunking_task_finished();
+        return;
+      }
+    }
+
     auto ranges = create_ranged_tasks(table);
 
     if (0 == ranges) {
@@ -431,10 +730,17 @@ class Dumper::Table_worker final {
       ++ranges;
     }
 
-    current_console()->print_status(
-        "Data dump for table " + Dumper::quote(table.schema, table.name) +
-        " will be written to " + std::to_string(ranges) + " file" +
-        (ranges > 1 ? "s" : ""));
+    if (m_dumper->m_options.use_single_file()) {
+      current_console()->print_status(
+          "Data dump for table " + Dumper::quote(table.schema, table.name) +
+          " will be written in " + std::to_string(ranges) + " chunk" +
+          (ranges > 1 ? "s" : "") + " to a single file");
+    } else {
+      current_console()->print_status(
+          "Data dump for table " + Dumper::quote(table.schema, table.name) +
+          " will be written to " + std::to_string(ranges) + " file" +
+          (ranges > 1 ? "s" : ""));
+    }
 
     m_dumper->chunking_task_finished();
   }
@@ -484,8 +790,10 @@ class Dumper::Table_worker final {
     const auto rows_per_chunk =
         m_dumper->m_options.bytes_per_chunk() / average_row_length;
 
+    const char *method = "EXPLAIN";
+
     const auto generate_ranges = [&table, &ranges_count, &total,
-                                  &rows_per_chunk, &index, &order_by,
+                                  &rows_per_chunk, &index, &order_by, &method,
                                   this](const auto min, const auto max) {
       // if rows_per_chunk <= 1 it may mean that the rows are bigger than
       // chunk size, which means we # chunks ~= # rows
@@ -493,6 +801,43 @@ class Dumper::Table_worker final {
           rows_per_chunk > 0
               ? std::max(table.cache->row_count / rows_per_chunk, UINT64_C(1))
               : table.cache->row_count;
+
+      if (estimated_chunks > 1) {
+        // if there's a histogram, all boundaries are computed in one pass
+        const auto ends = this->plan_chunks_using_histogram(table, min, max,
+                                                            estimated_chunks);
+
+        if (!ends.empty()) {
+          method = "histogram";
+
+          auto begin = min;
+
+          for (std::size_t i = 0; i <= ends.size(); ++i) {
+            if (m_dumper->m_worker_interrupt) {
+              return;
+            }
+
+            const auto last_chunk = ends.size() == i;
+
+            Range_info range;
+            range.type = total.type;
+            range.begin = std::to_string(begin);
+            range.end = std::to_string(last_chunk ? max : ends[i]);
+
+            create_table_data_task(table, std::move(range),
+                                   std::to_string(ranges_count),
+                                   ranges_count++, last_chunk);
+
+            if (!last_chunk) {
+              // ends are always lower than max, this will not overflow
+              begin = ends[i] + 1;
+            }
+          }
+
+          return;
+        }
+      }
+
       // it should be (max - min + 1), but this can potentially overflow and
       // `+ 1` is not significant, as the result is divided anyway
       const auto estimated_step = (max - min) / estimated_chunks;
@@ -624,6 +969,8 @@ class Dumper::Table_worker final {
     } else if (mysqlshdk::db::Type::UInteger == total.type) {
       generate_ranges(min_max->get_uint(0), min_max->get_uint(1));
     } else {
+      method = "LIMIT";
+
       do {
         const auto where =
             0 == ranges_count
@@ -669,12 +1016,61 @@ class Dumper::Table_worker final {
     }
 
     timer.stage_end();
-    log_debug("Chunking of `%s`.`%s` took %f seconds", table.schema.c_str(),
-              table.name.c_str(), timer.total_seconds_elapsed());
+    log_debug("Chunking of `%s`.`%s` into %zu chunks using %s took %f seconds",
+              table.schema.c_str(), table.name.c_str(), ranges_count, method,
+              timer.total_seconds_elapsed());
 
     return ranges_count;
   }
 
+  /**
+   * Uses histogram of the first column of the index (if there's one) to
+   * compute the upper boundaries of the chunks.
+   */
+  template <typename T>
+  std::vector<T> plan_chunks_using_histogram(const Table_task &table,
+                                             const T min, const T max,
+                                             const uint64_t chunks) const {
+    const auto &column = table.cache->index.first_column();
+    const auto &histograms = table.cache->histograms;
+
+    if (histograms.end() ==
+        std::find_if(histograms.begin(), histograms.end(),
+                     [&column](const Instance_cache::Histogram &h) {
+                       return h.column == column;
+                     })) {
+      return {};
+    }
+
+    std::string json;
+
+    try {
+      const auto result = m_session->queryf(
+          "SELECT HISTOGRAM FROM information_schema.column_statistics WHERE "
+          "SCHEMA_NAME=? AND TABLE_NAME=? AND COLUMN_NAME=?",
+          table.schema, table.name, column);
+
+      if (const auto row = result->fetch_one()) {
+        json = row->get_string(0);
+      }
+    } catch (const mysqlshdk::db::Error &e) {
+      log_warning("Failed to fetch histogram of column %s of table %s: %s",
+                  shcore::quote_identifier(column).c_str(),
+                  Dumper::quote(table.schema, table.name).c_str(),
+                  e.format().c_str());
+      return {};
+    }
+
+    rapidjson::Document histogram;
+    histogram.Parse(json.c_str(), json.length());
+
+    if (histogram.HasParseError()) {
+      return {};
+    }
+
+    return histogram_chunk_ends(histogram, min, max, chunks);
+  }
+
   void handle_exception(const char *msg) {
     m_dumper->m_worker_exceptions[m_id] = std::current_exception();
     current_console()->print_error(shcore::str_format("[Worker%03zu]: ", m_id) +
@@ -842,7 +1238,8 @@ class Dumper::Memory_dumper final {
 Dumper::Dumper(const Dump_options &options)
     : m_console(std::make_shared<Console_with_progress>(m_progress,
                                                         &m_progress_mutex)),
-      m_options(options) {
+      m_options(options),
+      m_total_rate_limit(m_options.max_total_rate()) {
   m_options.validate();
 
   if (m_options.use_single_file()) {
@@ -947,6 +1344,10 @@ void Dumper::run() {
 void Dumper::do_run() {
   m_worker_interrupt = false;
 
+  if (!m_options.base_dump().empty()) {
+    read_base_dump();
+  }
+
   shcore::Interrupt_handler intr_handler([this]() -> bool {
     current_console()->print_warning("Interrupted by user. Canceling...");
     emergency_shutdown();
@@ -996,7 +1397,7 @@ void Dumper::do_run() {
 
   initialize_dump();
 
-  dump_ddl();
+  dump_global_ddl();
 
   create_schema_ddl_tasks();
   create_table_tasks();
@@ -1013,11 +1414,16 @@ void Dumper::do_run() {
     }
   }
 
+  // workers are already dumping the schema DDL and the data, users are dumped
+  // in the meantime using the main session
+  dump_users_ddl();
+
   maybe_push_shutdown_tasks();
   wait_for_all_tasks();
 
   if (!m_options.is_dry_run() && !m_worker_interrupt) {
     shutdown_progress();
+    merge_table_data_segments();
     write_dump_finished_metadata();
     summarize();
   }
@@ -1492,6 +1898,7 @@ void Dumper::initialize_counters() {
   m_total_tables = 0;
   m_total_views = 0;
   m_total_schemas = m_schema_infos.size();
+  m_unchanged_tables = 0;
 
   for (auto &schema : m_schema_infos) {
     m_total_tables += schema.tables.size();
@@ -1509,6 +1916,7 @@ void Dumper::initialize_dump() {
   }
 
   create_output_directory();
+  initialize_server_side_files();
   write_metadata();
 }
 
@@ -1520,10 +1928,125 @@ void Dumper::create_output_directory() {
   }
 }
 
+void Dumper::initialize_server_side_files() {
+  m_use_server_side_files = false;
+
+  if (!m_options.use_server_side_files() || !m_options.dump_data()) {
+    return;
+  }
+
+  const auto ignored = [](const std::string &reason) {
+    current_console()->print_note(
+        "The 'useServerSideFiles' option is ignored, " + reason + ".");
+  };
+
+  if (m_options.use_single_file()) {
+    ignored("data is written to a single file");
+    return;
+  }
+
+  if (compressed()) {
+    ignored("server cannot write compressed files");
+    return;
+  }
+
+  if (m_options.dialect().columnar_format) {
+    ignored("server cannot write files in the columnar format");
+    return;
+  }
+
+  if (!directory()->is_local()) {
+    ignored("output directory is not local");
+    return;
+  }
+
+  if (m_options.max_rate() || m_options.max_total_rate()) {
+    ignored("server-side writes cannot be throttled");
+    return;
+  }
+
+  std::string secure_file_priv;
+
+  if (!mysqlshdk::mysql::server_side_files_available(session(),
+                                                     &secure_file_priv)) {
+    ignored("server is not running on this host or cannot write files");
+    return;
+  }
+
+  const auto path = directory()->full_path() + shcore::path::path_separator;
+
+  if (!secure_file_priv.empty() &&
+      !shcore::str_beginswith(path, secure_file_priv)) {
+    ignored("output directory is not located in the server's secure_file_priv "
+            "directory '" +
+            secure_file_priv + "'");
+    return;
+  }
+
+  std::string reason;
+
+  if (!server_side_files_readable(&reason)) {
+    ignored(reason);
+    return;
+  }
+
+  m_use_server_side_files = true;
+}
+
+bool Dumper::server_side_files_readable(std::string *out_reason) {
+  assert(out_reason);
+
+  // files written by the server are owned by its user and may not be
+  // readable by the client (i.e. mode 0640 is used since 8.0.17)
+  const auto probe = directory()->file("@.probe");
+
+  shcore::on_leave_scope remove_probe([&probe]() {
+    try {
+      if (probe->exists()) {
+        probe->remove();
+      }
+    } catch (const std::exception &e) {
+      log_warning("Failed to remove the file '%s': %s",
+                  probe->full_path().c_str(), e.what());
+    }
+  });
+
+  try {
+    session()->execute(shcore::sqlstring("SELECT 1 INTO OUTFILE ?", 0)
+                       << probe->full_path());
+  } catch (const mysqlshdk::db::Error &e) {
+    log_info("Server was unable to write the file '%s': %s",
+             probe->full_path().c_str(), e.format().c_str());
+    *out_reason = "server cannot write files in the output directory";
+    return false;
+  }
+
+  try {
+    char buffer[8];
+
+    probe->open(Mode::READ);
+    shcore::on_leave_scope close_probe([&probe]() { probe->close(); });
+
+    if (probe->read(buffer, sizeof(buffer)) <= 0) {
+      throw std::runtime_error("no data was read");
+    }
+  } catch (const std::exception &e) {
+    log_info("Unable to read the file '%s' written by the server: %s",
+             probe->full_path().c_str(), e.what());
+    *out_reason = "files written by the server cannot be read by the client";
+    return false;
+  }
+
+  return true;
+}
+
 void Dumper::create_worker_threads() {
   m_worker_exceptions.clear();
   m_worker_exceptions.resize(m_options.threads());
   m_worker_synchronization = std::make_unique<Synchronize_workers>();
+  m_worker_tasks =
+      std::make_unique<mysqlshdk::utils::Executor<Table_worker *>>(
+          m_options.threads(), "Dump");
 
   for (std::size_t i = 0; i < m_options.threads(); ++i) {
     auto t = mysqlsh::spawn_scoped_thread(
@@ -1540,7 +2063,7 @@ void Dumper::wait_for_workers() {
 void Dumper::maybe_push_shutdown_tasks() {
   if (0 == m_chunking_tasks &&
       m_main_thread_finished_producing_chunking_tasks) {
-    m_worker_tasks.shutdown(m_workers.size());
+    m_worker_tasks->finish();
   }
 }
 
@@ -1560,22 +2083,34 @@ void Dumper::wait_for_all_tasks() {
     for (const auto &writer : m_worker_writers) {
       close_file(*writer);
     }
+
+    // segments are only left here if dump was interrupted
+    for (const auto &segment : m_segment_writers) {
+      const auto output = segment.second->output();
+
+      if (output->is_open()) {
+        output->close();
+      }
+
+      m_segment_files.emplace(segment.first, output->filename());
+    }
+
+    m_segment_writers.clear();
+
+    if (m_worker_interrupt) {
+      remove_table_data_segments();
+    }
   }
 
   m_workers.clear();
   m_worker_writers.clear();
 }
 
-void Dumper::dump_ddl() const {
+void Dumper::dump_global_ddl() const {
   if (!m_options.dump_ddl()) {
     return;
   }
 
-  dump_global_ddl();
-  dump_users_ddl();
-}
-
-void Dumper::dump_global_ddl() const {
   current_console()->print_status("Writing global DDL files");
 
   if (m_options.is_dry_run()) {
@@ -1606,7 +2141,7 @@ void Dumper::dump_global_ddl() const {
 }
 
 void Dumper::dump_users_ddl() const {
-  if (!m_options.dump_users()) {
+  if (!m_options.dump_ddl() || !m_options.dump_users() || m_worker_interrupt) {
     return;
   }
 
@@ -1719,12 +2254,12 @@ void Dumper::create_schema_ddl_tasks() {
   }
 
   for (const auto &schema : m_schema_infos) {
-    m_worker_tasks.push(
+    m_worker_tasks->submit(
         [&schema](Table_worker *worker) { worker->dump_schema_ddl(schema); },
         shcore::Queue_priority::HIGH);
 
     for (const auto &view : schema.views) {
-      m_worker_tasks.push(
+      m_worker_tasks->submit(
           [&schema, &view](Table_worker *worker) {
             worker->dump_view_ddl(schema, view);
           },
@@ -1732,7 +2267,7 @@ void Dumper::create_schema_ddl_tasks() {
     }
 
     for (auto &table : schema.tables) {
-      m_worker_tasks.push(
+      m_worker_tasks->submit(
           [&schema, &table](Table_worker *worker) {
             worker->dump_table_ddl(schema, table);
           },
@@ -1750,8 +2285,11 @@ void Dumper::create_table_tasks() {
     for (const auto &table : schema.tables) {
       auto task = create_table_task(schema, table);
 
-      if (!m_options.is_dry_run() && should_dump_data(task)) {
-        m_worker_tasks.push(
+      // if changes are tracked, metadata is written once the checksum is
+      // known
+      if (!m_options.is_dry_run() && should_dump_data(task) &&
+          !m_options.track_changes()) {
+        m_worker_tasks->submit(
             [task](Table_worker *worker) {
               worker->write_table_metadata(task);
             },
@@ -1822,7 +2360,7 @@ void Dumper::push_table_task(Table_task &&task) {
 
   ++m_chunking_tasks;
 
-  m_worker_tasks.push(
+  m_worker_tasks->submit(
       [task = std::move(task)](Table_worker *worker) {
         ++worker->m_dumper->m_num_threads_chunking;
 
@@ -1846,33 +2384,56 @@ Dump_writer *Dumper::get_table_data_writer(const std::string &filename) {
     auto file = m_options.use_single_file()
                     ? std::move(m_output_file)
                     : make_file(filename + k_dump_in_progress_ext, true);
-    auto compressed_file =
-        mysqlshdk::storage::make_file(std::move(file), m_options.compression());
-    std::unique_ptr<Dump_writer> writer;
-
-    if (import_table::Dialect::default_() == m_options.dialect()) {
-      writer =
-          std::make_unique<Default_dump_writer>(std::move(compressed_file));
-    } else if (import_table::Dialect::json() == m_options.dialect()) {
-      writer = std::make_unique<Json_dump_writer>(std::move(compressed_file));
-    } else if (import_table::Dialect::csv() == m_options.dialect()) {
-      writer = std::make_unique<Csv_dump_writer>(std::move(compressed_file));
-    } else if (import_table::Dialect::tsv() == m_options.dialect()) {
-      writer = std::make_unique<Tsv_dump_writer>(std::move(compressed_file));
-    } else if (import_table::Dialect::csv_unix() == m_options.dialect()) {
-      writer =
-          std::make_unique<Csv_unix_dump_writer>(std::move(compressed_file));
-    } else {
-      writer = std::make_unique<Text_dump_writer>(std::move(compressed_file),
-                                                  m_options.dialect());
-    }
-
-    m_worker_writers.emplace_back(std::move(writer));
+    m_worker_writers.emplace_back(create_dump_writer(std::move(file)));
   }
 
   return m_worker_writers.back().get();
 }
 
+Dump_writer *Dumper::get_table_data_segment_writer(std::size_t idx) {
+  std::lock_guard<std::mutex> lock(m_worker_writers_mutex);
+
+  // writer of a non-chunked table would take over the output file
+  assert(m_output_file);
+
+  auto &writer = m_segment_writers[idx];
+
+  assert(!writer);
+
+  writer = create_dump_writer(make_file(m_output_file->filename() + "." +
+                                            std::to_string(idx) +
+                                            k_dump_in_progress_ext,
+                                        true));
+
+  return writer.get();
+}
+
+std::unique_ptr<Dump_writer> Dumper::create_dump_writer(
+    std::unique_ptr<mysqlshdk::storage::IFile> file) const {
+  auto compressed_file =
+      mysqlshdk::storage::make_file(std::move(file), m_options.compression());
+  std::unique_ptr<Dump_writer> writer;
+
+  if (m_options.dialect().columnar_format) {
+    writer = std::make_unique<Columnar_dump_writer>(std::move(compressed_file));
+  } else if (import_table::Dialect::default_() == m_options.dialect()) {
+    writer = std::make_unique<Default_dump_writer>(std::move(compressed_file));
+  } else if (import_table::Dialect::json() == m_options.dialect()) {
+    writer = std::make_unique<Json_dump_writer>(std::move(compressed_file));
+  } else if (import_table::Dialect::csv() == m_options.dialect()) {
+    writer = std::make_unique<Csv_dump_writer>(std::move(compressed_file));
+  } else if (import_table::Dialect::tsv() == m_options.dialect()) {
+    writer = std::make_unique<Tsv_dump_writer>(std::move(compressed_file));
+  } else if (import_table::Dialect::csv_unix() == m_options.dialect()) {
+    writer = std::make_unique<Csv_unix_dump_writer>(std::move(compressed_file));
+  } else {
+    writer = std::make_unique<Text_dump_writer>(std::move(compressed_file),
+                                                m_options.dialect());
+  }
+
+  return writer;
+}
+
 void Dumper::finish_writing(Dump_writer *writer, uint64_t total_bytes) {
   // close the file if we're writing to multiple files, otherwise the single
   // file is going to be closed when all tasks are finished
@@ -1892,6 +2453,24 @@ void Dumper::finish_writing(Dump_writer *writer, uint64_t total_bytes) {
                          [writer](const auto &w) { return w.get() == writer; }),
           m_worker_writers.end());
     }
+  } else {
+    std::lock_guard<std::mutex> lock(m_worker_writers_mutex);
+
+    const auto segment = std::find_if(
+        m_segment_writers.begin(), m_segment_writers.end(),
+        [writer](const auto &w) { return w.second.get() == writer; });
+
+    // segment is closed right away, but it's renamed only when merged
+    if (m_segment_writers.end() != segment) {
+      const auto output = writer->output();
+
+      if (output->is_open()) {
+        output->close();
+      }
+
+      m_segment_files.emplace(segment->first, output->filename());
+      m_segment_writers.erase(segment);
+    }
   }
 }
 
@@ -1911,6 +2490,73 @@ std::string Dumper::close_file(const Dump_writer &writer) const {
   return trimmed;
 }
 
+void Dumper::merge_table_data_segments() {
+  if (m_segment_files.empty()) {
+    return;
+  }
+
+  // segments are compressed independently, output file holds a sequence of
+  // compressed streams, which is read back as a single stream
+  current_console()->print_status("Merging " +
+                                  std::to_string(m_segment_files.size()) +
+                                  " chunks into " + m_output_file->full_path());
+
+  mysqlshdk::utils::Profile_timer timer;
+  timer.stage_begin("merging");
+
+  constexpr std::size_t k_buffer_size = 4 * 1024 * 1024;
+  const auto buffer = std::make_unique<char[]>(k_buffer_size);
+
+  m_output_file->open(mysqlshdk::storage::Mode::WRITE);
+
+  for (auto it = m_segment_files.begin(); it != m_segment_files.end();) {
+    const auto segment = make_file(it->second, true);
+    ssize_t bytes_read = 0;
+
+    segment->open(mysqlshdk::storage::Mode::READ);
+
+    while ((bytes_read = segment->read(buffer.get(), k_buffer_size)) > 0) {
+      if (m_output_file->write(buffer.get(), bytes_read) != bytes_read) {
+        throw std::runtime_error("Failed to write to: " +
+                                 m_output_file->full_path());
+      }
+    }
+
+    segment->close();
+
+    if (bytes_read < 0) {
+      throw std::runtime_error("Failed to read from: " + segment->full_path());
+    }
+
+    segment->remove();
+    it = m_segment_files.erase(it);
+  }
+
+  m_output_file->close();
+
+  timer.stage_end();
+
+  log_debug("Merging chunks into '%s' took %f seconds",
+            m_output_file->full_path().c_str(), timer.total_seconds_elapsed());
+}
+
+void Dumper::remove_table_data_segments() {
+  for (const auto &segment : m_segment_files) {
+    try {
+      const auto file = make_file(segment.second);
+
+      if (file->exists()) {
+        file->remove();
+      }
+    } catch (const std::exception &e) {
+      log_warning("Failed to remove '%s': %s", segment.second.c_str(),
+                  e.what());
+    }
+  }
+
+  m_segment_files.clear();
+}
+
 void Dumper::write_metadata() const {
   if (m_options.is_export_only()) {
     return;
@@ -1998,6 +2644,16 @@ void Dumper::write_dump_started_metadata() const {
 
   doc.AddMember(StringRef("begin"), ref(m_dump_info->begin()), a);
 
+  if (!m_options.base_dump().empty()) {
+    Value base{Type::kObjectType};
+
+    base.AddMember(StringRef("url"), {m_options.base_dump().c_str(), a}, a);
+    base.AddMember(StringRef("gtidExecuted"), ref(m_base_gtid_executed), a);
+    base.AddMember(StringRef("begin"), ref(m_base_begin), a);
+
+    doc.AddMember(StringRef("baseDump"), std::move(base), a);
+  }
+
   write_json(make_file("@.json"), &doc);
 }
 
@@ -2020,14 +2676,20 @@ void Dumper::write_dump_finished_metadata() const {
   {
     Value schemas{Type::kObjectType};
 
-    for (const auto &schema : m_table_data_bytes) {
+    for (const auto &schema : m_schema_infos) {
       Value tables{Type::kObjectType};
 
-      for (const auto &table : schema.second) {
-        tables.AddMember(ref(table.first), table.second, a);
+      for (const auto &table : schema.tables) {
+        const auto bytes = m_table_data_bytes.find(table.cache);
+
+        if (m_table_data_bytes.end() != bytes) {
+          tables.AddMember(ref(table.name), bytes->second, a);
+        }
       }
 
-      schemas.AddMember(ref(schema.first), std::move(tables), a);
+      if (!tables.ObjectEmpty()) {
+        schemas.AddMember(ref(schema.name), std::move(tables), a);
+      }
     }
 
     doc.AddMember(StringRef("tableDataBytes"), std::move(schemas), a);
@@ -2044,6 +2706,22 @@ void Dumper::write_dump_finished_metadata() const {
     doc.AddMember(StringRef("chunkFileBytes"), std::move(files), a);
   }
 
+  if (m_options.track_changes()) {
+    Value schemas{Type::kObjectType};
+
+    for (const auto &schema : m_table_checksums) {
+      Value tables{Type::kObjectType};
+
+      for (const auto &table : schema.second) {
+        tables.AddMember(ref(table.first), ref(table.second), a);
+      }
+
+      schemas.AddMember(ref(schema.first), std::move(tables), a);
+    }
+
+    doc.AddMember(StringRef("tableChecksums"), std::move(schemas), a);
+  }
+
   write_json(make_file("@.done.json"), &doc);
 }
 
@@ -2244,9 +2922,16 @@ void Dumper::write_table_metadata(
     doc.AddMember(StringRef("histograms"), std::move(histograms), a);
   }
 
-  doc.AddMember(StringRef("includesData"), m_options.dump_data(), a);
+  const auto unchanged = unchanged_since_base(table.schema, table.name);
+
+  doc.AddMember(StringRef("includesData"), m_options.dump_data() && !unchanged,
+                a);
   doc.AddMember(StringRef("includesDdl"), m_options.dump_ddl(), a);
 
+  if (!m_options.base_dump().empty()) {
+    doc.AddMember(StringRef("unchangedSinceBase"), unchanged, a);
+  }
+
   doc.AddMember(StringRef("extension"), {get_table_data_ext().c_str(), a}, a);
   doc.AddMember(StringRef("chunking"), is_chunked(table), a);
 
@@ -2262,6 +2947,11 @@ void Dumper::summarize() const {
   if (!m_options.is_export_only()) {
     console->print_status("Schemas dumped: " + std::to_string(m_total_schemas));
     console->print_status("Tables dumped: " + std::to_string(m_total_tables));
+
+    if (!m_options.base_dump().empty()) {
+      console->print_status("Tables unchanged since the base dump: " +
+                            std::to_string(m_unchanged_tables));
+    }
   }
 
   console->print_status(
@@ -2290,6 +2980,11 @@ void Dumper::summarize() const {
                               m_bytes_written, m_dump_info->seconds()));
   }
 
+  if (const auto peak = shcore::get_peak_memory_usage()) {
+    console->print_status("Peak memory usage: " +
+                          mysqlshdk::utils::format_bytes(peak));
+  }
+
   summary();
 }
 
@@ -2304,10 +2999,8 @@ void Dumper::rethrow() const {
 void Dumper::emergency_shutdown() {
   m_worker_interrupt = true;
 
-  const auto workers = m_workers.size();
-
-  if (workers > 0) {
-    m_worker_tasks.shutdown(workers);
+  if (m_worker_tasks) {
+    m_worker_tasks->cancel();
   }
 }
 
@@ -2339,6 +3032,8 @@ std::string Dumper::get_table_data_ext() const {
     extension = "csv";
   } else if (dialect == Dialect::json()) {
     extension = "json";
+  } else if (dialect.columnar_format) {
+    extension = "mshc";
   }
 
   return extension + mysqlshdk::storage::get_extension(m_options.compression());
@@ -2374,7 +3069,8 @@ void Dumper::initialize_progress() {
   m_dump_info = std::make_unique<Dump_info>();
 }
 
-void Dumper::update_progress(uint64_t new_rows,
+void Dumper::update_progress(const Instance_cache::Table *table,
+                             uint64_t new_rows,
                              const Dump_write_result &new_bytes) {
   m_rows_written += new_rows;
   m_bytes_written += new_bytes.bytes_written();
@@ -2382,8 +3078,7 @@ void Dumper::update_progress(uint64_t new_rows,
 
   {
     std::lock_guard<std::mutex> lock(m_table_data_bytes_mutex);
-    m_table_data_bytes[new_bytes.schema()][new_bytes.table()] +=
-        new_bytes.data_bytes();
+    m_table_data_bytes[table] += new_bytes.data_bytes();
   }
 
   {
@@ -2672,5 +3367,118 @@ bool Dumper::is_gtid_executed_inconsistent() const {
   return !m_options.consistent_dump() || m_ftwrl_failed;
 }
 
+void Dumper::read_base_dump() {
+  const auto url = m_options.base_dump();
+  const auto dir =
+      mysqlshdk::storage::make_directory(url, m_options.oci_options());
+
+  if (!dir->exists()) {
+    throw std::invalid_argument("The base dump '" + url +
+                                "' does not exist.");
+  }
+
+  const auto read_metadata = [&dir, &url](const std::string &name) {
+    const auto file = dir->file(name);
+
+    if (!file->exists()) {
+      return shcore::Dictionary_t{};
+    }
+
+    file->open(Mode::READ);
+    const auto contents = mysqlshdk::storage::read_file(file.get());
+    file->close();
+
+    try {
+      return shcore::Value::parse(contents).as_map();
+    } catch (const std::exception &e) {
+      throw std::runtime_error("Could not parse metadata file " + name +
+                               " of the base dump '" + url + "': " + e.what());
+    }
+  };
+
+  const auto done = read_metadata("@.done.json");
+
+  if (!done) {
+    throw std::invalid_argument("The base dump '" + url +
+                                "' is not complete.");
+  }
+
+  const auto checksums = done->get_map("tableChecksums");
+
+  if (!checksums) {
+    throw std::invalid_argument(
+        "The dump '" + url +
+        "' cannot be used as a base dump, it was created without the "
+        "'trackChanges' option.");
+  }
+
+  for (const auto &schema : *checksums) {
+    auto &tables = m_base_checksums[schema.first];
+
+    for (const auto &table : *schema.second.as_map()) {
+      tables.emplace(table.first, table.second.get_string());
+    }
+  }
+
+  const auto md = read_metadata("@.json");
+
+  if (md) {
+    m_base_gtid_executed = md->get_string("gtidExecuted");
+    m_base_begin = md->get_string("begin");
+  }
+
+  current_console()->print_info(
+      "Creating an incremental dump, tables which have not changed since the "
+      "base dump started at " +
+      m_base_begin + " are going to be skipped.");
+}
+
+bool Dumper::store_checksum(const Table_task &table,
+                            const std::string &checksum) {
+  {
+    std::lock_guard<std::mutex> lock(m_table_checksums_mutex);
+    m_table_checksums[table.schema][table.name] = checksum;
+  }
+
+  const auto unchanged = unchanged_since_base(table.schema, table.name);
+
+  if (unchanged) {
+    ++m_unchanged_tables;
+  }
+
+  return unchanged;
+}
+
+bool Dumper::unchanged_since_base(const std::string &schema,
+                                  const std::string &table) const {
+  if (m_options.base_dump().empty()) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_table_checksums_mutex);
+
+  const auto current_schema = m_table_checksums.find(schema);
+
+  if (m_table_checksums.end() == current_schema) {
+    return false;
+  }
+
+  const auto current = current_schema->second.find(table);
+
+  if (current_schema->second.end() == current) {
+    return false;
+  }
+
+  const auto base_schema = m_base_checksums.find(schema);
+
+  if (m_base_checksums.end() == base_schema) {
+    return false;
+  }
+
+  const auto base = base_schema->second.find(table);
+
+  return base_schema->second.end() != base && base->second == current->second;
+}
+
 }  // namespace dump
 }  // namespace mysqlsh
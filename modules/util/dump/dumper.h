@@ -26,6 +26,7 @@
 
 #include <atomic>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -39,8 +40,9 @@
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
+#include "mysqlshdk/libs/utils/executor.h"
 #include "mysqlshdk/libs/utils/nullable.h"
-#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/rate_limit.h"
 #include "mysqlshdk/libs/utils/version.h"
 
 #include "modules/util/dump/dump_options.h"
@@ -171,6 +173,16 @@ class Dumper {
 
   void create_output_directory();
 
+  void initialize_server_side_files();
+
+  /**
+   * Checks if a file written by the server into the output directory can be
+   * read by the client.
+   *
+   * @param out_reason Set to the reason why it cannot be read.
+   */
+  bool server_side_files_readable(std::string *out_reason);
+
   void create_worker_threads();
 
   void wait_for_workers();
@@ -181,8 +193,6 @@ class Dumper {
 
   void wait_for_all_tasks();
 
-  void dump_ddl() const;
-
   void dump_global_ddl() const;
 
   void dump_users_ddl() const;
@@ -229,10 +239,19 @@ class Dumper {
 
   Dump_writer *get_table_data_writer(const std::string &filename);
 
+  Dump_writer *get_table_data_segment_writer(std::size_t idx);
+
+  std::unique_ptr<Dump_writer> create_dump_writer(
+      std::unique_ptr<mysqlshdk::storage::IFile> file) const;
+
   void finish_writing(Dump_writer *writer, uint64_t total_bytes);
 
   std::string close_file(const Dump_writer &writer) const;
 
+  void merge_table_data_segments();
+
+  void remove_table_data_segments();
+
   void write_metadata() const;
 
   void write_dump_started_metadata() const;
@@ -263,7 +282,8 @@ class Dumper {
 
   void initialize_progress();
 
-  void update_progress(uint64_t new_rows, const Dump_write_result &new_bytes);
+  void update_progress(const Instance_cache::Table *table, uint64_t new_rows,
+                       const Dump_write_result &new_bytes);
 
   void shutdown_progress();
 
@@ -291,6 +311,18 @@ class Dumper {
 
   bool is_gtid_executed_inconsistent() const;
 
+  void read_base_dump();
+
+  /**
+   * Stores the checksum of the given table.
+   *
+   * @returns true if table has not changed since the base dump
+   */
+  bool store_checksum(const Table_task &table, const std::string &checksum);
+
+  bool unchanged_since_base(const std::string &schema,
+                            const std::string &table) const;
+
   // session
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
 
@@ -328,9 +360,11 @@ class Dumper {
   std::unique_ptr<mysqlshdk::textui::Throughput> m_bytes_throughput;
   std::atomic<uint64_t> m_num_threads_chunking;
   std::atomic<uint64_t> m_num_threads_dumping;
+  // whether data chunks are written by the server
+  std::atomic<bool> m_use_server_side_files{false};
   std::mutex m_table_data_bytes_mutex;
-  // schema -> table -> data bytes
-  std::unordered_map<std::string, std::unordered_map<std::string, uint64_t>>
+  // table -> data bytes, names are taken from m_schema_infos
+  std::unordered_map<const Instance_cache::Table *, uint64_t>
       m_table_data_bytes;
 
   // path -> uncompressed bytes
@@ -339,14 +373,33 @@ class Dumper {
   // threads
   std::vector<std::thread> m_workers;
   std::vector<std::exception_ptr> m_worker_exceptions;
-  shcore::Synchronized_queue<std::function<void(Table_worker *)>>
-      m_worker_tasks;
+  std::unique_ptr<mysqlshdk::utils::Executor<Table_worker *>> m_worker_tasks;
   std::atomic<uint64_t> m_chunking_tasks;
   std::atomic<bool> m_main_thread_finished_producing_chunking_tasks;
   std::unique_ptr<Synchronize_workers> m_worker_synchronization;
   std::vector<std::unique_ptr<Dump_writer>> m_worker_writers;
+  // when dumping to a single file using multiple threads, each chunk is
+  // written to a separate segment, these are merged once all tasks are done
+  // chunk index -> writer
+  std::map<std::size_t, std::unique_ptr<Dump_writer>> m_segment_writers;
+  // chunk index -> file name
+  std::map<std::size_t, std::string> m_segment_files;
   std::mutex m_worker_writers_mutex;
   volatile bool m_worker_interrupt = false;
+  // limits the throughput of all workers
+  mysqlshdk::utils::Shared_rate_limit m_total_rate_limit;
+
+  // incremental dumps
+  std::string m_base_gtid_executed;
+  std::string m_base_begin;
+  // schema -> table -> checksum, as stored in the base dump
+  std::unordered_map<std::string, std::unordered_map<std::string, std::string>>
+      m_base_checksums;
+  mutable std::mutex m_table_checksums_mutex;
+  // schema -> table -> checksum
+  std::unordered_map<std::string, std::unordered_map<std::string, std::string>>
+      m_table_checksums;
+  std::atomic<uint64_t> m_unchanged_tables;
 };
 
 }  // namespace dump
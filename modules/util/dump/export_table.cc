@@ -62,11 +62,13 @@ void Export_table::summary() const {
   const auto columns = shcore::make_array();
   const auto decode = shcore::make_dict();
   const auto mode = m_options.use_base64() ? "FROM_BASE64" : "UNHEX";
+  // columnar format does not encode any values
+  const auto encoded = !m_options.dialect().columnar_format;
 
   for (const auto &c : m_cache->columns) {
     columns->emplace_back(c.name);
 
-    if (c.csv_unsafe) {
+    if (encoded && c.csv_unsafe) {
       decode->emplace(c.name, mode);
     }
   }
@@ -23,15 +23,28 @@
 
 #include "modules/util/dump/export_table_options.h"
 
+#include "mysqlshdk/libs/utils/nullable.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 
 namespace mysqlsh {
 namespace dump {
 
+using mysqlshdk::utils::expand_to_bytes;
+
+namespace {
+
+constexpr auto k_minimum_chunk_size = "128k";
+
+constexpr auto k_default_chunk_size = "64M";
+
+}  // namespace
+
 Export_table_options::Export_table_options(const std::string &schema_table,
                                            const std::string &output_url)
-    : Dump_options(output_url) {
+    : Dump_options(output_url),
+      m_bytes_per_chunk(expand_to_bytes(k_default_chunk_size)) {
   try {
     shcore::split_schema_and_table(schema_table, &m_schema, &m_table);
     set_includes();
@@ -45,6 +58,20 @@ Export_table_options::Export_table_options(const std::string &schema_table,
 }
 
 void Export_table_options::unpack_options(shcore::Option_unpacker *unpacker) {
+  mysqlshdk::db::nullable<std::string> bytes_per_chunk;
+
+  unpacker->optional("threads", &m_threads)
+      .optional("bytesPerChunk", &bytes_per_chunk);
+
+  if (bytes_per_chunk) {
+    if (bytes_per_chunk->empty()) {
+      throw std::invalid_argument(
+          "The option 'bytesPerChunk' cannot be set to an empty string.");
+    }
+
+    m_bytes_per_chunk = expand_to_bytes(*bytes_per_chunk);
+  }
+
   set_dialect(import_table::Dialect::unpack(unpacker));
 }
 
@@ -70,10 +97,28 @@ void Export_table_options::validate_options() const {
         "the current session, unable to deduce which table to export.");
   }
 
+  if (0 == m_threads) {
+    throw std::invalid_argument(
+        "The value of 'threads' option must be greater than 0.");
+  }
+
+  if (m_bytes_per_chunk < expand_to_bytes(k_minimum_chunk_size)) {
+    throw std::invalid_argument(
+        "The value of 'bytesPerChunk' option must be greater or equal to " +
+        std::string{k_minimum_chunk_size} + ".");
+  }
+
   if (import_table::Dialect::json() == dialect()) {
     throw std::invalid_argument("The 'json' dialect is not supported.");
   }
 
+  if (dialect().columnar_format &&
+      mysqlshdk::storage::Compression::NONE != compression()) {
+    throw std::invalid_argument(
+        "The 'compression' option cannot be used with the 'columnar' dialect, "
+        "column chunks are already compressed.");
+  }
+
   if (!exists(schema(), table())) {
     throw std::invalid_argument(
         "The requested table " + shcore::quote_identifier(schema()) + "." +
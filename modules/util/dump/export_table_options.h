@@ -54,11 +54,12 @@ class Export_table_options : public Dump_options {
 
   bool use_single_file() const override { return true; }
 
-  bool split() const override { return false; }
+  // table is chunked only if it's going to be dumped using multiple threads
+  bool split() const override { return m_threads > 1; }
 
-  uint64_t bytes_per_chunk() const override { return 0; }
+  uint64_t bytes_per_chunk() const override { return m_bytes_per_chunk; }
 
-  std::size_t threads() const override { return 1; }
+  std::size_t threads() const override { return m_threads; }
 
   bool dump_ddl() const override { return false; }
 
@@ -78,6 +79,12 @@ class Export_table_options : public Dump_options {
 
   bool use_timezone_utc() const override { return false; }
 
+  bool use_server_side_files() const override { return false; }
+
+  bool track_changes() const override { return false; }
+
+  std::string base_dump() const override { return {}; }
+
  private:
   void unpack_options(shcore::Option_unpacker *unpacker) override;
 
@@ -95,6 +102,8 @@ class Export_table_options : public Dump_options {
 
   std::string m_schema;
   std::string m_table;
+  uint64_t m_bytes_per_chunk;
+  std::size_t m_threads = 1;
 };
 
 }  // namespace dump
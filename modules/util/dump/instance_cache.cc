@@ -112,6 +112,12 @@ std::string Instance_cache::Index::order_by() const {
       columns, ",", [](const auto &c) { return shcore::quote_identifier(c); });
 }
 
+Interned_string Instance_cache_builder::String_pool::intern(
+    std::string &&value) {
+  Interned_string s{std::move(value)};
+  return *m_strings.emplace(std::move(s)).first;
+}
+
 struct Instance_cache_builder::Iterate_schema {
   std::string schema_column;
   std::vector<std::string> extra_columns;
@@ -218,7 +224,19 @@ Instance_cache_builder &Instance_cache_builder::triggers() {
   return *this;
 }
 
-Instance_cache Instance_cache_builder::build() { return std::move(m_cache); }
+Instance_cache Instance_cache_builder::build() {
+  // vectors were grown while results were streamed, release the unused memory
+  for (auto &schema : m_cache.schemas) {
+    for (auto &table : schema.second.tables) {
+      table.second.columns.shrink_to_fit();
+      table.second.index.columns.shrink_to_fit();
+      table.second.histograms.shrink_to_fit();
+      table.second.triggers.shrink_to_fit();
+    }
+  }
+
+  return std::move(m_cache);
+}
 
 void Instance_cache_builder::filter_schemas(const Objects &included,
                                             const Objects &excluded) {
@@ -254,7 +272,7 @@ void Instance_cache_builder::filter_schemas(const Objects &included,
     while (const auto row = result->fetch_one()) {
       auto schema = row->get_string(0);
 
-      m_cache.schemas[schema].collation = row->get_string(1);
+      m_cache.schemas[schema].collation = m_strings.intern(row->get_string(1));
       schemas.emplace(std::move(schema));
     }
   }
@@ -317,16 +335,16 @@ void Instance_cache_builder::filter_tables(const Schema_objects &included,
         auto &table = schema->tables[table_name];
         table.row_count = row->get_uint(3, 0);
         table.average_row_length = row->get_uint(4, 0);
-        table.engine = row->get_string(5, "");
-        table.create_options = row->get_string(6, "");
-        table.comment = row->get_string(7, "");
+        table.engine = m_strings.intern(row->get_string(5, ""));
+        table.create_options = m_strings.intern(row->get_string(6, ""));
+        table.comment = m_strings.intern(row->get_string(7, ""));
         m_has_tables = true;
 
         DBUG_EXECUTE_IF("dumper_average_row_length_0",
                         { table.average_row_length = 0; });
       } else if ("VIEW" == table_type) {
         // nop, just to insert the view
-        schema->views[table_name].character_set_client = "";
+        schema->views[table_name];
         m_has_views = true;
       }
     }
@@ -400,10 +418,10 @@ void Instance_cache_builder::fetch_view_metadata() {
                         "COLLATION_CONNECTION"};  // NOT NULL
   info.table_name = "views";
 
-  iterate_views(info, [](const std::string &, Instance_cache::View *view,
-                         const mysqlshdk::db::IRow *row) {
-    view->character_set_client = row->get_string(2);
-    view->collation_connection = row->get_string(3);
+  iterate_views(info, [this](const std::string &, Instance_cache::View *view,
+                             const mysqlshdk::db::IRow *row) {
+    view->character_set_client = m_strings.intern(row->get_string(2));
+    view->collation_connection = m_strings.intern(row->get_string(3));
   });
 }
 
@@ -421,12 +439,12 @@ void Instance_cache_builder::fetch_table_columns() {
   info.where = "EXTRA <> 'VIRTUAL GENERATED' AND EXTRA <> 'STORED GENERATED'";
   info.order_by = {"ORDINAL_POSITION"};
 
-  iterate_tables(info, [](const std::string &, Instance_cache::Table *table,
-                          const mysqlshdk::db::IRow *row) {
+  iterate_tables(info, [this](const std::string &, Instance_cache::Table *table,
+                              const mysqlshdk::db::IRow *row) {
     Instance_cache::Column column;
     // these can be NULL in 8.0, as per output of 'SHOW COLUMNS', but it's not
     // likely, as they're NOT NULL in definition of mysql.columns hidden table
-    column.name = row->get_string(2, "");
+    column.name = m_strings.intern(row->get_string(2, ""));
     const auto type = row->get_string(3, "");
     column.csv_unsafe = shcore::str_iendswith(
         type, "binary", "bit", "blob", "geometry", "geomcollection",
@@ -455,7 +473,7 @@ void Instance_cache_builder::fetch_table_indexes() {
   std::string current_table;
 
   iterate_tables(
-      info, [&primary_index, &index_name, &current_table](
+      info, [this, &primary_index, &index_name, &current_table](
                 const std::string &table_name, Instance_cache::Table *table,
                 const mysqlshdk::db::IRow *row) {
         if (table_name != current_table) {
@@ -478,7 +496,8 @@ void Instance_cache_builder::fetch_table_indexes() {
 
         if (index_name == current_index) {
           // NULL values in COLUMN_NAME are filtered out
-          table->index.columns.emplace_back(row->get_string(3));
+          table->index.columns.emplace_back(
+              m_strings.intern(row->get_string(3)));
         }
       });
 }
@@ -499,11 +518,11 @@ void Instance_cache_builder::fetch_table_histograms() {
   info.table_name = "column_statistics";
   info.order_by = {"COLUMN_NAME"};
 
-  iterate_tables(info, [](const std::string &, Instance_cache::Table *table,
-                          const mysqlshdk::db::IRow *row) {
+  iterate_tables(info, [this](const std::string &, Instance_cache::Table *table,
+                              const mysqlshdk::db::IRow *row) {
     Instance_cache::Histogram histogram;
 
-    histogram.column = row->get_string(2);
+    histogram.column = m_strings.intern(row->get_string(2));
     histogram.buckets = shcore::lexical_cast<std::size_t>(row->get_string(3));
 
     table->histograms.emplace_back(std::move(histogram));
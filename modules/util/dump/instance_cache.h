@@ -27,6 +27,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -39,9 +40,82 @@
 namespace mysqlsh {
 namespace dump {
 
+/**
+ * Immutable string, copies share the same value. Instance_cache_builder uses
+ * a single copy of the value for all the objects which refer to the same
+ * string, i.e. names of the columns (instances with lots of schemas usually
+ * have the same tables in all of them), engines, collations.
+ */
+class Interned_string final {
+ public:
+  Interned_string() : m_value(empty_value()) {}
+
+  Interned_string(const char *value)  // NOLINT(runtime/explicit)
+      : m_value(std::make_shared<const std::string>(value)) {}
+
+  Interned_string(const std::string &value)  // NOLINT(runtime/explicit)
+      : m_value(std::make_shared<const std::string>(value)) {}
+
+  Interned_string(std::string &&value)  // NOLINT(runtime/explicit)
+      : m_value(std::make_shared<const std::string>(std::move(value))) {}
+
+  Interned_string(const Interned_string &) = default;
+  Interned_string(Interned_string &&) = default;
+
+  Interned_string &operator=(const Interned_string &) = default;
+  Interned_string &operator=(Interned_string &&) = default;
+
+  ~Interned_string() = default;
+
+  operator const std::string &() const noexcept { return *m_value; }
+
+  const std::string &str() const noexcept { return *m_value; }
+
+  const char *c_str() const noexcept { return m_value->c_str(); }
+
+  bool empty() const noexcept { return m_value->empty(); }
+
+ private:
+  static const std::shared_ptr<const std::string> &empty_value() {
+    static const auto s_empty = std::make_shared<const std::string>();
+    return s_empty;
+  }
+
+  std::shared_ptr<const std::string> m_value;
+};
+
+inline bool operator==(const Interned_string &l, const Interned_string &r) {
+  return l.str() == r.str();
+}
+
+inline bool operator==(const Interned_string &l, const std::string &r) {
+  return l.str() == r;
+}
+
+inline bool operator==(const std::string &l, const Interned_string &r) {
+  return l == r.str();
+}
+
+inline bool operator==(const Interned_string &l, const char *r) {
+  return l.str() == r;
+}
+
+inline bool operator==(const char *l, const Interned_string &r) {
+  return l == r.str();
+}
+
+template <typename T>
+inline bool operator!=(const Interned_string &l, const T &r) {
+  return !(l == r);
+}
+
+inline std::ostream &operator<<(std::ostream &os, const Interned_string &s) {
+  return os << s.str();
+}
+
 struct Instance_cache {
   struct Column {
-    std::string name;
+    Interned_string name;
     bool csv_unsafe = false;
   };
 
@@ -53,26 +127,26 @@ struct Instance_cache {
         throw std::logic_error("Trying to access invalid index");
       }
 
-      return columns.front();
+      return columns.front().str();
     }
 
     std::string order_by() const;
 
-    std::vector<std::string> columns;
+    std::vector<Interned_string> columns;
     bool primary = false;
   };
 
   struct Histogram {
-    std::string column;
+    Interned_string column;
     std::size_t buckets = 0;
   };
 
   struct Table {
     uint64_t row_count = 0;
     uint64_t average_row_length = 0;
-    std::string engine;
-    std::string create_options;
-    std::string comment;
+    Interned_string engine;
+    Interned_string create_options;
+    Interned_string comment;
     Index index;
     std::vector<Column> columns;
     std::vector<Histogram> histograms;
@@ -80,12 +154,12 @@ struct Instance_cache {
   };
 
   struct View {
-    std::string character_set_client;
-    std::string collation_connection;
+    Interned_string character_set_client;
+    Interned_string collation_connection;
   };
 
   struct Schema {
-    std::string collation;
+    Interned_string collation;
     std::unordered_map<std::string, Table> tables;
     std::unordered_map<std::string, View> views;
     std::unordered_set<std::string> events;
@@ -142,6 +216,20 @@ class Instance_cache_builder final {
  private:
   struct Iterate_schema;
 
+  class String_pool final {
+   public:
+    Interned_string intern(std::string &&value);
+
+   private:
+    struct Hash {
+      std::size_t operator()(const Interned_string &s) const {
+        return std::hash<std::string>()(s.str());
+      }
+    };
+
+    std::unordered_set<Interned_string, Hash> m_strings;
+  };
+
   struct Iterate_table;
 
   void filter_schemas(const Objects &included, const Objects &excluded);
@@ -190,6 +278,8 @@ class Instance_cache_builder final {
 
   Instance_cache m_cache;
 
+  String_pool m_strings;
+
   Objects m_schemas;
 
   bool m_has_tables = false;
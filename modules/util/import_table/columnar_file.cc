@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/import_table/columnar_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+namespace {
+
+constexpr std::size_t k_buffer_size = 1024 * 1024;
+
+}  // namespace
+
+Columnar_file::Columnar_file(std::unique_ptr<mysqlshdk::storage::IFile> file,
+                             std::vector<bool> hex_columns,
+                             std::vector<std::string> columns)
+    : Compressed_file(std::move(file)),
+      m_hex_columns(std::move(hex_columns)),
+      m_columns(std::move(columns)) {}
+
+void Columnar_file::open(mysqlshdk::storage::Mode m) {
+  if (mysqlshdk::storage::Mode::READ != m) {
+    throw std::invalid_argument(
+        "Files in the columnar format can only be opened for reading");
+  }
+
+  if (!file()->is_open()) {
+    file()->open(m);
+  }
+
+  m_row_group.clear();
+  m_row_group_read = false;
+  m_next_row = 0;
+  m_buffer.clear();
+  m_buffer_offset = 0;
+  m_offset = 0;
+}
+
+ssize_t Columnar_file::read(void *buffer, size_t length) {
+  const auto out = static_cast<char *>(buffer);
+  size_t total = 0;
+
+  while (total < length) {
+    if (m_buffer_offset == m_buffer.length() && !fill_buffer()) {
+      break;
+    }
+
+    const auto bytes =
+        std::min(length - total, m_buffer.length() - m_buffer_offset);
+    memcpy(out + total, m_buffer.data() + m_buffer_offset, bytes);
+
+    m_buffer_offset += bytes;
+    total += bytes;
+  }
+
+  m_offset += total;
+
+  return total;
+}
+
+const std::vector<dump::columnar::Row_group::Column> &Columnar_file::columns() {
+  static const std::vector<dump::columnar::Row_group::Column> k_no_columns;
+
+  if (!m_row_group_read && !next_row_group()) {
+    return k_no_columns;
+  }
+
+  return m_row_group.columns();
+}
+
+bool Columnar_file::next_row_group() {
+  if (!m_row_group.decode(file())) {
+    return false;
+  }
+
+  m_row_group_read = true;
+  m_next_row = 0;
+
+  if (m_columns.empty()) {
+    return true;
+  }
+
+  const auto &columns = m_row_group.columns();
+  const auto matches =
+      columns.size() == m_columns.size() &&
+      std::equal(columns.begin(), columns.end(), m_columns.begin(),
+                 [](const auto &column, const std::string &name) {
+                   return column.name == name;
+                 });
+
+  if (!matches) {
+    throw std::runtime_error(
+        "The columns stored in the file '" + file()->full_path() + "' (" +
+        shcore::str_join(columns, ", ",
+                         [](const auto &column) { return column.name; }) +
+        ") do not match the columns being loaded (" +
+        shcore::str_join(m_columns, ", ") + ").");
+  }
+
+  return true;
+}
+
+bool Columnar_file::fill_buffer() {
+  m_buffer.clear();
+  m_buffer_offset = 0;
+
+  while (m_next_row >= m_row_group.rows()) {
+    if (!next_row_group()) {
+      return false;
+    }
+  }
+
+  const auto columns = m_row_group.columns().size();
+
+  // convert rows in batches, row group can be quite large
+  while (m_next_row < m_row_group.rows() && m_buffer.length() < k_buffer_size) {
+    for (std::size_t c = 0; c < columns; ++c) {
+      if (c > 0) {
+        m_buffer += '\t';
+      }
+
+      if (m_row_group.is_null(c, m_next_row)) {
+        m_buffer += "\\N";
+      } else {
+        std::size_t length = 0;
+        const auto data = m_row_group.value(c, m_next_row, &length);
+
+        if (c < m_hex_columns.size() && m_hex_columns[c]) {
+          append_hex(data, length);
+        } else {
+          append_escaped(data, length);
+        }
+      }
+    }
+
+    m_buffer += '\n';
+    ++m_next_row;
+  }
+
+  return true;
+}
+
+void Columnar_file::append_escaped(const char *data, std::size_t length) {
+  const auto end = data + length;
+
+  while (data < end) {
+    // copy everything up to the next character which needs to be escaped
+    auto p = data;
+
+    while (p < end && '\\' != *p && '\t' != *p && '\n' != *p) {
+      ++p;
+    }
+
+    m_buffer.append(data, p - data);
+
+    if (p < end) {
+      m_buffer += '\\';
+      m_buffer += *p++;
+    }
+
+    data = p;
+  }
+}
+
+void Columnar_file::append_hex(const char *data, std::size_t length) {
+  static constexpr char k_digits[] = "0123456789ABCDEF";
+  const auto end = data + length;
+
+  for (; data < end; ++data) {
+    const auto byte = static_cast<unsigned char>(*data);
+    m_buffer += k_digits[byte >> 4];
+    m_buffer += k_digits[byte & 0x0f];
+  }
+}
+
+}  // namespace import_table
+}  // namespace mysqlsh
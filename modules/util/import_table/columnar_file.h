@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_COLUMNAR_FILE_H_
+#define MODULES_UTIL_IMPORT_TABLE_COLUMNAR_FILE_H_
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "modules/util/dump/columnar_format.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+namespace mysqlsh {
+namespace import_table {
+
+/**
+ * Read-only view of a file in the columnar format, rows are returned as text
+ * in the default dialect, so they can be passed to LOAD DATA.
+ *
+ * Binary values are stored as they are, columns marked in hex_columns are
+ * returned HEX-encoded, these need to be decoded with UNHEX() by the server.
+ *
+ * If names of the columns are given, each row group has to hold exactly these
+ * columns, in the same order.
+ */
+class Columnar_file : public mysqlshdk::storage::Compressed_file {
+ public:
+  Columnar_file() = delete;
+
+  explicit Columnar_file(std::unique_ptr<mysqlshdk::storage::IFile> file,
+                         std::vector<bool> hex_columns = {},
+                         std::vector<std::string> columns = {});
+
+  Columnar_file(const Columnar_file &other) = delete;
+  Columnar_file(Columnar_file &&other) = default;
+
+  Columnar_file &operator=(const Columnar_file &other) = delete;
+  Columnar_file &operator=(Columnar_file &&other) = default;
+
+  ~Columnar_file() override = default;
+
+  void open(mysqlshdk::storage::Mode m) override;
+
+  off64_t seek(off64_t) override {
+    throw std::logic_error("Columnar_file::seek() - not supported");
+  }
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override;
+
+  ssize_t write(const void *, size_t) override {
+    throw std::logic_error("Columnar_file::write() - not supported");
+  }
+
+  /**
+   * Names and types of the columns stored in the file, as held by the first
+   * row group. File has to be open, empty file does not hold any columns.
+   */
+  const std::vector<dump::columnar::Row_group::Column> &columns();
+
+ private:
+  bool next_row_group();
+
+  bool fill_buffer();
+
+  void append_escaped(const char *data, std::size_t length);
+
+  void append_hex(const char *data, std::size_t length);
+
+  std::vector<bool> m_hex_columns;
+  std::vector<std::string> m_columns;
+
+  dump::columnar::Row_group m_row_group;
+  bool m_row_group_read = false;
+  uint32_t m_next_row = 0;
+
+  std::string m_buffer;
+  std::size_t m_buffer_offset = 0;
+
+  off64_t m_offset = 0;
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_COLUMNAR_FILE_H_
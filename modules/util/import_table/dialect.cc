@@ -39,7 +39,8 @@ bool Dialect::operator==(const Dialect &d) const {
          fields_terminated_by == d.fields_terminated_by &&
          fields_enclosed_by == d.fields_enclosed_by &&
          fields_optionally_enclosed == d.fields_optionally_enclosed &&
-         lines_starting_by == d.lines_starting_by;
+         lines_starting_by == d.lines_starting_by &&
+         columnar_format == d.columnar_format;
 }
 
 void Dialect::validate() const {
@@ -118,6 +119,12 @@ Dialect Dialect::csv_unix() {
   return dialect;
 }
 
+Dialect Dialect::columnar() {
+  Dialect dialect;
+  dialect.columnar_format = true;
+  return dialect;
+}
+
 std::string Dialect::build_sql() {
   using sqlstring = shcore::sqlstring;
   std::string sql =
@@ -154,9 +161,12 @@ Dialect Dialect::unpack(shcore::Option_unpacker *unpacker) {
     dialect = json();
   } else if (shcore::str_casecmp(name, "csv-unix") == 0) {
     dialect = csv_unix();
+  } else if (shcore::str_casecmp(name, "columnar") == 0) {
+    dialect = columnar();
   } else {
     throw shcore::Exception::argument_error(
-        "dialect value must be default, csv, tsv, json or csv-unix.");
+        "dialect value must be default, csv, tsv, json, csv-unix or "
+        "columnar.");
   }
 
   unpacker->optional("fieldsTerminatedBy", &dialect.fields_terminated_by)
@@ -172,6 +182,13 @@ Dialect Dialect::unpack(shcore::Option_unpacker *unpacker) {
     dialect.lines_terminated_by = dialect.fields_terminated_by;
   }
 
+  if (dialect.columnar_format && !(columnar() == dialect)) {
+    throw shcore::Exception::argument_error(
+        "The fieldsTerminatedBy, fieldsEnclosedBy, fieldsOptionallyEnclosed, "
+        "fieldsEscapedBy and linesTerminatedBy options cannot be used with the "
+        "columnar dialect.");
+  }
+
   return dialect;
 }
 
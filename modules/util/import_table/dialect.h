@@ -45,6 +45,9 @@ struct Dialect {
   std::string fields_enclosed_by{};        // char
   bool fields_optionally_enclosed = false;
   std::string lines_starting_by{""};  // string
+  // rows are stored in the columnar format, LOAD DATA receives them in the
+  // default dialect
+  bool columnar_format = false;
 
   bool operator==(const Dialect &d) const;
 
@@ -89,6 +92,12 @@ struct Dialect {
    */
   static Dialect csv_unix();
 
+  /**
+   * Returns dialect which describes files in the columnar format, these are
+   * converted to the default dialect when loaded.
+   */
+  static Dialect columnar();
+
   /**
    * Returns dialect described by the options.
    */
@@ -189,8 +189,9 @@ void Import_table::import() {
   } else {
     const std::string &path = m_opt.filelist_from_user()[0];
     const auto extension = std::get<1>(shcore::path::split_extension(path));
-    if (extension == ".gz" || extension == ".zst") {
-      // cannot chunk compressed files
+    if (extension == ".gz" || extension == ".zst" ||
+        m_opt.dialect().columnar_format) {
+      // cannot chunk compressed files or files in the columnar format
       build_queue();
     } else {
       chunk_file();
@@ -26,10 +26,12 @@
 #include <errno.h>
 #include <algorithm>
 #include <limits>
+#include <set>
 #include <stack>
 #include <utility>
 
 #include "modules/mod_utils.h"
+#include "modules/util/import_table/columnar_file.h"
 #include "modules/util/import_table/helpers.h"
 #include "mysqlshdk/include/scripting/types.h"
 #include "mysqlshdk/include/shellcore/base_session.h"
@@ -39,10 +41,15 @@
 #include "mysqlshdk/libs/oci/oci_options.h"
 #include "mysqlshdk/libs/storage/backend/oci_object_storage.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/natural_compare.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace {
 template <typename FwdIter>
@@ -196,6 +203,11 @@ void Import_table_options::validate() {
       m_file_handle->close();
     }
   }
+
+  if (m_dialect.columnar_format) {
+    prepare_columnar_columns();
+  }
+
   m_threads_size = calc_thread_size();
 }
 
@@ -235,14 +247,161 @@ Import_table_options::create_file_handle(
   } catch (...) {
     compr = mysqlshdk::storage::Compression::NONE;
   }
-  return mysqlshdk::storage::make_file(std::move(file_handler), compr);
+  auto file = mysqlshdk::storage::make_file(std::move(file_handler), compr);
+
+  if (m_dialect.columnar_format) {
+    file = std::make_unique<Columnar_file>(std::move(file), m_hex_columns,
+                                           m_columnar_columns);
+  }
+
+  return file;
+}
+
+void Import_table_options::prepare_columnar_columns() {
+  // Binary values are stored as they are, they cannot be passed as text in the
+  // character set of the session, reader encodes them with HEX() and server
+  // decodes them with UNHEX().
+  const auto result = m_base_session->queryf(
+      "SELECT COLUMN_NAME, DATA_TYPE FROM information_schema.columns WHERE "
+      "TABLE_SCHEMA = ? AND TABLE_NAME = ? AND EXTRA <> 'VIRTUAL GENERATED' "
+      "AND EXTRA <> 'STORED GENERATED' ORDER BY ORDINAL_POSITION",
+      m_schema, m_table);
+  std::set<std::string> names;
+  std::set<std::string> binary;
+
+  while (const auto row = result->fetch_one()) {
+    const auto name = row->get_string(0);
+
+    if (shcore::str_iendswith(row->get_string(1), "binary", "bit", "blob",
+                              "geometry", "geomcollection",
+                              "geometrycollection", "linestring", "point",
+                              "polygon")) {
+      binary.emplace(name);
+    }
+
+    names.emplace(name);
+  }
+
+  // user-defined transformations receive the values as they are
+  const auto is_hex = [this](const std::string &column, bool is_binary) {
+    const auto hex = is_binary && m_decode_columns.end() ==
+                                      m_decode_columns.find(column);
+
+    if (hex) {
+      m_decode_columns[column] = "UNHEX";
+    }
+
+    return hex;
+  };
+
+  m_hex_columns.clear();
+  m_columnar_columns.clear();
+
+  if (m_columns) {
+    // values are assigned to the given columns by their position
+    for (const auto &column : *m_columns) {
+      m_hex_columns.emplace_back(
+          shcore::Value_type::String == column.type &&
+          is_hex(column.as_string(), binary.count(column.as_string()) > 0));
+    }
+
+    return;
+  }
+
+  // values are loaded into the columns stored in the file, all files have to
+  // hold the same columns, this is checked when they are read
+  const auto file = first_file();
+
+  if (!file) {
+    return;
+  }
+
+  const auto table = shcore::quote_identifier(m_schema) + "." +
+                     shcore::quote_identifier(m_table);
+
+  const auto columnar = static_cast<Columnar_file *>(file.get());
+
+  columnar->open(mysqlshdk::storage::Mode::READ);
+  shcore::on_leave_scope close_file([columnar]() { columnar->close(); });
+
+  for (const auto &column : columnar->columns()) {
+    if (0 == names.count(column.name)) {
+      throw std::runtime_error("The column '" + column.name +
+                               "' stored in the file '" + file->full_path() +
+                               "' does not exist in the target table " +
+                               table + ".");
+    }
+
+    if (column.binary != (binary.count(column.name) > 0)) {
+      throw std::runtime_error(
+          "The column '" + column.name + "' stored in the file '" +
+          file->full_path() + "' holds " +
+          (column.binary ? "binary data" : "text") +
+          ", but it has a " + (column.binary ? "non-binary" : "binary") +
+          " type in the target table " + table + ".");
+    }
+
+    m_columnar_columns.emplace_back(column.name);
+    m_hex_columns.emplace_back(is_hex(column.name, column.binary));
+  }
+
+  if (!m_columnar_columns.empty()) {
+    m_columns = shcore::make_array();
+
+    for (const auto &column : m_columnar_columns) {
+      m_columns->emplace_back(column);
+    }
+  }
+}
+
+std::unique_ptr<mysqlshdk::storage::IFile> Import_table_options::first_file()
+    const {
+  for (const auto &item : m_filelist_from_user) {
+    std::unique_ptr<mysqlshdk::storage::IFile> file;
+
+    if (has_wildcard(item)) {
+      const auto glob = mysqlshdk::storage::make_file(item, m_oci_options);
+      const auto dir = mysqlshdk::storage::make_directory(
+          glob->parent()->full_path(), m_oci_options);
+
+      if (!dir->exists()) {
+        continue;
+      }
+
+      const auto files = dir->filter_files(shcore::path::basename(item));
+
+      if (files.empty()) {
+        continue;
+      }
+
+      const auto first = std::min_element(
+          files.begin(), files.end(), [](const auto &lhs, const auto &rhs) {
+            return shcore::natural_compare(lhs.name.begin(), lhs.name.end(),
+                                           rhs.name.begin(), rhs.name.end());
+          });
+      file = dir->file(first->name);
+    } else {
+      file = mysqlshdk::storage::make_file(item, m_oci_options);
+
+      if (!file->exists()) {
+        continue;
+      }
+    }
+
+    return create_file_handle(std::move(file));
+  }
+
+  return nullptr;
 }
 
 size_t Import_table_options::calc_thread_size() {
   // We need at least one thread
   int64_t threads_size = std::max(static_cast<int64_t>(1), m_threads_size);
 
-  if (!is_multifile()) {
+  if (!is_multifile() && m_dialect.columnar_format) {
+    // files in the columnar format are not chunked
+    threads_size = 1;
+  } else if (!is_multifile()) {
     // We do not need to spawn more threads than file chunks
     const size_t calculated_threads = (m_file_size / bytes_per_chunk()) + 1;
     if (calculated_threads <
@@ -319,6 +478,7 @@ void Import_table_options::unpack(const shcore::Dictionary_t &options) {
 
   m_dialect = Dialect::unpack(&unpack_options);
   shcore::Dictionary_t decode_columns = nullptr;
+  std::string max_total_rate;
 
   unpack_options.optional("table", &m_table)
       .optional("schema", &m_schema)
@@ -326,10 +486,12 @@ void Import_table_options::unpack(const shcore::Dictionary_t &options) {
       .optional("columns", &m_columns)
       .optional("replaceDuplicates", &m_replace_duplicates)
       .optional("maxRate", &m_max_rate)
+      .optional("maxTotalRate", &max_total_rate)
       .optional("showProgress", &m_show_progress)
       .optional("skipRows", &m_skip_rows_count)
       .optional("decodeColumns", &decode_columns)
-      .optional("characterSet", &m_character_set);
+      .optional("characterSet", &m_character_set)
+      .optional("useServerSideFiles", &m_use_server_side_files);
 
   if (!is_multifile()) {
     unpack_options.optional("bytesPerChunk", &m_bytes_per_chunk);
@@ -337,6 +499,15 @@ void Import_table_options::unpack(const shcore::Dictionary_t &options) {
 
   unpack_options.end();
 
+  if (!max_total_rate.empty()) {
+    const auto limit = mysqlshdk::utils::expand_to_bytes(max_total_rate);
+
+    if (limit > 0) {
+      m_total_rate_limit =
+          std::make_shared<mysqlshdk::utils::Shared_rate_limit>(limit);
+    }
+  }
+
   if (decode_columns) {
     for (const auto &it : *decode_columns) {
       if (it.second.type != shcore::Null) {
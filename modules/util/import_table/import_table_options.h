@@ -39,6 +39,7 @@
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/oci/oci_options.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/utils/rate_limit.h"
 
 namespace mysqlsh {
 namespace import_table {
@@ -82,10 +83,27 @@ class Import_table_options {
 
   size_t max_rate() const;
 
+  /**
+   * Returns the rate limiter shared by all threads, nullptr if throughput is
+   * not limited.
+   */
+  mysqlshdk::utils::Shared_rate_limit *total_rate_limit() const {
+    return m_total_rate_limit.get();
+  }
+
+  void set_total_rate_limit(
+      const std::shared_ptr<mysqlshdk::utils::Shared_rate_limit> &limit) {
+    m_total_rate_limit = limit;
+  }
+
   bool replace_duplicates() const { return m_replace_duplicates; }
 
   void set_replace_duplicates(bool flag) { m_replace_duplicates = flag; }
 
+  bool use_server_side_files() const { return m_use_server_side_files; }
+
+  void set_use_server_side_files(bool flag) { m_use_server_side_files = flag; }
+
   const shcore::Array_t &columns() const { return m_columns; }
 
   const std::map<std::string, std::string> &decode_columns() const {
@@ -131,6 +149,10 @@ class Import_table_options {
 
   size_t calc_thread_size();
 
+  void prepare_columnar_columns();
+
+  std::unique_ptr<mysqlshdk::storage::IFile> first_file() const;
+
   std::vector<std::string> m_filelist_from_user;
   std::string m_full_path;
   size_t m_file_size;
@@ -141,8 +163,12 @@ class Import_table_options {
   std::string m_bytes_per_chunk{"50M"};
   shcore::Array_t m_columns;
   std::map<std::string, std::string> m_decode_columns;
+  std::vector<bool> m_hex_columns;
+  std::vector<std::string> m_columnar_columns;
   bool m_replace_duplicates = false;
+  bool m_use_server_side_files = false;
   std::string m_max_rate;
+  std::shared_ptr<mysqlshdk::utils::Shared_rate_limit> m_total_rate_limit;
   bool m_show_progress = isatty(fileno(stdout)) ? true : false;
   uint64_t m_skip_rows_count = 0;
   Dialect m_dialect;
@@ -38,6 +38,7 @@ using off64_t = off_t;
 #endif
 
 #include <mysql.h>
+#include <mysqld_error.h>
 #include <algorithm>
 #include <memory>
 #include <utility>
@@ -45,7 +46,9 @@ using off64_t = off_t;
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/mysql/utils.h"
 #include "mysqlshdk/libs/rest/error.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -358,6 +361,10 @@ int local_infile_read(void *userdata, char *buffer,
     file_info->rate_limit.throttle(bytes);
   }
 
+  if (file_info->total_rate_limit) {
+    file_info->total_rate_limit->throttle(bytes);
+  }
+
   if (*file_info->user_interrupt) {
     return -1;
   }
@@ -452,6 +459,24 @@ void Load_data_worker::operator()() {
   execute(session, nullptr);
 }
 
+bool Load_data_worker::can_load_server_side(
+    const File_info &fi, size_t max_trx_size,
+    const Server_side_files &state) const {
+  // server reads the whole file at once, it cannot be throttled, split into
+  // transactions or read partially, it also needs to be uncompressed
+  if (max_trx_size > 0 || fi.range_read || fi.max_rate > 0 ||
+      fi.total_rate_limit || fi.filehandler->is_compressed()) {
+    return false;
+  }
+
+  if (!fi.filehandler->parent()->is_local()) {
+    return false;
+  }
+
+  return shcore::str_beginswith(fi.filehandler->full_path(),
+                                state.secure_file_priv);
+}
+
 void Load_data_worker::execute(
     const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
     std::unique_ptr<mysqlshdk::storage::IFile> file, size_t max_trx_size,
@@ -464,6 +489,7 @@ void Load_data_worker::execute(
     fi.prog_mutex = &m_output_mutex;
     fi.user_interrupt = &m_interrupt;
     fi.max_rate = m_opt.max_rate();
+    fi.total_rate_limit = m_opt.total_rate_limit();
 
     // clear the SQL mode
     session->execute("SET SQL_MODE = '';");
@@ -568,6 +594,15 @@ void Load_data_worker::execute(
     snprintf(worker_name, sizeof(worker_name), "[Worker%03u] ",
              static_cast<unsigned int>(m_thread_id));
 
+    auto &server_side_files = this->server_side_files();
+
+    if (m_opt.use_server_side_files() && !server_side_files.checked) {
+      server_side_files.available =
+          mysqlshdk::mysql::server_side_files_available(
+              session, &server_side_files.secure_file_priv);
+      server_side_files.checked = true;
+    }
+
     uint64_t subchunk = 0;
     while (true) {
       ++subchunk;
@@ -620,17 +655,65 @@ void Load_data_worker::execute(
 
       const std::string task = fi.filehandler->filename();
       std::shared_ptr<mysqlshdk::db::IResult> load_result = nullptr;
-      const std::string query_prefix = shcore::sqlformat(
-          "LOAD DATA LOCAL INFILE ? ", fi.filehandler->full_path());
-      const std::string full_query = query_prefix + query_body;
+      bool server_side =
+          m_opt.use_server_side_files() && server_side_files.available &&
+          can_load_server_side(fi, max_trx_size, server_side_files);
+      std::string full_query;
+
+      try {
+        if (server_side) {
+          // the file is read directly by the server, there's no need to send
+          // it through this connection; LOCAL implies IGNORE, it's added here
+          // so that errors are handled in the same way
+          full_query = shcore::sqlformat("LOAD DATA INFILE ? ",
+                                         fi.filehandler->full_path()) +
+                       (m_opt.replace_duplicates() ? "" : "IGNORE ") +
+                       query_body;
 
 #ifndef NDEBUG
-      log_debug("%s %s %i", worker_name, full_query.c_str(),
-                m_range_queue != nullptr);
+          log_debug("%s %s", worker_name, full_query.c_str());
 #endif
 
-      try {
-        load_result = session->query(m_query_comment + full_query);
+          try {
+            load_result = session->query(m_query_comment + full_query);
+
+            fi.bytes = fi.filehandler->file_size();
+            m_prog_sent_bytes += fi.bytes;
+            local_infile_end(&fi);
+          } catch (const mysqlshdk::db::Error &e) {
+            // the statement fails before any data is loaded if the server is
+            // not able to read the file, use LOCAL for this and the remaining
+            // files, including the ones loaded later using this session
+            if (e.code() == ER_ACCESS_DENIED_ERROR ||
+                e.code() == ER_SPECIFIC_ACCESS_DENIED_ERROR ||
+                e.code() == ER_OPTION_PREVENTS_STATEMENT ||
+                e.code() == ER_FILE_NOT_FOUND ||
+                e.code() == ER_TEXTFILE_NOT_READABLE) {
+              log_info("%sServer is unable to read %s, falling back to LOAD "
+                       "DATA LOCAL: %s",
+                       worker_name, fi.filehandler->full_path().c_str(),
+                       e.format().c_str());
+              server_side_files.available = false;
+              server_side = false;
+            } else {
+              throw;
+            }
+          }
+        }
+
+        if (!server_side) {
+          full_query = shcore::sqlformat("LOAD DATA LOCAL INFILE ? ",
+                                         fi.filehandler->full_path()) +
+                       query_body;
+
+#ifndef NDEBUG
+          log_debug("%s %s %i", worker_name, full_query.c_str(),
+                    m_range_queue != nullptr);
+#endif
+
+          load_result = session->query(m_query_comment + full_query);
+        }
+
         fi.buffer.flush_done(&has_more_data);
         m_stats.total_bytes += fi.bytes;
         ++m_stats.total_files_processed;
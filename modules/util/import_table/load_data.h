@@ -97,6 +97,8 @@ class Transaction_buffer {
 struct File_info {
   mysqlshdk::utils::Rate_limit rate_limit{};  //< Rate limiter
   int64_t max_rate = 0;    //< Max rate value for rate limiter
+  mysqlshdk::utils::Shared_rate_limit *total_rate_limit =
+      nullptr;             //< Rate limiter shared by all threads
   int64_t worker_id = -1;  //< Thread worker id
   std::string filename;    //< Import data filename path
   std::unique_ptr<mysqlshdk::storage::IFile> filehandler = nullptr;
@@ -126,6 +128,18 @@ void local_infile_end(void *userdata) noexcept;
 int local_infile_error(void *userdata, char *error_msg,
                        unsigned int error_msg_len) noexcept;
 
+/**
+ * Whether the server is able to read the local files, checked once per
+ * session.
+ */
+struct Server_side_files {
+  bool checked = false;
+  bool available = false;
+  // directory from which the server is allowed to read files, empty if any
+  // directory is allowed
+  std::string secure_file_priv;
+};
+
 class Load_data_worker final {
  public:
   Load_data_worker() = delete;
@@ -146,12 +160,32 @@ class Load_data_worker final {
   ~Load_data_worker() = default;
 
   void operator()();
+
+  /**
+   * Uses the given state of server-side files instead of checking it again,
+   * needs to be reset if session changes.
+   */
+  void set_server_side_files(Server_side_files *state) {
+    m_server_side_files = state;
+  }
+
   void execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
                std::unique_ptr<mysqlshdk::storage::IFile> file,
                size_t max_trx_size = 0,
                const std::vector<uint64_t> *offsets = nullptr);
 
  private:
+  /**
+   * Checks if the given file can be loaded using non-LOCAL LOAD DATA.
+   */
+  bool can_load_server_side(const File_info &fi, size_t max_trx_size,
+                            const Server_side_files &state) const;
+
+  Server_side_files &server_side_files() {
+    return m_server_side_files ? *m_server_side_files
+                               : m_own_server_side_files;
+  }
+
   const Import_table_options &m_opt;
   int64_t m_thread_id;
   mysqlshdk::textui::IProgress *m_progress;
@@ -162,6 +196,8 @@ class Load_data_worker final {
   std::vector<std::exception_ptr> &m_thread_exception;
   Stats &m_stats;
   std::string m_query_comment;
+  Server_side_files m_own_server_side_files;
+  Server_side_files *m_server_side_files = nullptr;
 };
 
 }  // namespace import_table
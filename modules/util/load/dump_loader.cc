@@ -24,6 +24,8 @@
 #include "modules/util/load/dump_loader.h"
 #include <mysqld_error.h>
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -38,6 +40,7 @@
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/mysql/gtid_set.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/mysql/script.h"
 #include "mysqlshdk/libs/mysql/utils.h"
@@ -61,6 +64,14 @@ static constexpr const int k_mysql_server_net_read_timeout = 30 * 60;
 // meanwhile so this needs to be high
 static constexpr const int k_mysql_server_wait_timeout = 365 * 24 * 60 * 60;
 
+// initial number of active workers if number of threads is chosen
+// automatically
+static constexpr const std::size_t k_auto_initial_threads = 4;
+
+// how often load statistics are sampled if number of threads is chosen
+// automatically
+static constexpr const auto k_auto_threads_interval = std::chrono::seconds(10);
+
 // the version of the dump we support in this code
 static constexpr const int k_supported_dump_version_major = 1;
 static constexpr const int k_supported_dump_version_minor = 0;
@@ -69,6 +80,17 @@ static constexpr const int k_supported_dump_version_minor = 0;
 // before we enable sub-chunking for it.
 static constexpr const auto k_chunk_size_overshoot_tolerance = 1.5;
 
+// default value of innodb_ddl_threads, index builds are given more threads
+// only if there's enough of them to go around
+static constexpr const int64_t k_default_innodb_ddl_threads = 4;
+
+// maximum value of innodb_ddl_threads
+static constexpr const int64_t k_max_innodb_ddl_threads = 64;
+
+// value of innodb_log_buffer_size used during fast ingest
+static constexpr const uint64_t k_fast_ingest_innodb_log_buffer_size =
+    256 * 1024 * 1024;
+
 class dump_wait_timeout : public std::runtime_error {
  public:
   explicit dump_wait_timeout(const char *w) : std::runtime_error(w) {}
@@ -368,10 +390,6 @@ void Dump_loader::Worker::Table_ddl_task::extract_pending_indexes(
       if (!loader->m_options.force()) throw;
     }
   }
-
-  const auto prefix = "ALTER TABLE " + key + " ADD ";
-  for (size_t i = 0; i < m_deferred_indexes->size(); ++i)
-    (*m_deferred_indexes)[i] = prefix + (*m_deferred_indexes)[i] + ";";
 }
 
 void Dump_loader::Worker::Table_ddl_task::load_ddl(
@@ -393,6 +411,11 @@ void Dump_loader::Worker::Table_ddl_task::load_ddl(
                                 ? " (indexes removed for deferred creation)"
                                 : ""))));
       if (!loader->m_options.dry_run()) {
+        if (m_replace) {
+          // table has changed since the base dump, it's going to be reloaded
+          session->execute("DROP TABLE IF EXISTS " + key);
+        }
+
         // execute sql
         execute_script(
             session, script,
@@ -449,7 +472,7 @@ bool Dump_loader::Worker::Load_chunk_task::execute(
   try {
     if (!loader->m_options.dry_run()) {
       // load the data
-      load(session, loader);
+      load(session, worker, loader);
     }
   } catch (const std::exception &e) {
     handle_current_exception(
@@ -478,13 +501,17 @@ std::string Dump_loader::Worker::Load_chunk_task::query_comment() const {
 
 void Dump_loader::Worker::Load_chunk_task::load(
     const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
-    Dump_loader *loader) {
+    Worker *worker, Dump_loader *loader) {
   import_table::Import_table_options import_options(m_options);
 
   // replace duplicate rows by default
   import_options.set_replace_duplicates(true);
 
+  import_options.set_use_server_side_files(
+      loader->m_options.use_server_side_files());
+
   import_options.base_session(session);
+  import_options.set_total_rate_limit(loader->m_total_rate_limit);
 
   import_table::Stats stats;
   if (m_resume) {
@@ -503,6 +530,7 @@ void Dump_loader::Worker::Load_chunk_task::load(
       import_options, id(), loader->m_progress.get(), &loader->m_output_mutex,
       &loader->m_num_bytes_loaded, &loader->m_worker_hard_interrupt, nullptr,
       &loader->m_thread_exceptions, &stats, query_comment());
+  op.set_server_side_files(&worker->m_server_side_files);
 
   loader->m_num_threads_loading++;
   loader->update_progress();
@@ -643,6 +671,31 @@ bool Dump_loader::Worker::Analyze_table_task::execute(
   return true;
 }
 
+std::vector<std::string> Dump_loader::alter_table_for_indexes(
+    const std::string &key, const std::vector<std::string> &indexes) {
+  std::vector<std::string> result;
+  std::string regular;
+
+  for (const auto &definition : indexes) {
+    mysqlshdk::utils::SQL_iterator it(definition);
+    const auto token = it.get_next_token();
+    const auto add = " ADD " + definition;
+
+    if (shcore::str_caseeq_mv(token, "FULLTEXT", "SPATIAL")) {
+      result.emplace_back("ALTER TABLE " + key + add + ";");
+    } else {
+      if (!regular.empty()) regular += ",";
+      regular += add;
+    }
+  }
+
+  if (!regular.empty()) {
+    result.emplace(result.begin(), "ALTER TABLE " + key + regular + ";");
+  }
+
+  return result;
+}
+
 bool Dump_loader::Worker::Index_recreation_task::execute(
     const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
     Worker *worker, Dump_loader *loader) {
@@ -651,7 +704,7 @@ bool Dump_loader::Worker::Index_recreation_task::execute(
 
   auto console = current_console();
 
-  if (!m_queries.empty())
+  if (!m_indexes.empty())
     console->print_status(
         shcore::str_format("[Worker%03zu] Recreating indexes for `%s`.`%s`",
                            id(), schema().c_str(), table().c_str()));
@@ -659,17 +712,45 @@ bool Dump_loader::Worker::Index_recreation_task::execute(
   loader->post_worker_event(worker, Worker_event::INDEX_START);
 
   // do work
-  if (!loader->m_options.dry_run()) {
-    loader->m_num_threads_recreating_indexes++;
+  if (!loader->m_options.dry_run() && !m_indexes.empty()) {
+    const auto threads_recreating_indexes =
+        ++loader->m_num_threads_recreating_indexes;
     loader->update_progress();
     shcore::on_leave_scope cleanup(
         [loader]() { loader->m_num_threads_recreating_indexes--; });
 
+    if (loader->m_options.target_server_version() >=
+        mysqlshdk::utils::Version(8, 0, 27)) {
+      // give more threads to the index builds if only a few of them are
+      // running concurrently, i.e. near the end of the load
+      const auto ddl_threads = std::min(
+          k_max_innodb_ddl_threads,
+          loader->m_options.threads_count() /
+              static_cast<int64_t>(std::max<size_t>(
+                  1, threads_recreating_indexes)));
+
+      try {
+        if (ddl_threads > k_default_innodb_ddl_threads) {
+          session->executef("SET SESSION innodb_ddl_threads = ?",
+                            ddl_threads);
+        } else {
+          session->execute("SET SESSION innodb_ddl_threads = DEFAULT");
+        }
+      } catch (const shcore::Error &e) {
+        log_info("Unable to set innodb_ddl_threads: %s", e.format().c_str());
+      }
+    }
+
+    const auto key = schema_table_key(schema(), table());
+    auto queries = alter_table_for_indexes(key, m_indexes);
+    bool combined = queries.size() < m_indexes.size();
+    const auto start_time = std::chrono::steady_clock::now();
+
     try {
-      for (size_t i = 0; i < m_queries.size(); i++) {
+      for (size_t i = 0; i < queries.size(); i++) {
         int retries = 0;
         try {
-          session->execute(m_queries[i]);
+          session->execute(queries[i]);
         } catch (const shcore::Error &e) {
           // Deadlocks and duplicate key errors should not happen but if they
           // do they can be ignored at least for a while
@@ -680,9 +761,21 @@ bool Dump_loader::Worker::Index_recreation_task::execute(
                 " seconds");
             shcore::sleep_ms(retries * 1000);
             --i;
+          } else if (e.code() == ER_DUP_KEYNAME && combined && 0 == i) {
+            // some of the indexes already exist, the combined statement was
+            // not applied, add the indexes one by one
+            log_info("Recreating indexes of %s one by one: %s", key.c_str(),
+                     e.format().c_str());
+            queries.clear();
+            for (const auto &index : m_indexes) {
+              queries.emplace_back("ALTER TABLE " + key + " ADD " + index +
+                                   ";");
+            }
+            combined = false;
+            --i;
           } else if (e.code() == ER_DUP_KEYNAME) {
             console->print_note("Index already existed for query: " +
-                                m_queries[i]);
+                                queries[i]);
           } else {
             throw;
           }
@@ -695,6 +788,13 @@ bool Dump_loader::Worker::Index_recreation_task::execute(
                              schema().c_str(), table().c_str(), e.what()));
       return false;
     }
+
+    loader->m_index_build_time_ms +=
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_time)
+            .count();
+    loader->m_num_indexes_recreated += m_indexes.size();
+    ++loader->m_num_tables_with_indexes_recreated;
   }
 
   log_debug("worker%zu done", id());
@@ -742,20 +842,22 @@ void Dump_loader::Worker::stop() { m_work_ready.push(false); }
 void Dump_loader::Worker::connect() {
   m_session = m_owner->create_session();
   m_connection_id = m_session->get_connection_id();
+  m_server_side_files = {};
 }
 
 void Dump_loader::Worker::process_table_ddl(
     const std::string &schema, const std::string &table,
     std::unique_ptr<mysqlshdk::storage::IFile> file, bool is_placeholder,
-    Load_progress_log::Status status) {
+    Load_progress_log::Status status, bool replace) {
   log_debug("Processing table DDL for `%s`.`%s` (placeholder=%i)",
             schema.c_str(), table.c_str(), is_placeholder ? 1 : 0);
   assert(!schema.empty());
   assert(!table.empty());
   assert(file);
 
-  m_task = std::make_unique<Table_ddl_task>(
-      m_id, schema, table, std::move(file), is_placeholder, status);
+  m_task = std::make_unique<Table_ddl_task>(m_id, schema, table,
+                                            std::move(file), is_placeholder,
+                                            status, replace);
 
   m_work_ready.push(true);
 }
@@ -836,7 +938,10 @@ Dump_loader::Dump_loader(const Load_dump_options &options)
       m_num_raw_bytes_loaded(0),
       m_num_chunks_loaded(0),
       m_num_warnings(0),
-      m_num_errors(0) {
+      m_num_errors(0),
+      m_num_indexes_recreated(0),
+      m_num_tables_with_indexes_recreated(0),
+      m_index_build_time_ms(0) {
   bool use_json = (mysqlsh::current_shell_options()->get().wrap_json != "off");
 
   if (m_options.show_progress()) {
@@ -851,6 +956,11 @@ Dump_loader::Dump_loader(const Load_dump_options &options)
 
   m_progress->hide(true);
 
+  if (m_options.max_total_rate() > 0) {
+    m_total_rate_limit = std::make_shared<mysqlshdk::utils::Shared_rate_limit>(
+        m_options.max_total_rate());
+  }
+
   if (m_options.ignore_version()) {
     m_default_sql_transforms.add_strip_removed_sql_modes();
   }
@@ -1286,7 +1396,10 @@ size_t Dump_loader::handle_worker_events(
   };
 
   std::list<Worker *> idle_workers;
-  while (idle_workers.size() < m_workers.size()) {
+  // workers which are ready, but exceed the number of active workers
+  std::list<Worker *> parked_workers;
+
+  while (idle_workers.size() + parked_workers.size() < m_workers.size()) {
     Worker_event event;
 
     // Wait for events from workers, but update progress and check for ^C
@@ -1294,6 +1407,15 @@ size_t Dump_loader::handle_worker_events(
     for (;;) {
       update_progress();
 
+      if (adjust_active_workers()) {
+        // more workers are allowed to run, wake them up
+        for (auto *worker : parked_workers) {
+          m_worker_events.push({Worker_event::READY, worker});
+        }
+
+        parked_workers.clear();
+      }
+
       event = m_worker_events.try_pop(1000);
       if (event.worker) break;
     }
@@ -1317,6 +1439,16 @@ size_t Dump_loader::handle_worker_events(
         on_chunk_load_end(task->schema(), task->table(), task->chunk_index(),
                           task->bytes_loaded, task->raw_bytes_loaded);
 
+        if (m_options.max_threads_per_table() > 0) {
+          // idle workers may have been unable to get a chunk because of the
+          // per-table limit, this worker has freed a slot, wake them up
+          for (auto *worker : idle_workers) {
+            m_worker_events.push({Worker_event::READY, worker});
+          }
+
+          idle_workers.clear();
+        }
+
         event.event = Worker_event::READY;
         break;
       }
@@ -1388,19 +1520,34 @@ size_t Dump_loader::handle_worker_events(
 
     // schedule more work if the worker became free
     if (event.event == Worker_event::READY) {
-      // no more work to do
-      if (m_worker_interrupt || !schedule_next(event.worker)) {
+      m_busy_workers.erase(event.worker->id());
+
+      if (m_worker_interrupt) {
+        idle_workers.push_back(event.worker);
+      } else if (m_thread_controller &&
+                 m_busy_workers.size() >= m_thread_controller->threads()) {
+        // too many workers are running, this one has to wait
+        parked_workers.push_back(event.worker);
+      } else if (schedule_next(event.worker)) {
+        m_busy_workers.emplace(event.worker->id());
+      } else {
+        // no more work to do
         idle_workers.push_back(event.worker);
       }
     }
   }
 
-  size_t num_idle_workers = idle_workers.size();
+  // workers are parked only if some other worker is busy, if loop has
+  // finished, then all the busy workers run out of work
+  size_t num_idle_workers = idle_workers.size() + parked_workers.size();
   // put all idle workers back into the queue, so that they can get assigned
   // new tasks if more becomes available later
   for (auto *worker : idle_workers) {
     m_worker_events.push({Worker_event::READY, worker});
   }
+  for (auto *worker : parked_workers) {
+    m_worker_events.push({Worker_event::READY, worker});
+  }
   return num_idle_workers;
 }
 
@@ -1471,11 +1618,29 @@ void Dump_loader::run() {
 
   open_dump();
 
+  if (m_options.fast_ingest() && !m_options.dry_run()) {
+    // needs to be checked before workers connect to the server
+    check_server_is_idle();
+  }
+
   spawn_workers();
   {
     shcore::on_leave_scope cleanup([this]() {
       join_workers();
 
+      if (m_fast_ingest_enabled) {
+        // load was interrupted or it has failed
+        try {
+          restore_fast_ingest();
+        } catch (const std::exception &e) {
+          current_console()->print_error(
+              std::string{"Failed to restore the original settings of the "
+                          "target server, they are going to be restored "
+                          "when load is resumed: "} +
+              e.what());
+        }
+      }
+
       m_progress->hide(true);
       m_progress->shutdown();
     });
@@ -1525,6 +1690,14 @@ void Dump_loader::show_summary() {
             m_num_bytes_loaded.load() - m_num_bytes_previously_loaded, seconds)
             .c_str()));
   }
+  if (m_num_indexes_recreated > 0) {
+    console->print_info(shcore::str_format(
+        "%zi indexes for %zi tables were recreated in %s (total time spent "
+        "by all threads)",
+        m_num_indexes_recreated.load(),
+        m_num_tables_with_indexes_recreated.load(),
+        format_seconds(m_index_build_time_ms.load() / 1000.0, false).c_str()));
+  }
   if (m_num_errors > 0) {
     console->print_info(shcore::str_format(
         "%zi errors and %zi warnings messages were reported during the load.",
@@ -1732,30 +1905,29 @@ void Dump_loader::check_server_version() {
             "used if GTID_PURGED and GTID_EXECUTED are empty, but they’re "
             "not.");
     } else {
-      const char *g = m_dump->gtid_executed().c_str();
+      using mysqlshdk::mysql::Gtid_set;
+
+      const auto result =
+          session.query("select @@global.gtid_executed, @@global.gtid_purged");
+      const auto row = result->fetch_one_or_throw();
+      const auto executed = Gtid_set::from_string(row->get_string(0));
+      const auto dumped = Gtid_set::from_string(m_dump->gtid_executed());
+
       if (m_options.update_gtid_set() ==
           Load_dump_options::Update_gtid_set::REPLACE) {
-        if (!session.queryf_one_int(
-                0, 0,
-                "select GTID_SUBTRACT(?, "
-                "GTID_SUBTRACT(@@global.gtid_executed, "
-                "@@global.gtid_purged)) = gtid_subtract(?, '')",
-                g, g))
+        const auto purged = Gtid_set::from_string(row->get_string(1));
+
+        if (dumped.intersects(Gtid_set(executed).subtract(purged)))
           throw std::runtime_error(
               "updateGtidSet:'replace' can only be used if "
               "gtid_subtract(gtid_executed,gtid_purged) "
               "on target server does not intersects with dumped gtid set.");
-        if (!session.queryf_one_int(
-                0, 0, "select GTID_SUBSET(@@global.gtid_purged, ?);", g))
+        if (!dumped.contains(purged))
           throw std::runtime_error(
               "updateGtidSet:'replace' can only be used if dumped gtid set "
               "is a superset of the current value of gtid_purged on target "
               "server");
-      } else if (!session.queryf_one_int(
-                     0, 0,
-                     "select GTID_SUBTRACT(@@global.gtid_executed, ?) = "
-                     "@@global.gtid_executed",
-                     g)) {
+      } else if (executed.intersects(dumped)) {
         throw std::runtime_error(
             "updateGtidSet:'append' can only be used if gtid_executed on "
             "target server does not intersects with dumped gtid set.");
@@ -1797,6 +1969,127 @@ void Dump_loader::check_tables_without_primary_key() {
   }
 }
 
+void Dump_loader::check_server_is_idle() {
+  {
+    // without this privilege, connections of other users are not visible
+    const mysqlshdk::mysql::Instance instance(m_options.base_session());
+    std::string user;
+    std::string host;
+
+    instance.get_current_user(&user, &host);
+
+    if (instance.get_user_privileges(user, host)
+            ->validate({"PROCESS"})
+            .has_missing_privileges()) {
+      current_console()->print_error(
+          "The 'fastIngest' option requires the PROCESS privilege, in order to "
+          "verify that the target server is not used by other clients.");
+      throw std::runtime_error("Unable to check if target server is in use");
+    }
+  }
+
+  const auto clients = m_options.base_session()
+                           ->query(
+                               "SELECT COUNT(*) FROM "
+                               "information_schema.processlist WHERE ID <> "
+                               "CONNECTION_ID() AND COMMAND <> 'Daemon'")
+                           ->fetch_one_or_throw()
+                           ->get_uint(0);
+
+  if (clients > 0) {
+    current_console()->print_error(
+        "The 'fastIngest' option can only be used if the target server is not "
+        "used by other clients, but " +
+        std::to_string(clients) + " other client connection" +
+        (clients > 1 ? "s are" : " is") + " open.");
+    throw std::runtime_error("Target server is in use");
+  }
+}
+
+void Dump_loader::setup_fast_ingest() {
+  const auto console = current_console();
+
+  if (!m_options.fast_ingest()) {
+    if (m_load_log->fast_ingest_pending() && !m_options.dry_run()) {
+      console->print_note(
+          "Previous load attempt was interrupted while fast ingest was "
+          "enabled, restoring the original settings of the target server.");
+      restore_fast_ingest();
+    }
+
+    return;
+  }
+
+  if (m_options.dry_run()) {
+    console->print_info(
+        "fastIngest enabled, InnoDB redo log would be disabled while the dump "
+        "is being loaded.");
+    return;
+  }
+
+  Load_progress_log::Fast_ingest_settings original;
+
+  if (m_load_log->fast_ingest_pending()) {
+    // server still uses the modified settings, restore the recorded ones later
+    original = m_load_log->fast_ingest_settings();
+  } else {
+    original.redo_log_enabled = shcore::str_caseeq(
+        m_session->query("SHOW GLOBAL STATUS LIKE 'Innodb_redo_log_enabled'")
+            ->fetch_one_or_throw()
+            ->get_string(1),
+        "ON");
+    original.innodb_log_buffer_size =
+        m_session->query("SELECT @@GLOBAL.innodb_log_buffer_size")
+            ->fetch_one_or_throw()
+            ->get_uint(0);
+  }
+
+  // original settings are recorded before anything is changed
+  m_load_log->start_fast_ingest(original);
+  m_fast_ingest_enabled = true;
+
+  console->print_warning(
+      "The 'fastIngest' option is enabled, InnoDB redo log is disabled until "
+      "the load finishes. Do not use the target server in the meantime. An "
+      "unexpected server stoppage while redo log is disabled may cause data "
+      "loss and instance corruption.");
+
+  try {
+    if (original.redo_log_enabled) {
+      m_session->execute("ALTER INSTANCE DISABLE INNODB REDO_LOG");
+    }
+
+    if (original.innodb_log_buffer_size <
+        k_fast_ingest_innodb_log_buffer_size) {
+      m_session->executef("SET GLOBAL innodb_log_buffer_size = ?",
+                          k_fast_ingest_innodb_log_buffer_size);
+    }
+  } catch (const mysqlshdk::db::Error &e) {
+    console->print_error("Failed to enable fast ingest: " + e.format());
+    restore_fast_ingest();
+    throw;
+  }
+}
+
+void Dump_loader::restore_fast_ingest() {
+  const auto &original = m_load_log->fast_ingest_settings();
+
+  if (original.innodb_log_buffer_size > 0) {
+    m_session->executef("SET GLOBAL innodb_log_buffer_size = ?",
+                        original.innodb_log_buffer_size);
+  }
+
+  if (original.redo_log_enabled) {
+    m_session->execute("ALTER INSTANCE ENABLE INNODB REDO_LOG");
+  }
+
+  m_load_log->end_fast_ingest();
+  m_fast_ingest_enabled = false;
+
+  current_console()->print_info(
+      "Original settings of the target server were restored.");
+}
+
 namespace {
 std::vector<std::string> fetch_names(mysqlshdk::db::IResult *result) {
   std::vector<std::string> names;
@@ -1848,6 +2141,11 @@ bool Dump_loader::report_duplicates(const std::string &what,
 void Dump_loader::check_existing_objects() {
   auto console = current_console();
 
+  if (m_dump->is_incremental()) {
+    // objects loaded from the base dump are expected to exist
+    return;
+  }
+
   console->print_status("Checking for pre-existing objects...");
 
   bool has_duplicates = false;
@@ -2063,10 +2361,17 @@ void Dump_loader::execute_table_ddl_tasks() {
         shcore::on_leave_scope pop([&]() { tables.pop_front(); });
 
         if (t.second) {
+          const auto incremental = m_dump->is_incremental();
+
+          if (incremental && !m_dump->table_replaced(schema, t.first)) {
+            // table has not changed since the base dump
+            continue;
+          }
+
           auto status = m_load_log->table_ddl_status(schema, t.first);
 
           worker->process_table_ddl(schema, t.first, std::move(t.second), false,
-                                    status);
+                                    status, incremental);
         } else {
           continue;
         }
@@ -2216,6 +2521,8 @@ void Dump_loader::execute_tasks() {
 
   setup_progress(&m_resuming);
 
+  setup_fast_ingest();
+
   // the 1st potentially slow operation, as many errors should be detected
   // before this as possible
   m_dump->rescan();
@@ -2288,6 +2595,11 @@ void Dump_loader::execute_tasks() {
 
   if (!m_worker_interrupt) {
     on_dump_end();
+
+    if (m_fast_ingest_enabled) {
+      restore_fast_ingest();
+    }
+
     m_load_log->cleanup();
   }
 
@@ -2352,6 +2664,17 @@ bool Dump_loader::wait_for_more_data() {
 }
 
 void Dump_loader::spawn_workers() {
+  if (m_options.auto_threads()) {
+    m_thread_controller = std::make_unique<Thread_count_controller>(
+        1, m_options.threads_count(), k_auto_initial_threads);
+    m_last_sample_time = std::chrono::steady_clock::now();
+
+    current_console()->print_note(shcore::str_format(
+        "Starting with %zu active threads, the number of threads is going to "
+        "be adjusted automatically.",
+        m_thread_controller->threads()));
+  }
+
   m_thread_exceptions.resize(m_options.threads_count());
 
   for (int64_t i = 0; i < m_options.threads_count(); i++) {
@@ -2380,6 +2703,140 @@ void Dump_loader::clear_worker(Worker *worker) {
   const auto wid = worker->id();
   m_worker_threads[wid].join();
   m_workers.remove_if([wid](const Worker &w) { return w.id() == wid; });
+  m_busy_workers.erase(wid);
+}
+
+bool Dump_loader::adjust_active_workers() {
+  if (!m_thread_controller) return false;
+
+  const auto now = std::chrono::steady_clock::now();
+
+  if (now - m_last_sample_time < k_auto_threads_interval) return false;
+
+  m_last_sample_time = now;
+
+  Thread_count_controller::Sample sample;
+
+  sample.time = std::chrono::duration<double>(now.time_since_epoch()).count();
+  sample.bytes_loaded = m_num_bytes_loaded;
+
+  try {
+    if (0 == m_redo_log_capacity) {
+      m_redo_log_capacity = query_redo_log_capacity();
+    }
+
+    auto result =
+        m_session->query("SHOW GLOBAL STATUS LIKE 'Innodb_rows_inserted'");
+
+    if (const auto row = result->fetch_one()) {
+      sample.rows_inserted = shcore::lexical_cast<uint64_t>(row->get_string(1));
+    }
+
+    int64_t checkpoint_age = -1;
+
+    result = m_session->query(
+        "SELECT NAME, COUNT FROM information_schema.innodb_metrics WHERE NAME "
+        "IN ('trx_rseg_history_len', 'log_lsn_checkpoint_age') AND "
+        "STATUS = 'enabled'");
+
+    while (const auto row = result->fetch_one()) {
+      const auto name = row->get_string(0);
+      const auto count = row->get_int(1);
+
+      if ("trx_rseg_history_len" == name) {
+        sample.history_list_length = count;
+      } else if (count > 0) {
+        // metric which was recently enabled may not be updated yet
+        checkpoint_age = count;
+      }
+    }
+
+    if (checkpoint_age < 0) {
+      // log_lsn_checkpoint_age is disabled by default
+      checkpoint_age = query_checkpoint_age();
+    }
+
+    if (checkpoint_age >= 0 && m_redo_log_capacity > 0) {
+      sample.checkpoint_age =
+          static_cast<double>(checkpoint_age) / m_redo_log_capacity;
+    } else if (!m_checkpoint_age_unavailable) {
+      m_checkpoint_age_unavailable = true;
+      log_info(
+          "Checkpoint age of the redo log is not available, it is not going "
+          "to be used to adjust the number of threads");
+    }
+  } catch (const std::exception &e) {
+    log_warning("Failed to sample the server load statistics: %s", e.what());
+  }
+
+  const auto previous = m_thread_controller->threads();
+
+  if (!m_thread_controller->update(sample)) return false;
+
+  log_info("%s", m_thread_controller->last_decision().c_str());
+
+  return m_thread_controller->threads() > previous;
+}
+
+uint64_t Dump_loader::query_redo_log_capacity() const {
+  // innodb_log_file_size and innodb_log_files_in_group are deprecated and
+  // ignored if innodb_redo_log_capacity is set
+  return m_session
+      ->query(m_options.target_server_version() >=
+                      mysqlshdk::utils::Version(8, 0, 30)
+                  ? "SELECT @@innodb_redo_log_capacity"
+                  : "SELECT @@innodb_log_file_size * "
+                    "@@innodb_log_files_in_group")
+      ->fetch_one_or_throw()
+      ->get_uint(0);
+}
+
+int64_t Dump_loader::query_checkpoint_age() const {
+  uint64_t current_lsn = 0;
+  uint64_t checkpoint_lsn = 0;
+
+  try {
+    if (m_options.target_server_version() >=
+        mysqlshdk::utils::Version(8, 0, 30)) {
+      const auto result = m_session->query(
+          "SHOW GLOBAL STATUS WHERE Variable_name IN "
+          "('Innodb_redo_log_current_lsn', 'Innodb_redo_log_checkpoint_lsn')");
+
+      while (const auto row = result->fetch_one()) {
+        const auto value = shcore::lexical_cast<uint64_t>(row->get_string(1));
+
+        if ("Innodb_redo_log_current_lsn" == row->get_string(0)) {
+          current_lsn = value;
+        } else {
+          checkpoint_lsn = value;
+        }
+      }
+    } else {
+      // requires the PROCESS privilege
+      const auto status = m_session->query("SHOW ENGINE INNODB STATUS")
+                              ->fetch_one_or_throw()
+                              ->get_string(2);
+      const auto lsn = [&status](const char *label) -> uint64_t {
+        const auto pos = status.find(label);
+        return std::string::npos == pos
+                   ? 0
+                   : std::strtoull(status.c_str() + pos + strlen(label),
+                                   nullptr, 10);
+      };
+
+      current_lsn = lsn("Log sequence number");
+      checkpoint_lsn = lsn("Last checkpoint at");
+    }
+  } catch (const std::exception &e) {
+    log_debug("Failed to fetch the checkpoint age: %s", e.what());
+    return -1;
+  }
+
+  if (0 == current_lsn || 0 == checkpoint_lsn || current_lsn < checkpoint_lsn) {
+    return -1;
+  }
+
+  return static_cast<int64_t>(current_lsn - checkpoint_lsn);
 }
 
 void Dump_loader::post_worker_event(Worker *worker, Worker_event::Event event) {
@@ -35,13 +35,16 @@
 #include <unordered_set>
 #include <utility>
 #include <vector>
+#include "modules/util/import_table/load_data.h"
 #include "modules/util/load/dump_reader.h"
 #include "modules/util/load/load_dump_options.h"
 #include "modules/util/load/load_progress_log.h"
+#include "modules/util/load/thread_count_controller.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
+#include "mysqlshdk/libs/utils/rate_limit.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 
 namespace mysqlsh {
@@ -95,11 +98,13 @@ class Dump_loader {
       Table_ddl_task(size_t id, const std::string &schema,
                      const std::string &table,
                      std::unique_ptr<mysqlshdk::storage::IFile> file,
-                     bool placeholder, Load_progress_log::Status status)
+                     bool placeholder, Load_progress_log::Status status,
+                     bool replace)
           : Task(id, schema, table),
             m_file(std::move(file)),
             m_placeholder(placeholder),
-            m_status(status) {}
+            m_status(status),
+            m_replace(replace) {}
 
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                    Worker *, Dump_loader *) override;
@@ -128,6 +133,8 @@ class Dump_loader {
       std::unique_ptr<mysqlshdk::storage::IFile> m_file;
       bool m_placeholder = false;
       Load_progress_log::Status m_status;
+      // existing table is dropped before the DDL is executed
+      bool m_replace = false;
 
       std::unique_ptr<std::vector<std::string>> m_deferred_indexes;
     };
@@ -178,7 +185,7 @@ class Dump_loader {
                    Worker *, Dump_loader *) override;
 
       void load(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
-                Dump_loader *);
+                Worker *, Dump_loader *);
 
       ssize_t chunk_index() const { return m_chunk_index; }
 
@@ -209,14 +216,15 @@ class Dump_loader {
      public:
       Index_recreation_task(size_t id, const std::string &schema,
                             const std::string &table,
-                            const std::vector<std::string> &queries)
-          : Task(id, schema, table), m_queries(queries) {}
+                            const std::vector<std::string> &indexes)
+          : Task(id, schema, table), m_indexes(indexes) {}
 
       bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
                    Worker *, Dump_loader *) override;
 
      private:
-      const std::vector<std::string> &m_queries;
+      // definitions of indexes to be added
+      const std::vector<std::string> &m_indexes;
     };
 
     Worker(size_t id, Dump_loader *owner);
@@ -229,7 +237,8 @@ class Dump_loader {
     void process_table_ddl(const std::string &schema, const std::string &table,
                            std::unique_ptr<mysqlshdk::storage::IFile> file,
                            bool is_placeholder,
-                           Load_progress_log::Status status);
+                           Load_progress_log::Status status,
+                           bool replace = false);
 
     void load_chunk_file(const std::string &schema, const std::string &table,
                          std::unique_ptr<mysqlshdk::storage::IFile> file,
@@ -256,6 +265,8 @@ class Dump_loader {
 
     std::shared_ptr<mysqlshdk::db::mysql::Session> m_session;
     uint64_t m_connection_id;
+    // checked once per session
+    import_table::Server_side_files m_server_side_files;
 
     std::unique_ptr<Task> m_task;
 
@@ -328,6 +339,27 @@ class Dump_loader {
 
   void clear_worker(Worker *worker);
 
+  /**
+   * Samples the load statistics and adjusts the number of active workers, if
+   * number of threads is chosen automatically.
+   *
+   * @returns true if number of active workers was increased
+   */
+  bool adjust_active_workers();
+
+  /**
+   * Provides the capacity of the redo log in bytes.
+   */
+  uint64_t query_redo_log_capacity() const;
+
+  /**
+   * Provides the current checkpoint age in bytes, used if the
+   * log_lsn_checkpoint_age InnoDB metric is not enabled.
+   *
+   * @returns -1 if checkpoint age cannot be obtained
+   */
+  int64_t query_checkpoint_age() const;
+
   void post_worker_event(Worker *worker, Worker_event::Event event);
 
   void on_schema_end(const std::string &schema);
@@ -362,13 +394,32 @@ class Dump_loader {
   void check_server_version();
   void check_tables_without_primary_key();
 
+  /**
+   * Fast ingest temporarily disables the InnoDB redo log and increases the
+   * size of the log buffer. Original values are stored in the progress file,
+   * so that they can be restored if load is interrupted or fails.
+   */
+  void check_server_is_idle();
+  void setup_fast_ingest();
+  void restore_fast_ingest();
+
   void handle_schema_option();
 
   std::string filter_user_script_for_mds(const std::string &script);
 
+  /**
+   * Combines definitions of deferred indexes of a table into as few
+   * ALTER TABLE statements as possible, so that the table is scanned and its
+   * data is sorted only once. InnoDB can create only one FULLTEXT or SPATIAL
+   * index at a time, these get a statement of their own.
+   */
+  static std::vector<std::string> alter_table_for_indexes(
+      const std::string &key, const std::vector<std::string> &indexes);
+
  private:
 #ifdef FRIEND_TEST
   FRIEND_TEST(Load_dump, sql_transforms_strip_sql_mode);
+  FRIEND_TEST(Load_dump, alter_table_for_indexes);
   FRIEND_TEST(Load_dump_mocked, chunk_scheduling_more_threads);
   FRIEND_TEST(Load_dump_mocked, chunk_scheduling_more_tables);
   FRIEND_TEST(Load_dump_mocked, filter_user_script_for_mds);
@@ -431,6 +482,7 @@ class Dump_loader {
 
   bool m_init_done = false;
   bool m_workers_killed = false;
+  bool m_fast_ingest_enabled = false;
 
   std::unique_ptr<mysqlshdk::textui::IProgress> m_progress;
   std::recursive_mutex m_output_mutex;
@@ -447,8 +499,25 @@ class Dump_loader {
   std::atomic<size_t> m_num_chunks_loaded;
   std::atomic<size_t> m_num_warnings;
   std::atomic<size_t> m_num_errors;
+  std::atomic<size_t> m_num_indexes_recreated;
+  std::atomic<size_t> m_num_tables_with_indexes_recreated;
+  // time spent by all workers recreating indexes
+  std::atomic<uint64_t> m_index_build_time_ms;
+
+  // limits the throughput of all workers
+  std::shared_ptr<mysqlshdk::utils::Shared_rate_limit> m_total_rate_limit;
 
   int m_progress_spin = 0;
+
+  // chooses the number of active workers if threads: "auto" is used
+  std::unique_ptr<Thread_count_controller> m_thread_controller;
+  // workers which are currently executing a task
+  std::unordered_set<size_t> m_busy_workers;
+  std::chrono::steady_clock::time_point m_last_sample_time;
+  // redo log capacity in bytes, 0 if unknown
+  uint64_t m_redo_log_capacity = 0;
+  // whether it was reported that checkpoint age is not available
+  bool m_checkpoint_age_unavailable = false;
 };
 
 }  // namespace mysqlsh
@@ -128,6 +128,10 @@ Dump_reader::Status Dump_reader::open() {
 
   m_contents.has_users = md->has_key("users");
 
+  if (const auto base = md->get_map("baseDump")) {
+    m_contents.base_dump = base->get_string("url");
+  }
+
   try {
     m_contents.parse_done_metadata(m_dir.get());
 
@@ -327,12 +331,32 @@ std::string Dump_reader::fetch_schema_script(const std::string &schema) const {
 // Thus, smaller tables must get fewer threads allocated so they take longer
 // to load, while bigger threads get more, with the hope that the total time
 // to load all tables is minimized.
+//
+// If max_threads_per_table is set, chunked tables with a primary key are not
+// given more than that many threads. Chunks are always handed out in the order
+// of their indexes, which is the ascending order of the primary key (dumper
+// writes the chunks of a table in that order), so with few threads per table
+// rows are appended at the end of the clustered index instead of being
+// inserted all over it, which reduces the number of page splits.
 std::unordered_set<Dump_reader::Table_info *>::iterator
 Dump_reader::schedule_chunk_proportionally(
     const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
-    std::unordered_set<Dump_reader::Table_info *> *tables_with_data) {
+    std::unordered_set<Dump_reader::Table_info *> *tables_with_data,
+    uint64_t max_threads_per_table) {
   if (tables_with_data->empty()) return tables_with_data->end();
 
+  const auto can_load = [&tables_being_loaded, max_threads_per_table](
+                            const Dump_reader::Table_info *table) {
+    if (0 == max_threads_per_table || !table->chunked ||
+        table->primary_index.empty()) {
+      return true;
+    }
+
+    return tables_being_loaded.count(
+               schema_table_key(table->schema, table->table)) <
+           max_threads_per_table;
+  };
+
   // first check if there's any table that's not being loaded
   {
     auto best = tables_with_data->end();
@@ -375,25 +399,31 @@ Dump_reader::schedule_chunk_proportionally(
   // calc ratio of data available per table / total data available
   double total_bytes_available = std::accumulate(
       tables_with_data->begin(), tables_with_data->end(),
-      static_cast<size_t>(0), [](size_t size, Dump_reader::Table_info *table) {
-        return size + table->bytes_available();
+      static_cast<size_t>(0),
+      [&can_load](size_t size, Dump_reader::Table_info *table) {
+        return can_load(table) ? size + table->bytes_available() : size;
       });
   if (total_bytes_available > 0) {
     for (auto it = tables_with_data->begin(); it != tables_with_data->end();
          ++it) {
-      candidate_weights.emplace_back(
-          it, static_cast<double>((*it)->bytes_available()) /
-                  total_bytes_available);
+      if (can_load(*it)) {
+        candidate_weights.emplace_back(
+            it, static_cast<double>((*it)->bytes_available()) /
+                    total_bytes_available);
+      }
     }
-  } else {
-    assert(0);
-    return tables_with_data->begin();
+  }
+
+  if (candidate_weights.empty()) {
+    // all tables with data have reached their thread limit
+    assert(max_threads_per_table > 0);
+    return tables_with_data->end();
   }
 
   // pick a chunk from the table that has the biggest difference between both
   double best_diff = 0;
   std::unordered_set<Dump_reader::Table_info *>::iterator best =
-      tables_with_data->begin();
+      candidate_weights.front().first;
 
   for (const auto &cand : candidate_weights) {
     std::string key =
@@ -423,7 +453,8 @@ bool Dump_reader::next_table_chunk(
     std::unique_ptr<mysqlshdk::storage::IFile> *out_file,
     size_t *out_chunk_size, shcore::Dictionary_t *out_options) {
   auto iter =
-      schedule_chunk_proportionally(tables_being_loaded, &m_tables_with_data);
+      schedule_chunk_proportionally(tables_being_loaded, &m_tables_with_data,
+                                    m_options.max_threads_per_table());
 
   if (iter != m_tables_with_data.end()) {
     *out_chunked = (*iter)->chunked;
@@ -465,21 +496,56 @@ bool Dump_reader::next_deferred_index(
     std::string *out_schema, std::string *out_table,
     std::vector<std::string> **out_indexes,
     const std::function<bool(const std::string &)> &load_finished) {
+  // the biggest tables take the longest to index, start with them so that
+  // they do not end up being the only thing running at the end of the load
+  Table_info *next = nullptr;
+  size_t next_size = 0;
+
   for (auto &schema : m_contents.schemas) {
     for (auto &table : schema.second->tables) {
       if (!table.second->indexes_done && table.second->data_done() &&
           load_finished(schema_table_key(schema.first, table.first))) {
-        table.second->indexes_done = true;
-        *out_schema = schema.second->schema;
-        *out_table = table.second->table;
-        *out_indexes = &table.second->indexes;
-        return true;
+        const auto size = table_data_size(*table.second);
+
+        if (!next || size > next_size) {
+          next = table.second.get();
+          next_size = size;
+        }
       }
     }
   }
+
+  if (next) {
+    next->indexes_done = true;
+    *out_schema = next->schema;
+    *out_table = next->table;
+    *out_indexes = &next->indexes;
+    return true;
+  }
+
   return false;
 }
 
+size_t Dump_reader::table_data_size(const Table_info &table) const {
+  const auto s = m_contents.table_data_size.find(table.schema);
+
+  if (s != m_contents.table_data_size.end()) {
+    const auto t = s->second.find(table.table);
+
+    if (t != s->second.end()) {
+      return t->second;
+    }
+  }
+
+  size_t size = 0;
+
+  for (const auto chunk_size : table.available_chunk_sizes) {
+    if (chunk_size > 0) size += chunk_size;
+  }
+
+  return size;
+}
+
 bool Dump_reader::next_table_analyze(std::string *out_schema,
                                      std::string *out_table,
                                      std::vector<Histogram> *out_histograms) {
@@ -576,13 +642,15 @@ void Dump_reader::add_deferred_indexes(const std::string &schema,
   idx.erase(
       std::remove_if(
           idx.begin(), idx.end(),
-          [&s](const std::string &q) {
+          [&s, &schema, &table](const std::string &q) {
             mysqlshdk::utils::SQL_iterator it(q);
             while (it.valid() &&
                    !shcore::str_caseeq(it.get_next_token(), "FOREIGN")) {
             }
             if (it.valid() && shcore::str_caseeq(it.get_next_token(), "KEY")) {
-              s->second->fk_queries.emplace_back(q);
+              s->second->fk_queries.emplace_back(
+                  "ALTER TABLE " + schema_table_key(schema, table) + " ADD " +
+                  q + ";");
               return true;
             }
             return false;
@@ -618,6 +686,19 @@ void Dump_reader::replace_target_schema(const std::string &schema) {
   }
 }
 
+bool Dump_reader::table_replaced(const std::string &schema,
+                                 const std::string &table) const {
+  if (!is_incremental()) return false;
+
+  const auto s = m_contents.schemas.find(schema);
+  if (s == m_contents.schemas.end()) return false;
+
+  const auto t = s->second->tables.find(table);
+  if (t == s->second->tables.end()) return false;
+
+  return t->second->has_data && !t->second->unchanged_since_base;
+}
+
 void Dump_reader::validate_options() {
   if (m_options.load_users() && !m_contents.has_users) {
     current_console()->print_warning(
@@ -625,6 +706,23 @@ void Dump_reader::validate_options() {
         "the user data.");
   }
 
+  if (is_incremental()) {
+    // changed tables are dropped and recreated, loading just the DDL or just
+    // the data would lose the rows of such tables
+    if (!m_options.load_data() || !m_options.load_ddl()) {
+      throw std::invalid_argument(
+          "The dump is an incremental dump, it can only be loaded if both "
+          "'loadDdl' and 'loadData' options are enabled.");
+    }
+
+    current_console()->print_note(
+        "The dump is an incremental dump based on the dump at '" +
+        m_contents.base_dump +
+        "'. The base dump and all the preceding incremental dumps must be "
+        "loaded first. Tables which have changed since the base dump are "
+        "going to be replaced.");
+  }
+
   if (is_dump_tables()) {
     if (m_options.target_schema().empty()) {
       // user didn't provide an option, we cannot proceed if the dump was
@@ -685,6 +783,7 @@ void Dump_reader::Table_info::rescan(
 
       has_sql = md->get_bool("includesDdl", true);
       has_data = md->get_bool("includesData", true);
+      unchanged_since_base = md->get_bool("unchangedSinceBase", false);
 
       options = md->get_map("options");
 
@@ -83,6 +83,21 @@ class Dump_reader {
     return table_only() || "dumpTables" == m_contents.origin;
   }
 
+  /**
+   * Checks whether this is an incremental dump, which needs to be loaded on
+   * top of its base dump.
+   */
+  bool is_incremental() const { return !m_contents.base_dump.empty(); }
+
+  const std::string &base_dump() const { return m_contents.base_dump; }
+
+  /**
+   * Checks whether the given table has changed since the base dump and needs
+   * to be replaced when loading an incremental dump.
+   */
+  bool table_replaced(const std::string &schema,
+                      const std::string &table) const;
+
   void replace_target_schema(const std::string &schema);
 
   std::string users_script() const;
@@ -213,6 +228,7 @@ class Dump_reader {
 
     bool has_sql = true;
     bool has_data = true;
+    bool unchanged_since_base = false;
 
     bool md_seen = false;
     bool md_done = false;
@@ -325,6 +341,8 @@ class Dump_reader {
     mysqlshdk::utils::Version server_version;
     mysqlshdk::utils::Version dump_version;
     std::string origin;
+    // URL of the base dump, if this is an incremental dump
+    std::string base_dump;
     uint64_t bytes_per_chunk = 0;
     std::unordered_map<std::string, uint64_t> chunk_sizes;
 
@@ -361,10 +379,17 @@ class Dump_reader {
   static std::unordered_set<Dump_reader::Table_info *>::iterator
   schedule_chunk_proportionally(
       const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
-      std::unordered_set<Dump_reader::Table_info *> *tables_with_data);
+      std::unordered_set<Dump_reader::Table_info *> *tables_with_data,
+      uint64_t max_threads_per_table = 0);
+
+  // uncompressed size of table data, estimated using the available chunks
+  // if the dump is not yet complete
+  size_t table_data_size(const Table_info &table) const;
 
 #ifdef FRIEND_TEST
   FRIEND_TEST(Dump_scheduler, load_scheduler);
+  FRIEND_TEST(Dump_scheduler, max_threads_per_table);
+  FRIEND_TEST(Dump_scheduler, deferred_indexes_biggest_first);
 #endif
 };
 
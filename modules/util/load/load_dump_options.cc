@@ -28,12 +28,15 @@
 #include "modules/mod_utils.h"
 #include "modules/util/dump/dump_manifest.h"
 #include "mysqlshdk/libs/utils/debug.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
 
 namespace {
 
+constexpr int64_t k_auto_max_threads = 32;
+
 const char *k_excluded_users[] = {"mysql.infoschema", "mysql.session",
                                   "mysql.sys"};
 const char *k_oci_excluded_users[] = {"administrator", "ociadmin", "ocimonitor",
@@ -127,6 +130,27 @@ void Load_dump_options::validate() {
         "It is not possible to disable the binary log when loading a dump into "
         "the MySQL Database Service.");
   }
+
+  if (fast_ingest()) {
+    if (is_mds()) {
+      throw shcore::Exception::argument_error(
+          "The 'fastIngest' option cannot be used when loading a dump into "
+          "the MySQL Database Service.");
+    }
+
+    if (m_target_server_version < mysqlshdk::utils::Version(8, 0, 21)) {
+      throw shcore::Exception::argument_error(
+          "The 'fastIngest' option requires MySQL 8.0.21 or newer.");
+    }
+
+    if (!m_progress_file.is_null() && m_progress_file->empty()) {
+      // original settings of the server are stored in the progress file, so
+      // that they can be restored if the shell does not finish the load
+      throw shcore::Exception::argument_error(
+          "The 'fastIngest' option cannot be used if the 'progressFile' option "
+          "is set to an empty string.");
+    }
+  }
 }
 
 std::string Load_dump_options::target_import_info() const {
@@ -180,7 +204,11 @@ std::string Load_dump_options::target_import_info() const {
 
   std::string detail;
 
-  if (threads_count() == 1)
+  if (auto_threads())
+    detail = shcore::str_format(
+        " using up to %s threads, adjusted automatically.",
+        std::to_string(threads_count()).c_str());
+  else if (threads_count() == 1)
     detail = " using 1 thread.";
   else
     detail = shcore::str_format(" using %s threads.",
@@ -200,10 +228,13 @@ void Load_dump_options::set_options(const shcore::Dictionary_t &options) {
   std::unordered_set<std::string> included_users;
   std::string update_gtid_set = "off";
   double wait_dump_timeout = 0;
+  std::string max_total_rate;
+  int64_t max_threads_per_table = 0;
+  shcore::Value threads;
 
   Unpack_options unpacker(options);
 
-  unpacker.optional("threads", &m_threads_count)
+  unpacker.optional("threads", &threads)
       .optional("showProgress", &m_show_progress)
       .optional("waitDumpTimeout", &wait_dump_timeout)
       .optional("loadData", &m_load_data)
@@ -226,10 +257,56 @@ void Load_dump_options::set_options(const shcore::Dictionary_t &options) {
       .optional("schema", &m_target_schema)
       .optional("excludeUsers", &excluded_users)
       .optional("includeUsers", &included_users)
-      .optional("updateGtidSet", &update_gtid_set);
+      .optional("updateGtidSet", &update_gtid_set)
+      .optional("useServerSideFiles", &m_use_server_side_files)
+      .optional("fastIngest", &m_fast_ingest)
+      .optional("maxThreadsPerTable", &max_threads_per_table)
+      .optional("maxTotalRate", &max_total_rate);
 
   m_wait_dump_timeout_ms = wait_dump_timeout * 1000;
 
+  if (threads) {
+    const auto invalid_threads = []() {
+      return std::invalid_argument(
+          "The value of 'threads' option must be a positive integer or "
+          "\"auto\".");
+    };
+
+    if (shcore::String == threads.type &&
+        shcore::str_caseeq(threads.get_string(), "auto")) {
+      m_auto_threads = true;
+      m_threads_count = k_auto_max_threads;
+    } else {
+      try {
+        // command line passes all options as strings
+        m_threads_count = threads.as_int();
+      } catch (const std::exception &e) {
+        if (shcore::String == threads.type) {
+          throw invalid_threads();
+        }
+
+        throw shcore::Exception::type_error(std::string("Option 'threads' ") +
+                                            e.what());
+      }
+
+      if (m_threads_count <= 0) {
+        throw invalid_threads();
+      }
+    }
+  }
+
+  if (max_threads_per_table < 0) {
+    throw std::invalid_argument(
+        "The value of 'maxThreadsPerTable' option must be a non-negative "
+        "integer.");
+  }
+
+  m_max_threads_per_table = static_cast<uint64_t>(max_threads_per_table);
+
+  if (!max_total_rate.empty()) {
+    m_max_total_rate = mysqlshdk::utils::expand_to_bytes(max_total_rate);
+  }
+
   unpacker.unpack(&m_oci_options);
   unpacker.end();
 
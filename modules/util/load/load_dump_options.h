@@ -106,6 +106,21 @@ class Load_dump_options final {
 
   int64_t threads_count() const { return m_threads_count; }
 
+  /**
+   * If true, threads_count() is the maximum number of threads, number of
+   * threads loading the data is adjusted while the load is running.
+   */
+  bool auto_threads() const { return m_auto_threads; }
+
+  int64_t max_total_rate() const { return m_max_total_rate; }
+
+  /**
+   * Maximum number of threads loading chunks of a single table with a primary
+   * key, 0 if unlimited. If set, chunks of such tables are loaded in the
+   * ascending order of the primary key.
+   */
+  uint64_t max_threads_per_table() const { return m_max_threads_per_table; }
+
   uint64_t dump_wait_timeout_ms() const { return m_wait_dump_timeout_ms; }
 
   const std::string &character_set() const { return m_character_set; }
@@ -120,6 +135,10 @@ class Load_dump_options final {
 
   bool skip_binlog() const { return m_skip_binlog; }
 
+  bool use_server_side_files() const { return m_use_server_side_files; }
+
+  bool fast_ingest() const { return m_fast_ingest; }
+
   bool force() const { return m_force; }
 
   bool include_schema(const std::string &schema) const;
@@ -161,6 +180,9 @@ class Load_dump_options final {
   bool m_use_par = false;
   bool m_use_par_progress = false;
   int64_t m_threads_count = 4;
+  bool m_auto_threads = false;
+  int64_t m_max_total_rate = 0;
+  uint64_t m_max_threads_per_table = 0;
   bool m_show_progress = isatty(fileno(stdout)) ? true : false;
 
   mysqlshdk::oci::Oci_options m_oci_options;
@@ -187,6 +209,8 @@ class Load_dump_options final {
   bool m_dry_run = false;
   bool m_force = false;
   bool m_skip_binlog = false;
+  bool m_use_server_side_files = false;
+  bool m_fast_ingest = false;
   bool m_ignore_existing_objects = false;
   bool m_ignore_version = false;
   Defer_index_mode m_defer_table_indexes = Defer_index_mode::FULLTEXT;
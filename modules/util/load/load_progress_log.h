@@ -50,6 +50,14 @@ class Load_progress_log final {
     uint64_t raw_bytes_completed;
   };
 
+  /**
+   * Server settings which were in effect before the fast ingest was enabled.
+   */
+  struct Fast_ingest_settings {
+    bool redo_log_enabled = true;
+    uint64_t innodb_log_buffer_size = 0;
+  };
+
   Progress_status init(std::unique_ptr<mysqlshdk::storage::IFile> file,
                        bool dry_run, bool rewrite_on_flush) {
     mysqlshdk::storage::IFile *existing_file = file.get();
@@ -91,6 +99,21 @@ class Load_progress_log final {
 
                 std::string key = entry->get_string("op");
 
+                if ("FAST-INGEST" == key) {
+                  // the last entry is the one that matters, settings need to
+                  // be restored if it was not finished
+                  m_fast_ingest_pending = !done;
+
+                  if (!done) {
+                    m_fast_ingest_settings.redo_log_enabled =
+                        entry->get_bool("redo_log_enabled");
+                    m_fast_ingest_settings.innodb_log_buffer_size =
+                        entry->get_uint("innodb_log_buffer_size");
+                  }
+
+                  return true;
+                }
+
                 if (entry->has_key("schema"))
                   key += ":`" + entry->get_string("schema") + "`";
 
@@ -243,6 +266,41 @@ class Load_progress_log final {
           raw_bytes_loaded);
   }
 
+  /**
+   * Whether previous load attempt was interrupted while fast ingest was
+   * enabled, in that case server settings still need to be restored.
+   */
+  bool fast_ingest_pending() const { return m_fast_ingest_pending; }
+
+  const Fast_ingest_settings &fast_ingest_settings() const {
+    return m_fast_ingest_settings;
+  }
+
+  void start_fast_ingest(const Fast_ingest_settings &original) {
+    m_fast_ingest_pending = true;
+    m_fast_ingest_settings = original;
+
+    if (m_file) {
+      shcore::JSON_dumper json;
+
+      json.start_object();
+      json.append_string("op", "FAST-INGEST");
+      json.append_bool("done", false);
+      json.append_bool("redo_log_enabled", original.redo_log_enabled);
+      json.append_uint64("innodb_log_buffer_size",
+                         original.innodb_log_buffer_size);
+      json.end_object();
+
+      mysqlshdk::storage::fputs(json.str() + "\n", m_file.get());
+      flush();
+    }
+  }
+
+  void end_fast_ingest() {
+    m_fast_ingest_pending = false;
+    log(true, "FAST-INGEST", "", "");
+  }
+
   void start_gtid_update() {
     if (gtid_update_status() != Status::DONE) log(false, "GTID-UPDATE", "", "");
   }
@@ -258,6 +316,9 @@ class Load_progress_log final {
 
   std::unordered_map<std::string, Status> m_last_state;
 
+  bool m_fast_ingest_pending = false;
+  Fast_ingest_settings m_fast_ingest_settings;
+
   void log(bool end, const std::string &op, const std::string &schema,
            const std::string &table) {
     if (m_file) {
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/thread_count_controller.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+
+namespace {
+
+// number of consecutive samples needed to confirm a decision
+constexpr int k_votes_required = 2;
+
+// minimum improvement of throughput which justifies an additional thread
+constexpr double k_min_gain = 0.05;
+
+// purge is lagging behind if history list is longer than this
+constexpr int64_t k_max_history_list_length = 1000000;
+
+// flushing is about to stall if checkpoint age exceeds this fraction of the
+// redo log capacity
+constexpr double k_max_checkpoint_age = 0.75;
+
+// number of samples after which the ceiling set by a failed attempt to grow
+// expires and adding threads is attempted again
+constexpr int k_ceiling_lifetime = 30;
+
+double rate(uint64_t current, uint64_t previous, double elapsed) {
+  return current > previous ? (current - previous) / elapsed : 0.0;
+}
+
+}  // namespace
+
+Thread_count_controller::Thread_count_controller(std::size_t min_threads,
+                                                 std::size_t max_threads,
+                                                 std::size_t initial_threads)
+    : m_min_threads(std::max(min_threads, static_cast<std::size_t>(1))),
+      m_max_threads(std::max(max_threads, m_min_threads)),
+      m_threads(std::min(std::max(initial_threads, m_min_threads),
+                         m_max_threads)),
+      m_ceiling(m_max_threads) {}
+
+bool Thread_count_controller::update(const Sample &sample) {
+  if (!m_has_previous) {
+    m_previous = sample;
+    m_has_previous = true;
+    return false;
+  }
+
+  const auto elapsed = sample.time - m_previous.time;
+
+  if (elapsed <= 0.0) {
+    return false;
+  }
+
+  const auto throughput =
+      rate(sample.bytes_loaded, m_previous.bytes_loaded, elapsed);
+  const auto rows_rate =
+      rate(sample.rows_inserted, m_previous.rows_inserted, elapsed);
+
+  m_previous = sample;
+
+  if (m_ceiling_expires_in > 0 && 0 == --m_ceiling_expires_in) {
+    m_ceiling = m_max_threads;
+  }
+
+  const auto stats = shcore::str_format(
+      "%.0f bytes/s loaded, %.0f rows/s inserted by the server", throughput,
+      rows_rate);
+
+  Action action = Action::NONE;
+  std::string reason;
+
+  if (0.0 == throughput) {
+    // not loading data at the moment (i.e. waiting for the dump, DDL, indexes)
+    action = Action::NONE;
+  } else if (under_pressure(sample, &reason)) {
+    action = Action::SHRINK;
+  } else if (m_throughput_before_growth >= 0.0) {
+    if (throughput < m_throughput_before_growth * (1.0 + k_min_gain)) {
+      action = Action::SHRINK;
+      reason = shcore::str_format(
+          "throughput did not improve after adding a thread (%.0f bytes/s "
+          "before)",
+          m_throughput_before_growth);
+    } else {
+      // last increase was beneficial, try to add another thread
+      m_throughput_before_growth = -1.0;
+      action = Action::GROW;
+      reason = "throughput improved after adding a thread";
+    }
+  } else {
+    action = Action::GROW;
+    reason = "server is not under pressure";
+  }
+
+  if (Action::GROW == action && m_threads >= m_ceiling) {
+    action = Action::NONE;
+  }
+
+  if (Action::SHRINK == action && m_threads <= m_min_threads) {
+    action = Action::NONE;
+    m_throughput_before_growth = -1.0;
+  }
+
+  if (!vote(action)) {
+    return false;
+  }
+
+  if (Action::GROW == action) {
+    m_throughput_before_growth = throughput;
+  } else {
+    m_throughput_before_growth = -1.0;
+    // do not grow back right away
+    m_ceiling = m_threads - 1;
+    m_ceiling_expires_in = k_ceiling_lifetime;
+  }
+
+  change(action, reason + "; " + stats);
+
+  return true;
+}
+
+bool Thread_count_controller::under_pressure(const Sample &sample,
+                                             std::string *reason) const {
+  assert(reason);
+
+  if (sample.history_list_length > k_max_history_list_length) {
+    *reason = shcore::str_format("history list length is %lld",
+                                 static_cast<long long>(
+                                     sample.history_list_length));
+    return true;
+  }
+
+  if (sample.checkpoint_age > k_max_checkpoint_age) {
+    *reason = shcore::str_format(
+        "checkpoint age is at %.0f%% of the redo log capacity",
+        sample.checkpoint_age * 100);
+    return true;
+  }
+
+  return false;
+}
+
+bool Thread_count_controller::vote(Action action) {
+  if (action == m_pending_action) {
+    ++m_votes;
+  } else {
+    m_pending_action = action;
+    m_votes = 1;
+  }
+
+  if (Action::NONE == action || m_votes < k_votes_required) {
+    return false;
+  }
+
+  m_pending_action = Action::NONE;
+  m_votes = 0;
+
+  return true;
+}
+
+void Thread_count_controller::change(Action action, const std::string &reason) {
+  assert(Action::NONE != action);
+
+  if (Action::GROW == action) {
+    ++m_threads;
+  } else {
+    --m_threads;
+  }
+
+  m_last_decision = shcore::str_format(
+      "%s the number of threads to %zu: %s",
+      Action::GROW == action ? "Increasing" : "Decreasing", m_threads,
+      reason.c_str());
+}
+
+}  // namespace mysqlsh
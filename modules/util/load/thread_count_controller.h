@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_THREAD_COUNT_CONTROLLER_H_
+#define MODULES_UTIL_LOAD_THREAD_COUNT_CONTROLLER_H_
+
+#include <cstdint>
+#include <string>
+
+namespace mysqlsh {
+
+/**
+ * Decides how many workers should be loading data at any given time, based on
+ * the periodic samples of client throughput and server load.
+ *
+ * Number of workers is increased one at a time, as long as it improves the
+ * throughput and server is not under pressure. It is decreased if server is
+ * under pressure, or if the last increase did not improve the throughput.
+ * Each decision needs to be confirmed by multiple consecutive samples.
+ */
+class Thread_count_controller final {
+ public:
+  struct Sample {
+    // seconds since an arbitrary point in time
+    double time = 0.0;
+    // total number of bytes loaded by the client
+    uint64_t bytes_loaded = 0;
+    // total number of rows inserted by the server (all clients)
+    uint64_t rows_inserted = 0;
+    // length of the InnoDB history list, -1 if not available
+    int64_t history_list_length = -1;
+    // checkpoint age as a fraction of the redo log capacity, < 0 if not
+    // available
+    double checkpoint_age = -1.0;
+  };
+
+  Thread_count_controller(std::size_t min_threads, std::size_t max_threads,
+                          std::size_t initial_threads);
+
+  Thread_count_controller(const Thread_count_controller &) = delete;
+  Thread_count_controller(Thread_count_controller &&) = default;
+
+  Thread_count_controller &operator=(const Thread_count_controller &) = delete;
+  Thread_count_controller &operator=(Thread_count_controller &&) = default;
+
+  ~Thread_count_controller() = default;
+
+  /**
+   * Processes the new sample.
+   *
+   * @returns true if number of threads has changed
+   */
+  bool update(const Sample &sample);
+
+  std::size_t threads() const { return m_threads; }
+
+  std::size_t max_threads() const { return m_max_threads; }
+
+  /**
+   * Human-readable explanation of the last decision.
+   */
+  const std::string &last_decision() const { return m_last_decision; }
+
+ private:
+  enum class Action { NONE, GROW, SHRINK };
+
+  bool under_pressure(const Sample &sample, std::string *reason) const;
+
+  bool vote(Action action);
+
+  void change(Action action, const std::string &reason);
+
+  std::size_t m_min_threads;
+  std::size_t m_max_threads;
+  std::size_t m_threads;
+
+  bool m_has_previous = false;
+  Sample m_previous;
+
+  // throughput (bytes per second) measured before the last increase
+  double m_throughput_before_growth = -1.0;
+  // workers are not added above this number, until it expires
+  std::size_t m_ceiling;
+  int m_ceiling_expires_in = 0;
+
+  Action m_pending_action = Action::NONE;
+  int m_votes = 0;
+
+  std::string m_last_decision;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_THREAD_COUNT_CONTROLLER_H_
@@ -23,12 +23,20 @@
 
 #include "modules/util/mod_util.h"
 
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 #include <memory>
 #include <set>
 #include <utility>
 #include <vector>
 #include "modules/mod_utils.h"
 #include "modules/mysqlxtest_utils.h"
+#include "modules/util/compare/compare_tables.h"
+#include "modules/util/compare/compare_tables_options.h"
 #include "modules/util/dump/dump_instance.h"
 #include "modules/util/dump/dump_instance_options.h"
 #include "modules/util/dump/dump_schemas.h"
@@ -53,6 +61,7 @@
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/oci/oci_setup.h"
+#include "mysqlshdk/libs/textui/text_progress.h"
 #include "mysqlshdk/libs/utils/document_parser.h"
 #include "mysqlshdk/libs/utils/profiling.h"
 #include "mysqlshdk/libs/utils/ssl_keygen.h"
@@ -92,6 +101,10 @@ Util::Util(shcore::IShell_core *owner) : _shell_core(*owner) {
   expose("dumpInstance", &Util::dump_instance, "outputUrl", "?options");
   expose("exportTable", &Util::export_table, "table", "outputUrl", "?options");
   expose("loadDump", &Util::load_dump, "url", "?options");
+  expose("compareTables", &Util::compare_tables, "schema", "tables",
+         "connectionData", "?options");
+  expose("compareSchemas", &Util::compare_schemas, "schemas",
+         "connectionData", "?options");
 }
 
 namespace {
@@ -392,6 +405,8 @@ void check_upgrade(const Connection_options &connection_options,
           ? "JSON"
           : "TEXT");
 
+  uint64_t threads = 1;
+
   if (options) {
     std::string target_version(MYSH_VERSION);
     std::string password;
@@ -400,8 +415,14 @@ void check_upgrade(const Connection_options &connection_options,
         .optional("targetVersion", &target_version)
         .optional("configPath", &opts.config_path)
         .optional("password", &password)
+        .optional("threads", &threads)
         .end();
 
+    if (0 == threads) {
+      throw std::invalid_argument(
+          "The value of 'threads' option must be greater than 0.");
+    }
+
     if (target_version == "8.0")
       opts.target_version = Version(MYSH_VERSION);
     else
@@ -466,21 +487,66 @@ void check_upgrade(const Connection_options &connection_options,
     }
   };
 
-  for (auto &check : checklist)
-    if (check->is_runnable()) {
-      try {
-        std::vector<Upgrade_issue> issues = check->run(session, opts);
-        for (const auto &issue : issues) update_counts(issue.level);
-        print->check_results(*check, issues);
-      } catch (const Upgrade_check::Check_configuration_error &e) {
-        print->check_error(*check, e.what(), false);
-      } catch (const std::exception &e) {
-        print->check_error(*check, e.what());
-      }
-    } else {
-      update_counts(check->get_level());
-      print->manual_check(*check);
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions{session};
+
+  for (uint64_t i = 1; i < threads; ++i) {
+    sessions.emplace_back(
+        establish_session(session->get_connection_options(), false));
+  }
+
+  shcore::on_leave_scope close_sessions([&sessions]() {
+    // the main session is closed by the caller
+    for (std::size_t i = 1; i < sessions.size(); ++i) {
+      sessions[i]->close();
     }
+  });
+
+  // progress is only shown when the checks are executed in parallel, as
+  // results are printed as soon as they are available otherwise
+  std::unique_ptr<mysqlshdk::textui::IProgress> progress;
+
+  if (threads > 1 && output_format == "TEXT" && isatty(fileno(stdout))) {
+    progress = std::make_unique<mysqlshdk::textui::Text_progress>(
+        "tasks", "tasks", "task", "tasks");
+    progress->set_left_label("Running upgrade checks using " +
+                             std::to_string(threads) + " threads: ");
+  } else {
+    progress = std::make_unique<mysqlshdk::textui::IProgress>();
+  }
+
+  Upgrade_check_runner runner{std::move(sessions), opts};
+
+  runner.run(
+      checklist,
+      [&print, &progress, &update_counts](const Upgrade_check &check,
+                                          const Upgrade_check_result &result) {
+        progress->hide(true);
+        shcore::on_leave_scope show_progress(
+            [&progress]() { progress->hide(false); });
+
+        if (!check.is_runnable()) {
+          update_counts(check.get_level());
+          print->manual_check(check);
+        } else if (result.exception) {
+          try {
+            std::rethrow_exception(result.exception);
+          } catch (const Upgrade_check::Check_configuration_error &e) {
+            print->check_error(check, e.what(), false);
+          } catch (const std::exception &e) {
+            print->check_error(check, e.what());
+          }
+        } else {
+          for (const auto &issue : result.issues) update_counts(issue.level);
+          print->check_results(check, result.issues);
+        }
+      },
+      [&progress](std::size_t done, std::size_t total) {
+        progress->total(total);
+        progress->current(done);
+        progress->show_status(done == total);
+      });
+
+  progress->hide(true);
 
   std::string summary;
   if (errors > 0) {
@@ -534,7 +600,12 @@ REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL4,
 REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL5,
               "@li password - password for connection.");
 
-REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6, "${TOPIC_CONNECTION_DATA}");
+REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6,
+              "@li threads - number of sessions used to execute the checks, "
+              "'check table x for upgrade' is run concurrently for multiple "
+              "tables (default=1).");
+
+REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL7, "${TOPIC_CONNECTION_DATA}");
 
 /**
  * \ingroup util
@@ -552,6 +623,7 @@ REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6, "${TOPIC_CONNECTION_DATA}");
  * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL3)
  * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL4)
  * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL5)
+ * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL6)
  *
  * \copydoc connection_options
  *
@@ -1074,6 +1146,9 @@ maxRate in bytes per second per thread.
 maxRate="0" - no limit. Unit suffixes, k - for Kilobytes (n * 1'000 bytes),
 M - for Megabytes (n * 1'000'000 bytes), G - for Gigabytes (n * 1'000'000'000
 bytes), maxRate="2k" - limit to 2 kilobytes per second.
+@li <b>maxTotalRate</b>: string (default: "0") - Limit data send throughput of
+all threads to maxTotalRate in bytes per second. maxTotalRate="0" - no limit.
+Supports the same unit suffixes as maxRate.
 @li <b>showProgress</b>: bool (default: true if stdout is a tty, false
 otherwise) - Enable or disable import progress information.
 @li <b>skipRows</b>: int (default: 0) - Skip first n rows of the data in the
@@ -1083,7 +1158,7 @@ names.
 that matches specific data file format. Can be used as base dialect and
 customized with fieldsTerminatedBy, fieldsEnclosedBy, fieldsOptionallyEnclosed,
 fieldsEscapedBy and linesTerminatedBy options. Must be one of the following
-values: default, csv, tsv, json or csv-unix.
+values: default, csv, tsv, json, csv-unix or columnar.
 @li <b>decodeColumns</b>: map (default: not set) - a map between columns names
 and SQL expressions to be applied on the loaded
 data. Column value captured in 'columns' by integer is available as user
@@ -1093,6 +1168,12 @@ Interpret the information in the input file using this character set
 encoding. characterSet set to "binary" specifies "no conversion". If not set,
 the server will use the character set indicated by the character_set_database
 system variable to interpret the information in the file.
+@li <b>useServerSideFiles</b>: bool (default: false) - If enabled and the
+server runs on this host and is allowed to read the files (see the
+secure_file_priv system variable), uncompressed files which are loaded whole are
+read directly by the server using LOAD DATA INFILE, instead of being sent
+through the connection. Other files are loaded using LOAD DATA LOCAL INFILE.
+Requires the FILE privilege.
 
 ${IMPORT_EXPORT_OCI_OPTIONS_DETAIL}
 
@@ -1109,6 +1190,13 @@ and linesTerminatedBy (LT) in following manner:
 (LT=@<LF@>, FESC=@<empty@>, FT=@<LF@>, FE=@<empty@>, FOE=false)
 @li csv-unix: fully quoted, comma-separated, lf line endings.
 (LT=@<LF@>, FESC='\', FT=",", FE='"', FOE=false)
+@li columnar: binary file written by the export table utility, values are
+stored column by column. Cannot be customized, each file is loaded whole by a
+single thread. Unless the <b>columns</b> option is given, values are loaded
+into the columns with names stored in the file, these need to exist in the
+target table and hold the same kind of data, binary or text. Values of binary
+columns are sent HEX-encoded and decoded with UNHEX(), unless the
+<b>decodeColumns</b> option specifies a transformation for them.
 
 Example input data for dialects:
 @li default:
@@ -1273,6 +1361,9 @@ Each parallel connection sets the following session variables:
  * maxRate="0" - no limit. Unit suffixes, k - for Kilobytes (n * 1'000 bytes),
  * M - for Megabytes (n * 1'000'000 bytes), G - for Gigabytes (n * 1'000'000'000
  * bytes), maxRate="2k" - limit to 2 kilobytes per second.
+ * @li <b>maxTotalRate</b>: string (default: "0") - Limit data send throughput
+ * of all threads to maxTotalRate in bytes per second. maxTotalRate="0" - no
+ * limit. Supports the same unit suffixes as maxRate.
  * @li <b>showProgress</b>: bool (default: true if stdout is a tty, false
  * otherwise) - Enable or disable import progress information.
  * @li <b>skipRows</b>: int (default: 0) - Skip first n rows of the data in the
@@ -1282,7 +1373,8 @@ Each parallel connection sets the following session variables:
  * options that matches specific data file format. Can be used as base dialect
  * and customized with fieldsTerminatedBy, fieldsEnclosedBy,
  * fieldsOptionallyEnclosed, fieldsEscapedBy and linesTerminatedBy options. Must
- * be one of the following values: default, csv, tsv, json or csv-unix.
+ * be one of the following values: default, csv, tsv, json, csv-unix or
+ * columnar.
  * @li <b>decodeColumns</b>: map (default: not set) - a map between columns names
  * and SQL expressions to be applied on the loaded
  * data. Column value captured in 'columns' by integer is available as user
@@ -1292,6 +1384,12 @@ Each parallel connection sets the following session variables:
  * encoding. characterSet set to "binary" specifies "no conversion". If not set,
  * the server will use the character set indicated by the character_set_database
  * system variable to interpret the information in the file.
+ * @li <b>useServerSideFiles</b>: bool (default: false) - If enabled and the
+ * server runs on this host and is allowed to read the files (see the
+ * secure_file_priv system variable), uncompressed files which are loaded whole
+ * are read directly by the server using LOAD DATA INFILE, instead of being sent
+ * through the connection. Other files are loaded using LOAD DATA LOCAL INFILE.
+ * Requires the FILE privilege.
  *
  * $(IMPORT_EXPORT_OCI_OPTIONS_DETAIL)
  *
@@ -1308,6 +1406,13 @@ Each parallel connection sets the following session variables:
  * (LT=@<LF@>, FESC=@<empty@>, FT=@<LF@>, FE=@<empty@>, FOE=false)
  * @li csv-unix: fully quoted, comma-separated, lf line endings.
  * (LT=@<LF@>, FESC='\', FT=",", FE='"', FOE=false)
+ * @li columnar: binary file written by the export table utility, values are
+ * stored column by column. Cannot be customized, each file is loaded whole by a
+ * single thread. Unless the <b>columns</b> option is given, values are loaded
+ * into the columns with names stored in the file, these need to exist in the
+ * target table and hold the same kind of data, binary or text. Values of binary
+ * columns are sent HEX-encoded and decoded with UNHEX(), unless the
+ * <b>decodeColumns</b> option specifies a transformation for them.
  *
  * Example input data for dialects:
  * @li default:
@@ -1570,6 +1675,13 @@ specified tables from the dump. Strings are in format schema.table or
 @li <b>excludeUsers</b>: array of strings (default not set) - Skip loading
 specified users from the dump. Strings are in format user_name (equivalent to
 'user_name'@'@%') or 'user_name'@'host'.
+@li <b>fastIngest</b>: bool (default: false) - Disables the InnoDB redo log
+and increases the innodb_log_buffer_size while the dump is loaded, original
+settings are restored once the load finishes, is interrupted or is resumed.
+The target server must not be used by other clients. An unexpected server
+stoppage during the load may cause data loss and instance corruption. Requires
+MySQL 8.0.21 or newer and the PROCESS privilege. Original settings are stored in
+the progress file, which cannot be disabled.
 @li <b>ignoreExistingObjects</b>: bool (default false) - Load the dump even if
 it contains objects that already exist in the target database.
 @li <b>ignoreVersion</b>: bool (default false) - Load the dump even if the
@@ -1592,6 +1704,15 @@ at the end of the load. Useful when loading DDL and data separately.
 @li <b>loadUsers</b>: bool (default: false) - Executes SQL scripts for user
 accounts, roles and grants contained in the dump. Note: statements for the
 current user will be skipped.
+@li <b>maxThreadsPerTable</b>: int (default: 0) - Maximum number of threads
+which load chunks of a single table with a primary key at the same time, 0 - no
+limit. If set, chunks of such tables are loaded in the ascending order of the
+primary key, which reduces the number of InnoDB page splits and results in
+smaller tables, at the cost of less parallelism within a table.
+@li <b>maxTotalRate</b>: string (default: "0") - Limit data send throughput of
+all threads to maximum rate, measured in bytes per second. Use maxTotalRate="0"
+to set no limit. Unit suffixes are supported, i.e. maxTotalRate="2M" - limit
+throughput to 2000000 bytes per second.
 @li <b>progressFile</b>: path (default: load-progress.@<server_uuid@>.progress)
 - Stores load progress information in the given local file path.
 @li <b>resetProgress</b>: bool (default: false) - Discards progress information
@@ -1604,11 +1725,19 @@ util.<<<dumpTables>>>() function.
 otherwise) - Enable or disable import progress information.
 @li <b>skipBinlog</b>: bool (default: false) - Disables the binary log
 for the MySQL sessions used by the loader (set sql_log_bin=0).
-@li <b>threads</b>: int (default: 4) - Number of threads to use to import table
-data.
+@li <b>threads</b>: int, "auto" (default: 4) - Number of threads to use to
+import table data. If set to "auto", up to 32 threads are used, their number
+is adjusted while the data is loaded, based on the load throughput and the
+server load.
 @li <b>updateGtidSet</b>: "off", "replace", "append" (default: off) - if set to
 a value other than 'off' updates GTID_PURGED by either replacing its contents
 or appending to it the gtid set present in the dump.
+@li <b>useServerSideFiles</b>: bool (default: false) - If enabled and the
+server runs on this host and is allowed to read the files of the dump (see the
+secure_file_priv system variable), uncompressed data chunks which are loaded
+whole are read directly by the server using LOAD DATA INFILE, instead of being
+sent through the connection. Other chunks are loaded using LOAD DATA LOCAL
+INFILE. Requires the FILE privilege.
 @li <b>waitDumpTimeout</b>: int (default: 0) - Loads a dump while it's still
 being created. Once all uploaded tables are processed the command will either
 wait for more data, the dump is marked as completed or the given timeout passes.
@@ -1640,6 +1769,13 @@ desired progress file (it does not need to exist), it should be located on
 the same location of the "@.manifest.json" file. Finally specify the PAR URL
 on the progressFile option.
 
+Incremental dumps, created using the <b>baseDump</b> option of the dump
+functions, need to be loaded on top of their base dump. The base dump and all
+the preceding incremental dumps must be loaded first, in the order they were
+created. Tables which have changed since the base dump are dropped and loaded
+again, tables which have not changed are not modified. Both the <b>loadDdl</b>
+and <b>loadData</b> options must be enabled when loading an incremental dump.
+
 Examples:
 
 @code
@@ -1768,6 +1904,9 @@ REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS, R"*(
 @li <b>maxRate</b>: string (default: "0") - Limit data read throughput to
 maximum rate, measured in bytes per second per thread. Use maxRate="0" to set no
 limit.
+@li <b>maxTotalRate</b>: string (default: "0") - Limit data read throughput of
+all threads to maximum rate, measured in bytes per second. Use maxTotalRate="0"
+to set no limit.
 @li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
 otherwise) - Enable or disable dump progress information.
 @li <b>defaultCharacterSet</b>: string (default: "utf8mb4") - Character set used
@@ -1804,12 +1943,25 @@ dumps.
 @li <b>dataOnly</b>: bool (default: false) - Only dump data from the database.
 @li <b>dryRun</b>: bool (default: false) - Print information about what would be
 dumped, but do not dump anything.
+@li <b>trackChanges</b>: bool (default: false) - Store checksums of the dumped
+tables, so that the dump can be used as a base of an incremental dump.
+@li <b>baseDump</b>: string (default: not set) - URL of a previous dump created
+with the <b>trackChanges</b> or <b>baseDump</b> option. If set, an incremental
+dump is created, data of tables which have not changed since the base dump is
+not dumped. Enables <b>trackChanges</b>.
 
 @li <b>chunking</b>: bool (default: true) - Enable chunking of the tables.
 @li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
 number of bytes to be written to each chunk file, enables <b>chunking</b>.
 @li <b>threads</b>: int (default: 4) - Use N threads to dump data chunks from
 the server.
+@li <b>useServerSideFiles</b>: bool (default: false) - If enabled and the server
+runs on this host and is allowed to write to the output directory (see the
+secure_file_priv system variable), data chunks are written directly by the
+server using SELECT ... INTO OUTFILE, instead of being transferred to the shell.
+Requires the FILE privilege, a local output directory and compression set to
+"none". If the shell cannot read the files written by the server, data is
+written by the shell.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_DDL_COMPRESSION, R"*(
@@ -1917,7 +2069,8 @@ index), a warning is displayed and chunking is disabled for this table.
 
 The value of the <b>threads</b> option must be a positive number.
 
-Both the <b>bytesPerChunk</b> and <b>maxRate</b> options support unit suffixes:
+The <b>bytesPerChunk</b>, <b>maxRate</b> and <b>maxTotalRate</b> options support
+unit suffixes:
 @li k - for kilobytes,
 @li M - for Megabytes,
 @li G - for Gigabytes,
@@ -2005,11 +2158,17 @@ that matches specific data file format. Can be used as base dialect and
 customized with <b>fieldsTerminatedBy</b>, <b>fieldsEnclosedBy</b>,
 <b>fieldsOptionallyEnclosed</b>, <b>fieldsEscapedBy</b> and
 <b>linesTerminatedBy</b> options. Must be one of the following values: default,
-csv, tsv or csv-unix.
+csv, tsv, csv-unix or columnar.
 
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
 @li <b>compression</b>: string (default: "none") - Compression used when writing
 the data dump files, one of: "none", "gzip", "zstd".
+@li <b>threads</b>: int (default: 1) - Use N threads to dump data chunks from
+the server. If greater than 1, table data is split into chunks which are dumped
+concurrently and then merged into the output file.
+@li <b>bytesPerChunk</b>: string (minimum: "128k", default: "64M") - Sets
+average estimated number of bytes to be dumped in each chunk, used only if
+<b>threads</b> is greater than 1.
 
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS}
 
@@ -2034,8 +2193,14 @@ and linesTerminatedBy (LT) in the following manner:
 (LT=@<CR@>@<LF@>, FESC='\', FT=@<TAB@>, FE='&quot;', FOE=true)
 @li csv-unix: fully quoted, comma-separated, LF line endings.
 (LT=@<LF@>, FESC='\', FT=",", FE='&quot;', FOE=false)
-
-The <b>maxRate</b> option supports unit suffixes:
+@li columnar: binary format, rows are split into groups and values of each
+column are stored together, using dictionary or run-length encoding where it
+reduces the size, and compressed using zstd. Cannot be customized or used
+together with the <b>compression</b> option. Values of binary columns are
+written as they are. Such files can be loaded only using the import table
+utility.
+
+The <b>maxRate</b> and <b>maxTotalRate</b> options support unit suffixes:
 @li k - for kilobytes,
 @li M - for Megabytes,
 @li G - for Gigabytes,
@@ -2339,4 +2504,152 @@ void Util::dump_instance(const std::string &directory,
   Dump_instance{opts}.run();
 }
 
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_COMPARE_COMMON_PARAMETERS, R"*(
+The <b>connectionData</b> parameter specifies the target server, the tables
+on the server the global session is connected to are compared with the tables
+on the target server.
+
+${TOPIC_CONNECTION_MORE_INFO}
+)*");
+
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_COMPARE_COMMON_OPTIONS, R"*(
+<b>The following options are supported:</b>
+@li <b>threads</b>: int (default: 4) - Use N threads to compare the data.
+@li <b>bytesPerChunk</b>: string (default: "16M") - Approximate number of bytes
+of a table compared using a single checksum query. Allowed unit suffixes - k
+(kilobytes), M (Megabytes), G (Gigabytes). Minimum value: 128k.
+)*");
+
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_COMPARE_COMMON_DETAILS, R"*(
+<b>Details</b>
+
+Each table is split into chunks using its primary key or, if it does not have
+one, its first unique index. Checksums of the chunks are computed by both
+servers and compared, only chunks with different checksums are split further,
+until the different rows are found and reported. Tables without a primary key
+and without a unique index are compared using a single checksum.
+
+Tables which are missing on the target server, or which have different columns
+on the target server, are reported as different.
+
+The compared tables should not be modified while this operation is running,
+otherwise the reported differences may be inaccurate.
+
+@throws ArgumentError in the following scenarios:
+@li If any of the input arguments contains an invalid value.
+
+@throws RuntimeError in the following scenarios:
+@li If there is no open global session.
+@li If connection to the target server cannot be established.
+@li If the compared tables are different.
+)*");
+
+REGISTER_HELP_FUNCTION(compareTables, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_COMPARETABLES, R"*(
+Compares the specified tables from the given schema with the tables on another
+server.
+
+@param schema Name of the schema that contains tables to be compared.
+@param tables List of tables to be compared.
+@param connectionData Connection data of the target server.
+@param options Optional dictionary with the comparison options.
+
+The <b>tables</b> parameter cannot be an empty list.
+
+${TOPIC_UTIL_COMPARE_COMMON_PARAMETERS}
+
+${TOPIC_UTIL_COMPARE_COMMON_OPTIONS}
+
+${TOPIC_UTIL_COMPARE_COMMON_DETAILS}
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_COMPARETABLES_BRIEF)
+ *
+ * $(UTIL_COMPARETABLES)
+ */
+#if DOXYGEN_JS
+Undefined Util::compareTables(String schema, List tables,
+                              ConnectionData connectionData,
+                              Dictionary options);
+#elif DOXYGEN_PY
+None Util::compare_tables(str schema, list tables,
+                          ConnectionData connectionData, dict options);
+#endif
+void Util::compare_tables(
+    const std::string &schema, const std::vector<std::string> &tables,
+    const mysqlshdk::db::Connection_options &connection_data,
+    const shcore::Dictionary_t &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  using mysqlsh::compare::Compare_tables;
+  using mysqlsh::compare::Compare_tables_options;
+
+  Compare_tables_options opts{schema, tables, connection_data};
+  opts.set_options(options);
+  opts.set_session(session->get_core_session());
+
+  Compare_tables{opts}.run();
+}
+
+REGISTER_HELP_FUNCTION(compareSchemas, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_COMPARESCHEMAS, R"*(
+Compares all tables from the specified schemas with the tables on another
+server.
+
+@param schemas List of schemas to be compared.
+@param connectionData Connection data of the target server.
+@param options Optional dictionary with the comparison options.
+
+The <b>schemas</b> parameter cannot be an empty list.
+
+${TOPIC_UTIL_COMPARE_COMMON_PARAMETERS}
+
+${TOPIC_UTIL_COMPARE_COMMON_OPTIONS}
+
+${TOPIC_UTIL_COMPARE_COMMON_DETAILS}
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_COMPARESCHEMAS_BRIEF)
+ *
+ * $(UTIL_COMPARESCHEMAS)
+ */
+#if DOXYGEN_JS
+Undefined Util::compareSchemas(List schemas, ConnectionData connectionData,
+                               Dictionary options);
+#elif DOXYGEN_PY
+None Util::compare_schemas(list schemas, ConnectionData connectionData,
+                           dict options);
+#endif
+void Util::compare_schemas(
+    const std::vector<std::string> &schemas,
+    const mysqlshdk::db::Connection_options &connection_data,
+    const shcore::Dictionary_t &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  using mysqlsh::compare::Compare_tables;
+  using mysqlsh::compare::Compare_tables_options;
+
+  Compare_tables_options opts{schemas, connection_data};
+  opts.set_options(options);
+  opts.set_session(session->get_core_session());
+
+  Compare_tables{opts}.run();
+}
+
 }  // namespace mysqlsh
@@ -125,6 +125,30 @@ class SHCORE_PUBLIC Util : public shcore::Cpp_object_bridge,
   void dump_instance(const std::string &directory,
                      const shcore::Dictionary_t &options);
 
+#if DOXYGEN_JS
+  Undefined compareTables(String schema, List tables,
+                          ConnectionData connectionData, Dictionary options);
+#elif DOXYGEN_PY
+  None compare_tables(str schema, list tables, ConnectionData connectionData,
+                      dict options);
+#endif
+  void compare_tables(
+      const std::string &schema, const std::vector<std::string> &tables,
+      const mysqlshdk::db::Connection_options &connection_data,
+      const shcore::Dictionary_t &options);
+
+#if DOXYGEN_JS
+  Undefined compareSchemas(List schemas, ConnectionData connectionData,
+                           Dictionary options);
+#elif DOXYGEN_PY
+  None compare_schemas(list schemas, ConnectionData connectionData,
+                       dict options);
+#endif
+  void compare_schemas(
+      const std::vector<std::string> &schemas,
+      const mysqlshdk::db::Connection_options &connection_data,
+      const shcore::Dictionary_t &options);
+
  private:
   shcore::IShell_core &_shell_core;
 };
@@ -23,12 +23,19 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <iterator>
 #include <map>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
 #include "modules/util/upgrade_check.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/libs/config/config_file.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
@@ -1329,11 +1336,25 @@ Check_table_command::Check_table_command()
 std::vector<Upgrade_issue> Check_table_command::run(
     std::shared_ptr<mysqlshdk::db::ISession> session,
     const Upgrade_check_options &opts) {
+  std::vector<Upgrade_issue> issues;
+
+  for (const auto &pair : list_tables(session, opts)) {
+    auto table_issues = check_table(session, pair.first, pair.second);
+    issues.insert(issues.end(), std::make_move_iterator(table_issues.begin()),
+                  std::make_move_iterator(table_issues.end()));
+  }
+
+  return issues;
+}
+
+Check_table_command::Table_list Check_table_command::list_tables(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const Upgrade_check_options &opts) const {
   // Needed for warnings related to triggers, incompatible types in 5.7
   if (opts.server_version < Version(8, 0, 0))
     session->execute("FLUSH LOCAL TABLES;");
 
-  std::vector<std::pair<std::string, std::string>> tables;
+  Table_list tables;
   auto result = session->query(
       "SELECT TABLE_SCHEMA, TABLE_NAME FROM "
       "INFORMATION_SCHEMA.TABLES WHERE TABLE_SCHEMA not in "
@@ -1346,34 +1367,38 @@ std::vector<Upgrade_issue> Check_table_command::run(
     }
   }
 
+  return tables;
+}
+
+std::vector<Upgrade_issue> Check_table_command::check_table(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const std::string &schema, const std::string &table) const {
   std::vector<Upgrade_issue> issues;
-  for (const auto &pair : tables) {
-    auto check_result =
-        session->query(shcore::sqlstring("CHECK TABLE !.! FOR UPGRADE;", 0)
-                       << pair.first << pair.second);
-    const mysqlshdk::db::IRow *row = nullptr;
-    while ((row = check_result->fetch_one()) != nullptr) {
-      if (row->get_string(2) == "status") continue;
-      Upgrade_issue issue;
-      std::string type = row->get_string(2);
-      if (type == "warning")
-        issue.level = Upgrade_issue::WARNING;
-      else if (type == "error")
-        issue.level = Upgrade_issue::ERROR;
-      else
-        issue.level = Upgrade_issue::NOTICE;
-      issue.schema = pair.first;
-      issue.table = pair.second;
-      issue.description = row->get_string(3);
-
-      // Native partitioning warning has been promoted to error in context of
-      // upgrade to 8.0 and is handled by the separate check
-      if (issue.description.find("use native partitioning instead.") !=
-              std::string::npos &&
-          issue.level == Upgrade_issue::WARNING)
-        continue;
-      issues.push_back(issue);
-    }
+  auto check_result =
+      session->query(shcore::sqlstring("CHECK TABLE !.! FOR UPGRADE;", 0)
+                     << schema << table);
+  const mysqlshdk::db::IRow *row = nullptr;
+  while ((row = check_result->fetch_one()) != nullptr) {
+    if (row->get_string(2) == "status") continue;
+    Upgrade_issue issue;
+    std::string type = row->get_string(2);
+    if (type == "warning")
+      issue.level = Upgrade_issue::WARNING;
+    else if (type == "error")
+      issue.level = Upgrade_issue::ERROR;
+    else
+      issue.level = Upgrade_issue::NOTICE;
+    issue.schema = schema;
+    issue.table = table;
+    issue.description = row->get_string(3);
+
+    // Native partitioning warning has been promoted to error in context of
+    // upgrade to 8.0 and is handled by the separate check
+    if (issue.description.find("use native partitioning instead.") !=
+            std::string::npos &&
+        issue.level == Upgrade_issue::WARNING)
+      continue;
+    issues.push_back(issue);
   }
 
   return issues;
@@ -1407,4 +1432,175 @@ bool register_manual_checks() {
 bool UNUSED_VARIABLE(reg_manual_checks) = register_manual_checks();
 }  // namespace
 
+Upgrade_check_runner::Upgrade_check_runner(
+    std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions,
+    const Upgrade_check_options &options)
+    : m_sessions(std::move(sessions)), m_options(options) {
+  if (m_sessions.empty()) {
+    throw std::logic_error("Upgrade checks require at least one session");
+  }
+}
+
+void Upgrade_check_runner::run(
+    const std::vector<std::unique_ptr<Upgrade_check>> &checklist,
+    const Result_callback &on_result, const Progress_callback &on_progress) {
+  using Session = std::shared_ptr<mysqlshdk::db::ISession>;
+
+  struct Task {
+    std::size_t check;
+    std::function<std::vector<Upgrade_issue>(const Session &)> execute;
+    std::vector<Upgrade_issue> issues;
+  };
+
+  struct Check_state {
+    std::size_t first_task = 0;
+    std::size_t pending = 0;
+    std::exception_ptr exception;
+  };
+
+  std::vector<Task> tasks;
+  std::vector<Check_state> states(checklist.size());
+
+  for (std::size_t i = 0; i < checklist.size(); ++i) {
+    const auto check = checklist[i].get();
+    auto &state = states[i];
+
+    state.first_task = tasks.size();
+
+    if (!check->is_runnable()) {
+      continue;
+    }
+
+    const auto check_table = dynamic_cast<Check_table_command *>(check);
+
+    if (check_table) {
+      try {
+        // tables are listed upfront, so that each one can be checked
+        // independently
+        for (auto &pair : check_table->list_tables(m_sessions[0], m_options)) {
+          tasks.emplace_back(Task{
+              i,
+              [check_table, pair = std::move(pair)](const Session &session) {
+                return check_table->check_table(session, pair.first,
+                                                pair.second);
+              },
+              {}});
+        }
+      } catch (...) {
+        state.exception = std::current_exception();
+      }
+    } else {
+      tasks.emplace_back(Task{i,
+                              [check, this](const Session &session) {
+                                return check->run(session, m_options);
+                              },
+                              {}});
+    }
+
+    state.pending = tasks.size() - state.first_task;
+  }
+
+  std::mutex mutex;
+  std::condition_variable task_finished;
+  std::atomic<std::size_t> next_task{0};
+  std::size_t finished_tasks = 0;
+
+  const auto worker = [&](const Session &session) {
+    mysqlsh::Mysql_thread mysql_thread;
+
+    for (auto idx = next_task++; idx < tasks.size(); idx = next_task++) {
+      auto &task = tasks[idx];
+      std::exception_ptr exception;
+      bool skip = false;
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        // one of the tasks of this check has already failed
+        skip = static_cast<bool>(states[task.check].exception);
+      }
+
+      if (!skip) {
+        try {
+          task.issues = task.execute(session);
+        } catch (...) {
+          exception = std::current_exception();
+        }
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &state = states[task.check];
+
+        if (exception && !state.exception) {
+          state.exception = exception;
+        }
+
+        --state.pending;
+        ++finished_tasks;
+      }
+
+      task_finished.notify_one();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  const auto threads =
+      std::min(m_sessions.size(), std::max<std::size_t>(tasks.size(), 1));
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers.emplace_back(mysqlsh::spawn_scoped_thread(worker, m_sessions[i]));
+  }
+
+  shcore::on_leave_scope join_workers([&workers, &next_task, &tasks]() {
+    // make sure no more tasks are started if the callbacks have thrown
+    next_task = tasks.size();
+
+    for (auto &w : workers) {
+      w.join();
+    }
+  });
+
+  std::size_t reported_tasks = 0;
+
+  for (std::size_t i = 0; i < checklist.size(); ++i) {
+    Upgrade_check_result result;
+
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+
+      while (true) {
+        if (on_progress && reported_tasks != finished_tasks) {
+          reported_tasks = finished_tasks;
+
+          lock.unlock();
+          on_progress(reported_tasks, tasks.size());
+          lock.lock();
+        }
+
+        if (0 == states[i].pending) {
+          break;
+        }
+
+        task_finished.wait(lock);
+      }
+
+      result.exception = states[i].exception;
+    }
+
+    if (!result.exception) {
+      // issues are concatenated in the order in which tasks were created
+      const auto end = i + 1 < checklist.size() ? states[i + 1].first_task
+                                                : tasks.size();
+
+      for (auto t = states[i].first_task; t < end; ++t) {
+        result.issues.insert(result.issues.end(),
+                             std::make_move_iterator(tasks[t].issues.begin()),
+                             std::make_move_iterator(tasks[t].issues.end()));
+      }
+    }
+
+    on_result(*checklist[i], result);
+  }
+}
+
 } /* namespace mysqlsh */
@@ -24,6 +24,7 @@
 #ifndef MODULES_UTIL_UPGRADE_CHECK_H_
 #define MODULES_UTIL_UPGRADE_CHECK_H_
 
+#include <exception>
 #include <forward_list>
 #include <functional>
 #include <map>
@@ -231,12 +232,29 @@ class Config_check : public Upgrade_check {
 
 class Check_table_command : public Upgrade_check {
  public:
+  using Table_list = std::vector<std::pair<std::string, std::string>>;
+
   Check_table_command();
 
   std::vector<Upgrade_issue> run(
       std::shared_ptr<mysqlshdk::db::ISession> session,
       const Upgrade_check_options &opts) override;
 
+  /**
+   * Prepares the server and lists all the tables which are going to be
+   * checked.
+   */
+  Table_list list_tables(
+      const std::shared_ptr<mysqlshdk::db::ISession> &session,
+      const Upgrade_check_options &opts) const;
+
+  /**
+   * Executes 'CHECK TABLE ... FOR UPGRADE' for a single table.
+   */
+  std::vector<Upgrade_issue> check_table(
+      const std::shared_ptr<mysqlshdk::db::ISession> &session,
+      const std::string &schema, const std::string &table) const;
+
   Upgrade_issue::Level get_level() const override {
     throw std::runtime_error("Unimplemented");
   }
@@ -271,6 +289,58 @@ class Manual_check : public Upgrade_check {
   Upgrade_issue::Level m_level;
 };
 
+struct Upgrade_check_result {
+  std::vector<Upgrade_issue> issues;
+  std::exception_ptr exception;
+};
+
+/**
+ * Executes the runnable checks from the given checklist using a pool of
+ * sessions, one worker thread per session. Each check is a separate task,
+ * 'CHECK TABLE ... FOR UPGRADE' is split into a task per table.
+ *
+ * Results are reported in the order of the checklist, regardless of the order
+ * in which tasks are finished.
+ */
+class Upgrade_check_runner final {
+ public:
+  using Result_callback =
+      std::function<void(const Upgrade_check &, const Upgrade_check_result &)>;
+
+  using Progress_callback =
+      std::function<void(std::size_t done, std::size_t total)>;
+
+  Upgrade_check_runner() = delete;
+
+  Upgrade_check_runner(
+      std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions,
+      const Upgrade_check_options &options);
+
+  Upgrade_check_runner(const Upgrade_check_runner &) = delete;
+  Upgrade_check_runner(Upgrade_check_runner &&) = delete;
+
+  Upgrade_check_runner &operator=(const Upgrade_check_runner &) = delete;
+  Upgrade_check_runner &operator=(Upgrade_check_runner &&) = delete;
+
+  ~Upgrade_check_runner() = default;
+
+  /**
+   * Runs the checks, callbacks are always called in the caller's thread.
+   *
+   * @param checklist Checks to be executed, manual checks are reported with
+   *        no issues.
+   * @param on_result Called once for each check, in the checklist order.
+   * @param on_progress Called each time a task is finished.
+   */
+  void run(const std::vector<std::unique_ptr<Upgrade_check>> &checklist,
+           const Result_callback &on_result,
+           const Progress_callback &on_progress = {});
+
+ private:
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> m_sessions;
+  const Upgrade_check_options &m_options;
+};
+
 } /* namespace mysqlsh */
 
 #endif  // MODULES_UTIL_UPGRADE_CHECK_H_
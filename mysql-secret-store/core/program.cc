@@ -23,7 +23,14 @@
 
 #include "mysql-secret-store/core/program.h"
 
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif  // _WIN32
+
+#include <algorithm>
 #include <iostream>
+#include <sstream>
 #include <utility>
 
 #include "mysql-secret-store/core/argument_parser.h"
@@ -32,6 +39,7 @@
 #include "mysql-secret-store/core/list_command.h"
 #include "mysql-secret-store/core/store_command.h"
 #include "mysql-secret-store/core/version_command.h"
+#include "mysql-secret-store/include/mysql-secret-store/protocol.h"
 
 namespace mysql {
 namespace secret_store {
@@ -51,6 +59,10 @@ int Program::run(int argc, char *argv[]) {
   try {
     m_helper->check_requirements();
 
+    if (2 == argc && std::string{protocol::k_serve_command} == argv[1]) {
+      return serve(&std::cin, &std::cout);
+    }
+
     Argument_parser(m_commands)
         .parse(argc, argv)
         ->execute(&std::cin, &std::cout);
@@ -62,6 +74,59 @@ int Program::run(int argc, char *argv[]) {
   }
 }
 
+int Program::serve(std::istream *input, std::ostream *output) {
+#ifdef _WIN32
+  // payload sizes are in bytes, new lines must not be translated
+  _setmode(_fileno(stdin), _O_BINARY);
+  _setmode(_fileno(stdout), _O_BINARY);
+#endif  // _WIN32
+
+  *output << protocol::k_ready << '\n' << std::flush;
+
+  std::string header;
+
+  while (std::getline(*input, header)) {
+    std::string name;
+    std::size_t size = 0;
+
+    if (!(std::istringstream{header} >> name >> size)) {
+      throw std::runtime_error{"Malformed request: '" + header + "'"};
+    }
+
+    std::string payload(size, '\0');
+
+    if (size > 0 && !input->read(&payload[0], size)) {
+      throw std::runtime_error{"Truncated request"};
+    }
+
+    std::istringstream request{payload};
+    std::ostringstream response;
+    int status = 0;
+
+    try {
+      const auto command =
+          std::find_if(std::begin(m_commands), std::end(m_commands),
+                       [&name](const std::unique_ptr<Command> &c) {
+                         return c->name() == name;
+                       });
+
+      if (command == m_commands.end()) {
+        throw std::runtime_error{"Unknown command: '" + name + "'"};
+      }
+
+      (*command)->execute(&request, &response);
+    } catch (const std::exception &ex) {
+      status = 1;
+      response.str(ex.what());
+    }
+
+    const auto body = response.str();
+    *output << status << ' ' << body.length() << '\n' << body << std::flush;
+  }
+
+  return 0;
+}
+
 }  // namespace core
 }  // namespace secret_store
 }  // namespace mysql
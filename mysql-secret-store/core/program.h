@@ -24,7 +24,9 @@
 #ifndef MYSQL_SECRET_STORE_CORE_PROGRAM_H_
 #define MYSQL_SECRET_STORE_CORE_PROGRAM_H_
 
+#include <istream>
 #include <memory>
+#include <ostream>
 #include <vector>
 
 #include "mysql-secret-store/include/helper.h"
@@ -47,6 +49,8 @@ class Program {
   int run(int argc, char *argv[]);
 
  private:
+  int serve(std::istream *input, std::ostream *output);
+
   std::unique_ptr<common::Helper> m_helper;
   std::vector<std::unique_ptr<Command>> m_commands;
 };
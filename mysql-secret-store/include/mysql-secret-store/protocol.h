@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQL_SECRET_STORE_INCLUDE_MYSQL_SECRET_STORE_PROTOCOL_H_
+#define MYSQL_SECRET_STORE_INCLUDE_MYSQL_SECRET_STORE_PROTOCOL_H_
+
+namespace mysql {
+namespace secret_store {
+namespace protocol {
+
+/**
+ * Command which makes a helper serve requests until its standard input is
+ * closed, instead of executing a single command.
+ *
+ * Once ready, the helper writes the k_ready line. Each request is then
+ * written to its standard input as:
+ *
+ *   <command> <payload size>\n<payload>
+ *
+ * and the helper replies on its standard output with:
+ *
+ *   <status> <payload size>\n<payload>
+ *
+ * Status is 0 if the command succeeded, in which case payload holds what the
+ * command would have written if invoked on its own, otherwise payload holds
+ * the error message.
+ */
+constexpr auto k_serve_command = "serve";
+
+/**
+ * Line written by a helper once it's ready to serve requests, includes the
+ * version of the protocol.
+ */
+constexpr auto k_ready = "ready 1";
+
+}  // namespace protocol
+}  // namespace secret_store
+}  // namespace mysql
+
+#endif  // MYSQL_SECRET_STORE_INCLUDE_MYSQL_SECRET_STORE_PROTOCOL_H_
@@ -165,9 +165,16 @@ struct Parameter final {
   std::unique_ptr<Parameter_validator> m_validator;
 };
 
+class Cpp_object_bridge;
+
 class SHCORE_PUBLIC Cpp_function : public Function_base {
  public:
   typedef std::function<Value(const shcore::Argument_list &)> Function;
+  // Function which is not bound to any object, the object is provided when
+  // the function is invoked
+  typedef std::function<Value(Cpp_object_bridge *,
+                              const shcore::Argument_list &)>
+      Method;
 
   const std::string &name() const override;
   virtual const std::string &name(const NamingStyle &style) const;
@@ -217,14 +224,25 @@ class SHCORE_PUBLIC Cpp_function : public Function_base {
                const std::vector<std::pair<std::string, Value_type>>
                    &signature);  // delme
   Cpp_function(const Metadata *meta, const Function &func);
+  // creates a function which owns its metadata
+  Cpp_function() : _meta(&_meta_tmp) {}
 
   const Raw_signature &function_signature() const { return _meta->signature; }
 
   const Metadata *get_metadata() const { return _meta; }
 
+  bool is_bound() const { return !_method; }
+
+  /**
+   * Invokes the function, if it's not bound to an object, it's going to be
+   * invoked on the given one.
+   */
+  Value invoke(Cpp_object_bridge *object, const Argument_list &args);
+
  private:
   // Each instance holds it's names on the different styles
   Function _func;
+  Method _method;
 
   const Metadata *_meta;
   Metadata _meta_tmp;  // temporary memory for legacy versions of Cpp_function
@@ -232,7 +250,16 @@ class SHCORE_PUBLIC Cpp_function : public Function_base {
 
 class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
  protected:
+  using Function_map =
+      std::multimap<std::string, std::shared_ptr<Cpp_function>>;
+
   Cpp_object_bridge();
+  /**
+   * Creates an object which uses the given method table, shared by all the
+   * instances of a class, instead of exposing its methods in the constructor.
+   * The table needs to be created with make_method_table().
+   */
+  explicit Cpp_object_bridge(const std::shared_ptr<Function_map> &methods);
   Cpp_object_bridge(const Cpp_object_bridge &) = delete;
 
  public:
@@ -284,7 +311,13 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
 
  protected:
   void detect_overload_conflicts(const std::string &name,
-                                 const Cpp_function::Metadata &md);
+                                 const Cpp_function::Metadata &md) const {
+    detect_overload_conflicts(*_funcs, name, md);
+  }
+
+  static void detect_overload_conflicts(const Function_map &funcs,
+                                        const std::string &name,
+                                        const Cpp_function::Metadata &md);
 
   /**
    * exposes a function defined either in JavaScript or Python
@@ -304,7 +337,7 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
 
     std::string registered_name = name.substr(0, name.find("|"));
     detect_overload_conflicts(registered_name, md);
-    _funcs.emplace(std::make_pair(
+    own_funcs().emplace(std::make_pair(
         registered_name,
         std::shared_ptr<Cpp_function>(new Cpp_function(
             &md,
@@ -784,6 +817,53 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
     return to_function_t<decltype(&L::operator())>(std::forward<L>(l));
   }
 
+  /**
+   * Creates a method table to be shared by all the instances of a class, which
+   * already holds the methods common to all objects.
+   *
+   * Methods exposed in such table are not bound to any object and receive the
+   * instance they are called on, so objects using it do not need to expose
+   * their methods in the constructor.
+   */
+  static std::shared_ptr<Function_map> make_method_table();
+
+  /**
+   * Exposes a method with automatic bridging in a table created by
+   * make_method_table(). Optional parameters use the default values of their
+   * types.
+   */
+  template <typename R, typename C, typename... A, typename... D>
+  static Cpp_function::Metadata *expose(Function_map *table,
+                                        const std::string &name,
+                                        R (C::*func)(A...), const D &... docs) {
+    return expose_shared_<R, A...>(
+        table, name,
+        [func](Cpp_object_bridge *object, A... args) -> R {
+          return (static_cast<C *>(object)->*func)(args...);
+        },
+        {docs...});
+  }
+
+  template <typename R, typename C, typename... A, typename... D>
+  static Cpp_function::Metadata *expose(Function_map *table,
+                                        const std::string &name,
+                                        R (C::*func)(A...) const,
+                                        const D &... docs) {
+    return expose_shared_<R, A...>(
+        table, name,
+        [func](Cpp_object_bridge *object, A... args) -> R {
+          return (static_cast<const C *>(object)->*func)(args...);
+        },
+        {docs...});
+  }
+
+  /**
+   * Adds the getter of a property to a table created by make_method_table(),
+   * the property itself still needs to be added with add_property().
+   */
+  static void add_property_getter(Function_map *table, const std::string &name,
+                                  const std::string &getter);
+
   // delme
   void add_method_(const std::string &name, Cpp_function::Function func,
                    std::vector<std::pair<std::string, Value_type>> *signature);
@@ -849,7 +929,16 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
   template <typename T>
   using to_function_t = typename to_function<T>::type;
 
-  std::multimap<std::string, std::shared_ptr<Cpp_function>> _funcs;
+  std::shared_ptr<Function_map> _funcs;
+  // whether _funcs is shared with other instances
+  bool _funcs_shared = false;
+
+  // Returns the functions of this instance, copying the shared table first
+  Function_map &own_funcs();
+
+  // Returns a function which can be called without an object
+  std::shared_ptr<Cpp_function> bind(
+      const std::shared_ptr<Cpp_function> &func) const;
 
   // Returns the base name of the given member
   std::string get_base_name(const std::string &member) const;
@@ -943,8 +1032,6 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
     }
 #endif  // NDEBUG
 
-    const auto size = docs.size();
-
     auto mangled_name = class_name() + "::" + name + ":";
     // fold expressions are available in C++17, use std::initializer_list +
     // comma operator trick instead
@@ -952,33 +1039,12 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
         (mangled_name.append(Type_info<A>::code()), 0)...};
     auto &md = get_metadata(mangled_name);
 
-    if (md.name[0].empty()) {
-      std::vector<std::pair<std::string, Value_type>> ptypes;
-      std::vector<Value_type> vtypes = {Type_info<A>::vtype()...};
-
-      for (size_t i = 0; i < size; ++i) {
-        ptypes.emplace_back(docs[i], vtypes[i]);
-      }
-
-      set_metadata(md, name, Type_info<R>::vtype(), ptypes);
-    }
-
-    {
-      std::vector<std::unique_ptr<Parameter_validator>> validators;
-      (void)std::initializer_list<int>{
-          (validators.emplace_back(Type_info<A>::validator()), 0)...};
-
-      for (size_t i = 0; i < size; ++i) {
-        if (validators[i]) {
-          md.signature[i]->set_validator(std::move(validators[i]));
-        }
-      }
-    }
+    init_metadata<R, A...>(&md, name, docs);
 
     const auto registered_name = name.substr(0, name.find("|"));
     detect_overload_conflicts(registered_name, md);
 
-    _funcs.emplace(
+    own_funcs().emplace(
         registered_name,
         std::shared_ptr<Cpp_function>(
             new Cpp_function(&md, [&md, func = std::forward<F>(func),
@@ -1001,6 +1067,83 @@ class SHCORE_PUBLIC Cpp_object_bridge : public Object_bridge {
     return &md;
   }
 
+  template <typename R, typename... A>
+  static void init_metadata(Cpp_function::Metadata *md, const std::string &name,
+                            const std::vector<std::string> &docs) {
+    const auto size = docs.size();
+
+    if (md->name[0].empty()) {
+      std::vector<std::pair<std::string, Value_type>> ptypes;
+      std::vector<Value_type> vtypes = {Type_info<A>::vtype()...};
+
+      for (size_t i = 0; i < size; ++i) {
+        ptypes.emplace_back(docs[i], vtypes[i]);
+      }
+
+      set_metadata(*md, name, Type_info<R>::vtype(), ptypes);
+    }
+
+    {
+      std::vector<std::unique_ptr<Parameter_validator>> validators;
+      (void)std::initializer_list<int>{
+          (validators.emplace_back(Type_info<A>::validator()), 0)...};
+
+      for (size_t i = 0; i < size; ++i) {
+        if (validators[i]) {
+          md->signature[i]->set_validator(std::move(validators[i]));
+        }
+      }
+    }
+  }
+
+  /**
+   * Counterpart of expose__() for the shared method tables: the function is
+   * not bound to any object and owns its metadata, as the table outlives the
+   * objects which use it.
+   */
+  template <typename R, typename... A, typename F>
+  static Cpp_function::Metadata *expose_shared_(
+      Function_map *table, const std::string &name, F &&func,
+      const std::vector<std::string> &docs) {
+    assert(table);
+    assert(!name.empty());
+    assert(docs.size() == sizeof...(A));
+
+    std::shared_ptr<Cpp_function> function(new Cpp_function());
+    const auto md = &function->_meta_tmp;
+
+    init_metadata<R, A...>(md, name, docs);
+
+    const auto registered_name = name.substr(0, name.find("|"));
+    detect_overload_conflicts(*table, registered_name, *md);
+
+    function->_method =
+        [md, func = std::forward<F>(func),
+         defs = std::tuple<Type_info_t<A>...>(
+             Type_info<A>::default_value()...)](
+            Cpp_object_bridge *object, const shcore::Argument_list &args) {
+          // Executes parameter validators
+          for (size_t index = 0, count = args.size(); index < count; ++index) {
+            Parameter_context context{
+                "", {{"Argument", static_cast<int>(index + 1)}}};
+            md->signature[index]->validate(args[index], &context);
+          }
+
+          const auto bound = [object, &func](A... a) -> R {
+            return func(object, a...);
+          };
+
+          return detail::Result_wrapper<R>::call([&bound, &args, &defs]() {
+            return call<R, decltype(bound), A...>(
+                bound, args, defs, std::index_sequence_for<A...>{});
+          });
+        };
+
+    table->emplace(registered_name, std::move(function));
+
+    return md;
+  }
+
   // helper method which allows to bind position in template parameter pack with
   // parameter pack expansion
   template <typename R, typename F, typename... A, size_t... I>
@@ -112,6 +112,9 @@ class SHCORE_PUBLIC ShellBaseSession : public shcore::Cpp_object_bridge {
 
   std::function<void(const std::string &, bool exists)> update_schema_cache;
 
+  static std::string sub_query_placeholders(const std::string &query,
+                                            const shcore::Array_t &args);
+
  protected:
   std::string get_quoted_name(const std::string &name);
   // TODO(rennox): Note that these are now stored on the low level session
@@ -138,9 +141,6 @@ class SHCORE_PUBLIC ShellBaseSession : public shcore::Cpp_object_bridge {
   // mutable std::shared_ptr<shcore::Value::Map_type> _schemas;
   // std::function<void(const std::string&, bool exists)> update_schema_cache;
 
-  std::string sub_query_placeholders(const std::string &query,
-                                     const shcore::Array_t &args);
-
   int _tx_deep;
 
  private:
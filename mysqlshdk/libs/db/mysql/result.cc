@@ -256,6 +256,17 @@ void Result::rewind() {
 }
 
 std::unique_ptr<Warning> Result::fetch_one_warning() {
+  fetch_warnings();
+
+  if (!_warnings.empty()) {
+    auto tmp = std::move(_warnings.front());
+    _warnings.pop_front();
+    return tmp;
+  }
+  return {};
+}
+
+void Result::fetch_warnings() {
   if (_warning_count && !_fetched_warnings) {
     _fetched_warnings = true;
     if (auto s = _session.lock()) {
@@ -278,13 +289,6 @@ std::unique_ptr<Warning> Result::fetch_one_warning() {
       }
     }
   }
-
-  if (!_warnings.empty()) {
-    auto tmp = std::move(_warnings.front());
-    _warnings.pop_front();
-    return tmp;
-  }
-  return {};
 }
 
 void Result::reset(std::shared_ptr<MYSQL_RES> res) {
@@ -311,6 +315,14 @@ void Result::buffer() {
   pre_fetch_rows(true);
 }
 
+void Result::buffer_and_detach() {
+  buffer();
+  fetch_warnings();
+
+  _session.reset();
+  _result.reset();
+}
+
 bool Result::pre_fetch_rows(bool persistent) {
   auto result = _result.lock();
   if (result) {
@@ -72,6 +72,14 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
 
   bool is_buffered() { return m_buffered; }
 
+  /**
+   * Buffers rows and warnings of the current result set and detaches the
+   * result from the session, so that the session can be used to execute other
+   * queries (possibly by another thread) while this result is being read.
+   * Remaining result sets are discarded by the next query.
+   */
+  void buffer_and_detach();
+
  protected:
   Result(std::shared_ptr<mysqlshdk::db::mysql::Session_impl> owner,
          uint64_t affected_rows, unsigned int warning_count,
@@ -88,6 +96,8 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   bool pre_fetch_rows(bool persistent);
   void stop_pre_fetch();
 
+  void fetch_warnings();
+
   void fetch_metadata();
   Type map_data_type(int raw_type, int flags);
 
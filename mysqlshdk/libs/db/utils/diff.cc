@@ -161,6 +161,41 @@ int compare(const IRow &lrow, const IRow &rrow,
   return difference;
 }
 
+/*
+ * Compare 2 rows to determine relative ordering, considering their key values
+ * in the order given by key_fields
+ *
+ * @param  lrow        row to compare
+ * @param  rrow        row to be compared with
+ * @param  key_fields  list of column indexes for the key, in the key order
+ * @return             -2, -1, 0, +1, +2
+ *
+ * Return values are the same as in the version which takes a mask of key
+ * fields, but the key values are compared in the order of key_fields, which
+ * needs to match the order of the sorted rows. NULL values are sorted first,
+ * like in ORDER BY ... ASC.
+ */
+static int compare_ordered_keys(const IRow &lrow, const IRow &rrow,
+                                const std::vector<uint32_t> &key_fields) {
+  assert(lrow.num_fields() == rrow.num_fields());
+
+  for (const auto i : key_fields) {
+    const auto lnull = lrow.is_null(i);
+    const auto rnull = rrow.is_null(i);
+
+    if (lnull || rnull) {
+      if (lnull != rnull) return lnull ? -2 : 2;
+      continue;
+    }
+
+    const auto r = compare_field(lrow, rrow, i);
+    if (r != 0) return r < 0 ? -2 : 2;
+  }
+
+  const auto r = compare(lrow, rrow);
+  return r < 0 ? -1 : (r > 0 ? 1 : 0);
+}
+
 size_t find_different_row_fields(const IRow &lrow, const IRow &rrow,
                                  std::function<bool(int)> callback) {
   assert(lrow.num_fields() == rrow.num_fields());
@@ -289,9 +324,9 @@ size_t find_different_rows(
   return count;
 }
 
-template <typename Row_type, typename Get_row>
+template <typename Row_type, typename Compare, typename Get_row>
 static size_t find_different_rows(
-    IResult *left, IResult *right, const std::vector<bool> &keys,
+    IResult *left, IResult *right, Compare compare_rows,
     std::function<bool(const Row_type, const Row_type, Row_difference)>
         callback,
     bool call_on_identical, Get_row get_row) {
@@ -301,7 +336,7 @@ static size_t find_different_rows(
   auto lrow = get_row(left);
   auto rrow = get_row(right);
   while (lrow || rrow) {
-    int d = !lrow ? 2 : (!rrow ? -2 : compare(*lrow, *rrow, keys));
+    int d = !lrow ? 2 : (!rrow ? -2 : compare_rows(*lrow, *rrow));
     ++count;
     switch (d) {
       case 0:
@@ -341,6 +376,9 @@ static size_t find_different_rows(
  * key fields are the same, the rows are considered to be the same and will
  * be compared field by field. Otherwise, they're considered different rows.
  *
+ * Both results need to be sorted by the key fields, in the order in which they
+ * are given in key_fields, with NULL values first.
+ *
  * @param  left         Result to be compared
  * @param  right        Result to be compared with
  * @param  key_fields   List of column indexes for the row ids
@@ -355,15 +393,17 @@ size_t find_different_rows_with_key_indexes(
   if (left->get_metadata() != right->get_metadata())
     throw std::invalid_argument("Compared results have different fields");
 
-  std::vector<bool> keys(left->get_metadata().size(), false);
   for (auto i : key_fields) {
-    if (i >= keys.size())
+    if (i >= left->get_metadata().size())
       throw std::invalid_argument("Invalid key_field index value");
-    keys[i] = true;
   }
 
   return find_different_rows(
-      left, right, keys, callback, call_on_identical,
+      left, right,
+      [&key_fields](const IRow &l, const IRow &r) {
+        return compare_ordered_keys(l, r, key_fields);
+      },
+      callback, call_on_identical,
       [](IResult *result) { return result->fetch_one(); });
 }
 
@@ -392,7 +432,9 @@ size_t find_different_rows_with_key_names(
     throw std::invalid_argument("Invalid value in key_field_name");
 
   return find_different_rows(
-      left, right, keys, callback, call_on_identical,
+      left, right,
+      [&keys](const IRow &l, const IRow &r) { return compare(l, r, keys); },
+      callback, call_on_identical,
       [](IResult *result) { return result->fetch_one(); });
 }
 
@@ -423,7 +465,9 @@ size_t find_different_rows_with_key_names(
     throw std::invalid_argument("Invalid value in key_field_names");
 
   return find_different_rows(
-      left, right, keys, callback, call_on_identical,
+      left, right,
+      [&keys](const IRow &l, const IRow &r) { return compare(l, r, keys); },
+      callback, call_on_identical,
       [](IResult *result) { return result->fetch_one_named(); });
 }
 
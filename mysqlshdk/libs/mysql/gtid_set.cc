@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/mysql/gtid_set.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
+
+namespace mysqlshdk {
+namespace mysql {
+
+namespace {
+
+using Intervals = std::vector<Gtid_set::Interval>;
+
+// server uses half-open intervals, INT64_MAX is the end of the last one
+constexpr uint64_t k_max_gno = INT64_MAX - 1;
+
+class Gtid_set_parser final {
+ public:
+  explicit Gtid_set_parser(const std::string &gtid_set) : m_text(gtid_set) {}
+
+  std::map<std::string, Intervals> parse() {
+    std::map<std::string, Intervals> result;
+
+    while (true) {
+      skip_whitespace();
+
+      // empty elements are ignored
+      while (consume(',')) skip_whitespace();
+
+      if (at_end()) break;
+
+      auto &intervals = result[parse_uuid()];
+
+      skip_whitespace();
+
+      while (consume(':')) {
+        skip_whitespace();
+        const auto first = parse_gno();
+        auto last = first;
+        skip_whitespace();
+
+        if (consume('-')) {
+          skip_whitespace();
+          last = parse_gno();
+          skip_whitespace();
+        }
+
+        // same as in the server, empty intervals are silently ignored
+        if (first <= last) intervals.emplace_back(first, last);
+      }
+
+      if (!at_end() && !consume(',')) error();
+    }
+
+    return result;
+  }
+
+ private:
+  bool at_end() const { return m_pos >= m_text.length(); }
+
+  bool consume(char c) {
+    if (!at_end() && m_text[m_pos] == c) {
+      ++m_pos;
+      return true;
+    }
+
+    return false;
+  }
+
+  void skip_whitespace() {
+    while (!at_end() && std::isspace(static_cast<unsigned char>(m_text[m_pos])))
+      ++m_pos;
+  }
+
+  std::string parse_uuid() {
+    const auto begin = m_pos;
+
+    while (!at_end() && m_text[m_pos] != ':' && m_text[m_pos] != ',' &&
+           !std::isspace(static_cast<unsigned char>(m_text[m_pos])))
+      ++m_pos;
+
+    auto uuid = m_text.substr(begin, m_pos - begin);
+
+    // UUID can be enclosed in braces
+    if (uuid.length() > 2 && '{' == uuid.front() && '}' == uuid.back()) {
+      uuid = uuid.substr(1, uuid.length() - 2);
+    }
+
+    // UUID can be specified without dashes
+    if (32 == uuid.length()) {
+      for (const auto pos : {8, 13, 18, 23}) {
+        uuid.insert(pos, 1, '-');
+      }
+    }
+
+    if (36 != uuid.length()) error();
+
+    for (std::size_t i = 0; i < uuid.length(); ++i) {
+      if (8 == i || 13 == i || 18 == i || 23 == i) {
+        if ('-' != uuid[i]) error();
+      } else if (std::isxdigit(static_cast<unsigned char>(uuid[i]))) {
+        uuid[i] = std::tolower(static_cast<unsigned char>(uuid[i]));
+      } else {
+        error();
+      }
+    }
+
+    return uuid;
+  }
+
+  uint64_t parse_gno() {
+    uint64_t gno = 0;
+    const auto begin = m_pos;
+
+    while (!at_end() &&
+           std::isdigit(static_cast<unsigned char>(m_text[m_pos]))) {
+      const uint64_t digit = m_text[m_pos++] - '0';
+
+      if (gno > (k_max_gno - digit) / 10) error();
+
+      gno = gno * 10 + digit;
+    }
+
+    if (begin == m_pos || 0 == gno) error();
+
+    return gno;
+  }
+
+  [[noreturn]] void error() const {
+    throw std::invalid_argument("Malformed GTID set specification '" +
+                                m_text + "'.");
+  }
+
+  const std::string &m_text;
+  std::size_t m_pos = 0;
+};
+
+void normalize(Intervals *intervals) {
+  if (intervals->empty()) return;
+
+  std::sort(intervals->begin(), intervals->end());
+
+  auto current = intervals->begin();
+
+  for (auto it = std::next(current); it != intervals->end(); ++it) {
+    // merge overlapping and adjacent intervals
+    if (it->first <= current->second + 1) {
+      current->second = std::max(current->second, it->second);
+    } else {
+      *(++current) = *it;
+    }
+  }
+
+  intervals->erase(std::next(current), intervals->end());
+}
+
+Intervals subtract(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto it = b.begin();
+
+  for (const auto &interval : a) {
+    auto first = interval.first;
+    const auto last = interval.second;
+    bool removed = false;
+
+    // skip intervals which are before the current one
+    while (it != b.end() && it->second < first) ++it;
+
+    for (auto sub = it; sub != b.end() && sub->first <= last; ++sub) {
+      if (sub->first > first) result.emplace_back(first, sub->first - 1);
+
+      if (sub->second >= last) {
+        removed = true;
+        break;
+      }
+
+      first = sub->second + 1;
+    }
+
+    if (!removed) result.emplace_back(first, last);
+  }
+
+  return result;
+}
+
+Intervals intersect(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto it_a = a.begin();
+  auto it_b = b.begin();
+
+  while (it_a != a.end() && it_b != b.end()) {
+    const auto first = std::max(it_a->first, it_b->first);
+    const auto last = std::min(it_a->second, it_b->second);
+
+    if (first <= last) result.emplace_back(first, last);
+
+    if (it_a->second < it_b->second) {
+      ++it_a;
+    } else {
+      ++it_b;
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
+Gtid_set Gtid_set::from_string(const std::string &gtid_set) {
+  Gtid_set result;
+
+  result.m_intervals = Gtid_set_parser(gtid_set).parse();
+
+  for (auto it = result.m_intervals.begin(); it != result.m_intervals.end();) {
+    normalize(&it->second);
+
+    if (it->second.empty()) {
+      it = result.m_intervals.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  return result;
+}
+
+std::string Gtid_set::str() const {
+  std::string result;
+
+  for (const auto &uuid : m_intervals) {
+    if (!result.empty()) result += ",\n";
+
+    result += uuid.first;
+
+    for (const auto &interval : uuid.second) {
+      result += ':';
+      result += std::to_string(interval.first);
+
+      if (interval.second != interval.first) {
+        result += '-';
+        result += std::to_string(interval.second);
+      }
+    }
+  }
+
+  return result;
+}
+
+uint64_t Gtid_set::count() const {
+  uint64_t result = 0;
+
+  for (const auto &uuid : m_intervals) {
+    for (const auto &interval : uuid.second) {
+      result += interval.second - interval.first + 1;
+    }
+  }
+
+  return result;
+}
+
+Gtid_set &Gtid_set::add(const Gtid_set &other) {
+  for (const auto &uuid : other.m_intervals) {
+    auto &intervals = m_intervals[uuid.first];
+    intervals.insert(intervals.end(), uuid.second.begin(), uuid.second.end());
+    normalize(&intervals);
+  }
+
+  return *this;
+}
+
+Gtid_set &Gtid_set::subtract(const Gtid_set &other) {
+  for (const auto &uuid : other.m_intervals) {
+    const auto it = m_intervals.find(uuid.first);
+
+    if (m_intervals.end() != it) {
+      it->second = mysql::subtract(it->second, uuid.second);
+
+      if (it->second.empty()) m_intervals.erase(it);
+    }
+  }
+
+  return *this;
+}
+
+Gtid_set &Gtid_set::intersect(const Gtid_set &other) {
+  for (auto it = m_intervals.begin(); it != m_intervals.end();) {
+    const auto o = other.m_intervals.find(it->first);
+
+    if (other.m_intervals.end() != o) {
+      it->second = mysql::intersect(it->second, o->second);
+    } else {
+      it->second.clear();
+    }
+
+    if (it->second.empty()) {
+      it = m_intervals.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  return *this;
+}
+
+bool Gtid_set::contains(const Gtid_set &other) const {
+  for (const auto &uuid : other.m_intervals) {
+    const auto it = m_intervals.find(uuid.first);
+
+    if (m_intervals.end() == it ||
+        !mysql::subtract(uuid.second, it->second).empty()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool Gtid_set::intersects(const Gtid_set &other) const {
+  for (const auto &uuid : other.m_intervals) {
+    const auto it = m_intervals.find(uuid.first);
+
+    if (m_intervals.end() != it &&
+        !mysql::intersect(uuid.second, it->second).empty()) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace mysql
+}  // namespace mysqlshdk
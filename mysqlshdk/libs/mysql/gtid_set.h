@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_MYSQL_GTID_SET_H_
+#define MYSQLSHDK_LIBS_MYSQL_GTID_SET_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mysqlshdk {
+namespace mysql {
+
+/**
+ * A set of GTIDs, evaluated on the client side.
+ *
+ * Results of the operations and the textual representation match the ones of
+ * the GTID_SUBTRACT() and GTID_SUBSET() server functions, so that GTID sets
+ * of many instances can be compared without querying the server.
+ */
+class Gtid_set final {
+ public:
+  /**
+   * Closed interval of transaction numbers: [first, last].
+   */
+  using Interval = std::pair<uint64_t, uint64_t>;
+
+  Gtid_set() = default;
+
+  Gtid_set(const Gtid_set &) = default;
+  Gtid_set(Gtid_set &&) = default;
+
+  Gtid_set &operator=(const Gtid_set &) = default;
+  Gtid_set &operator=(Gtid_set &&) = default;
+
+  ~Gtid_set() = default;
+
+  /**
+   * Parses the textual representation of a GTID set.
+   *
+   * @param gtid_set GTID set, i.e. "uuid:1-5:7,uuid2:3".
+   *
+   * @returns parsed set
+   *
+   * @throws std::invalid_argument if the GTID set is malformed.
+   */
+  static Gtid_set from_string(const std::string &gtid_set);
+
+  /**
+   * Provides the normalized textual representation of this set, in the same
+   * format as used by the server.
+   */
+  std::string str() const;
+
+  bool empty() const { return m_intervals.empty(); }
+
+  /**
+   * Number of transactions in this set.
+   */
+  uint64_t count() const;
+
+  /**
+   * Adds all the transactions of the other set to this one.
+   */
+  Gtid_set &add(const Gtid_set &other);
+
+  /**
+   * Removes all the transactions of the other set from this one.
+   */
+  Gtid_set &subtract(const Gtid_set &other);
+
+  /**
+   * Keeps only the transactions which also belong to the other set.
+   */
+  Gtid_set &intersect(const Gtid_set &other);
+
+  /**
+   * Checks if all the transactions of the other set belong to this one.
+   */
+  bool contains(const Gtid_set &other) const;
+
+  /**
+   * Checks if this set has any transactions in common with the other one.
+   */
+  bool intersects(const Gtid_set &other) const;
+
+  bool operator==(const Gtid_set &other) const {
+    return m_intervals == other.m_intervals;
+  }
+
+  bool operator!=(const Gtid_set &other) const { return !(*this == other); }
+
+ private:
+  // intervals of each UUID are sorted, they do not overlap and are not
+  // adjacent
+  std::map<std::string, std::vector<Interval>> m_intervals;
+};
+
+}  // namespace mysql
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_MYSQL_GTID_SET_H_
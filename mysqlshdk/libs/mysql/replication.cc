@@ -26,6 +26,7 @@
 #include <random>
 #include <string>
 #include <vector>
+#include "mysqlshdk/libs/mysql/gtid_set.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/utils/structured_text.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -650,26 +651,7 @@ bool wait_for_gtid_set_from(const mysqlshdk::mysql::IInstance &target,
 }
 
 size_t estimate_gtid_set_size(const std::string &gtid_set) {
-  size_t count = 0;
-  shcore::str_itersplit(
-      gtid_set,
-      [&count](const std::string &s) {
-        size_t p = s.find(':');
-        if (p != std::string::npos) {
-          size_t begin, end;
-          switch (sscanf(&s[p + 1], "%zu-%zu", &begin, &end)) {
-            case 2:
-              count += end - begin + 1;
-              break;
-            case 1:
-              count++;
-              break;
-          }
-        }
-        return true;
-      },
-      ",");
-  return count;
+  return Gtid_set::from_string(gtid_set).count();
 }
 
 std::string get_executed_gtid_set(const mysqlshdk::mysql::IInstance &server) {
@@ -704,8 +686,7 @@ std::string get_total_gtid_set(
           "))), '')");
 }
 
-Gtid_set_relation compare_gtid_sets(const mysqlshdk::mysql::IInstance &server,
-                                    const std::string &gtidset_a,
+Gtid_set_relation compare_gtid_sets(const std::string &gtidset_a,
                                     const std::string &gtidset_b,
                                     std::string *out_missing_from_a,
                                     std::string *out_missing_from_b) {
@@ -721,17 +702,14 @@ Gtid_set_relation compare_gtid_sets(const mysqlshdk::mysql::IInstance &server,
     return Gtid_set_relation::CONTAINS;
   }
 
-  // Set some session tempvars for caching
-  server.executef("SET @gtidset_a=?", gtidset_a);
-  server.executef("SET @gtidset_b=?", gtidset_b);
+  const auto set_a = Gtid_set::from_string(gtidset_a);
+  const auto set_b = Gtid_set::from_string(gtidset_b);
 
-  std::string a_sub_b = server.queryf_one_string(
-      0, "", "SELECT GTID_SUBTRACT(@gtidset_a, @gtidset_b)");
-  std::string b_sub_a = server.queryf_one_string(
-      0, "", "SELECT GTID_SUBTRACT(@gtidset_b, @gtidset_a)");
+  const auto a_sub_b = Gtid_set(set_a).subtract(set_b);
+  const auto b_sub_a = Gtid_set(set_b).subtract(set_a);
 
-  if (out_missing_from_a) *out_missing_from_a = b_sub_a;
-  if (out_missing_from_b) *out_missing_from_b = a_sub_b;
+  if (out_missing_from_a) *out_missing_from_a = b_sub_a.str();
+  if (out_missing_from_b) *out_missing_from_b = a_sub_b.str();
 
   if (a_sub_b.empty() && b_sub_a.empty()) {
     return Gtid_set_relation::EQUAL;
@@ -739,15 +717,10 @@ Gtid_set_relation compare_gtid_sets(const mysqlshdk::mysql::IInstance &server,
     return Gtid_set_relation::CONTAINED;
   } else if (!a_sub_b.empty() && b_sub_a.empty()) {
     return Gtid_set_relation::CONTAINS;
+  } else if (set_a.intersects(set_b)) {
+    return Gtid_set_relation::INTERSECTS;
   } else {
-    std::string ab_intersection =
-        server.queryf_one_string(0, "",
-                                 "SELECT GTID_SUBTRACT(@gtidset_a, "
-                                 "GTID_SUBTRACT(@gtidset_a, @gtidset_b))");
-    if (ab_intersection.empty())
-      return Gtid_set_relation::DISJOINT;
-    else
-      return Gtid_set_relation::INTERSECTS;
+    return Gtid_set_relation::DISJOINT;
   }
 }
 
@@ -759,13 +732,11 @@ Replica_gtid_state check_replica_gtid_state(
   auto master_gtid = get_executed_gtid_set(master);
   auto master_purged_gtid = get_purged_gtid_set(master);
 
-  return check_replica_gtid_state(master, master_gtid, master_purged_gtid,
-                                  slave_gtid, out_missing_gtids,
-                                  out_errant_gtids);
+  return check_replica_gtid_state(master_gtid, master_purged_gtid, slave_gtid,
+                                  out_missing_gtids, out_errant_gtids);
 }
 
 Replica_gtid_state check_replica_gtid_state(
-    const mysqlshdk::mysql::IInstance &instance,
     const std::string &master_gtidset, const std::string &master_purged_gtidset,
     const std::string &slave_gtidset, std::string *out_missing_gtids,
     std::string *out_errant_gtids) {
@@ -780,9 +751,8 @@ Replica_gtid_state check_replica_gtid_state(
     return Replica_gtid_state::NEW;
   }
 
-  Gtid_set_relation rel =
-      compare_gtid_sets(instance, master_gtidset, slave_gtidset,
-                        out_errant_gtids, out_missing_gtids);
+  Gtid_set_relation rel = compare_gtid_sets(
+      master_gtidset, slave_gtidset, out_errant_gtids, out_missing_gtids);
 
   switch (rel) {
     case Gtid_set_relation::INTERSECTS:
@@ -797,11 +767,8 @@ Replica_gtid_state check_replica_gtid_state(
       // If purged has more gtids than the executed on the slave
       // it means some data will not be recoverable
       if (master_purged_gtidset.empty() ||
-          instance
-              .queryf("SELECT GTID_SUBTRACT(?, ?) = ''", master_purged_gtidset,
-                      slave_gtidset)
-              ->fetch_one_or_throw()
-              ->get_int(0)) {
+          Gtid_set::from_string(slave_gtidset)
+              .contains(Gtid_set::from_string(master_purged_gtidset))) {
         return Replica_gtid_state::RECOVERABLE;
       } else {
         return Replica_gtid_state::IRRECOVERABLE;
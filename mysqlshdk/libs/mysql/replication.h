@@ -251,12 +251,9 @@ std::string get_total_gtid_set(
     const std::vector<std::string> &known_channel_names);
 
 /**
- * Returns an upper bound of the number of transactions in the given GTID set.
+ * Returns the number of transactions in the given GTID set.
  *
- * Can be used to give a rough estimate of the number of transactions, which
- * should be accurate if there are no gaps in GTID ranges.
- *
- * Note that this function will not detect duplicates in the set.
+ * @throws std::invalid_argument if the GTID set is malformed.
  */
 size_t estimate_gtid_set_size(const std::string &gtid_set);
 
@@ -268,8 +265,10 @@ enum class Gtid_set_relation {
   DISJOINT     // nothing in common
 };
 
-Gtid_set_relation compare_gtid_sets(const mysqlshdk::mysql::IInstance &server,
-                                    const std::string &gtidset_a,
+/**
+ * Compares two GTID sets, evaluated on the client side.
+ */
+Gtid_set_relation compare_gtid_sets(const std::string &gtidset_a,
                                     const std::string &gtidset_b,
                                     std::string *out_missing_from_a = nullptr,
                                     std::string *out_missing_from_b = nullptr);
@@ -293,7 +292,6 @@ Replica_gtid_state check_replica_gtid_state(
     std::string *out_errant_gtids = nullptr);
 
 Replica_gtid_state check_replica_gtid_state(
-    const mysqlshdk::mysql::IInstance &instance,
     const std::string &master_gtidset, const std::string &master_purged_gtidset,
     const std::string &slave_gtidset, std::string *out_missing_gtids = nullptr,
     std::string *out_errant_gtids = nullptr);
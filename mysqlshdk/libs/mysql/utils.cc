@@ -34,9 +34,12 @@
 #include <vector>
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/mysql/replication.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
+#include "mysqlshdk/libs/utils/utils_net.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -761,5 +764,46 @@ bool query_server_errors(
 
   return true;
 }
+
+bool server_side_files_available(
+    const std::shared_ptr<db::ISession> &session,
+    std::string *out_secure_file_priv) {
+  using mysqlshdk::utils::Net;
+
+  assert(out_secure_file_priv);
+
+  const auto &co = session->get_connection_options();
+
+  if (db::Transport_type::Tcp == co.get_transport_type() &&
+      !Net::is_loopback(co.get_host())) {
+    log_info("Server-side files are not used, server is on a remote host");
+    return false;
+  }
+
+  const auto row = session->query("SELECT @@hostname, @@secure_file_priv")
+                       ->fetch_one_or_throw();
+
+  // loopback connection may be forwarded to another host or a container
+  if (row->get_string(0) != Net::get_hostname()) {
+    log_info("Server-side files are not used, server's hostname is '%s'",
+             row->get_string(0).c_str());
+    return false;
+  }
+
+  if (row->is_null(1)) {
+    log_info("Server-side files are not used, secure_file_priv is NULL");
+    return false;
+  }
+
+  *out_secure_file_priv = row->get_string(1);
+
+  if (!out_secure_file_priv->empty() &&
+      !shcore::path::is_path_separator(out_secure_file_priv->back())) {
+    *out_secure_file_priv += shcore::path::path_separator;
+  }
+
+  return true;
+}
+
 }  // namespace mysql
 }  // namespace mysqlshdk
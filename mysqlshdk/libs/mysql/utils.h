@@ -126,6 +126,20 @@ bool query_server_errors(const mysql::IInstance &instance,
                          const std::vector<std::string> &subsystems,
                          const std::function<void(const Error_log_entry &)> &f);
 
+/**
+ * Checks if the server runs on this host and is allowed to access files, in
+ * which case it can read and write the local files directly.
+ *
+ * @param session the session to the server
+ * @param out_secure_file_priv the directory the server is limited to, with a
+ *        trailing path separator, or an empty string if there's no limit
+ *
+ * @returns true if the server can access the local files
+ */
+bool server_side_files_available(
+    const std::shared_ptr<db::ISession> &session,
+    std::string *out_secure_file_priv);
+
 }  // namespace mysql
 }  // namespace mysqlshdk
 
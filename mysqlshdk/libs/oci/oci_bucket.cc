@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "mysqlshdk/libs/db/uri_encoder.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_json.h"
 
 namespace mysqlshdk {
@@ -571,6 +572,57 @@ Multipart_object_part Bucket::upload_part(const Multipart_object &object,
   return {partNum, response_headers.at("Etag"), size};
 }
 
+Part_upload Bucket::upload_part_async(const Multipart_object &object,
+                                      size_t partNum, std::string data) {
+  // Ensures the REST connection is established
+  ensure_connection();
+
+  const auto path = shcore::str_format(kUploadPartFormat.c_str(),
+                                       encode_path(object.name).c_str(),
+                                       object.upload_id.c_str(), partNum);
+
+  Part_upload upload;
+  upload.m_bucket = this;
+  upload.m_object = object;
+  upload.m_part_num = partNum;
+  upload.m_state = std::make_unique<Part_upload::State>();
+
+  auto state = upload.m_state.get();
+  state->data = std::move(data);
+  state->result = m_rest_service->async_execute(
+      Type::PUT, path, state->data.data(), state->data.size(), {},
+      &state->response, &state->response_headers);
+
+  return upload;
+}
+
+Part_upload::~Part_upload() {
+  if (m_state && m_state->result.valid()) m_state->result.wait();
+}
+
+Multipart_object_part Part_upload::wait() {
+  auto code = Response::Status_code::INTERNAL_SERVER_ERROR;
+
+  try {
+    code = m_state->result.get();
+  } catch (const mysqlshdk::rest::Connection_error &error) {
+    log_info("Failed to upload part %zu for object '%s': %s", m_part_num,
+             m_object.name.c_str(), error.what());
+  }
+
+  if (code < Response::Status_code::OK ||
+      code >= Response::Status_code::MULTIPLE_CHOICES) {
+    // Asynchronous requests are not retried, the part is uploaded again using
+    // the synchronous request, which handles the retries and reports the
+    // errors.
+    return m_bucket->upload_part(m_object, m_part_num, m_state->data.data(),
+                                 m_state->data.size());
+  }
+
+  return {m_part_num, m_state->response_headers.at("Etag"),
+          m_state->data.size()};
+}
+
 void Bucket::commit_multipart_upload(
     const Multipart_object &object,
     const std::vector<Multipart_object_part> &parts) {
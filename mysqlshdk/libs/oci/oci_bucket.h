@@ -86,6 +86,47 @@ struct PAR {
 };
 
 class Object;
+class Bucket;
+
+/**
+ * Asynchronous upload of a part of a multipart object, created by
+ * Bucket::upload_part_async(). Destructor waits until the upload is finished.
+ */
+class Part_upload final {
+ public:
+  Part_upload(const Part_upload &) = delete;
+  Part_upload(Part_upload &&) = default;
+
+  Part_upload &operator=(const Part_upload &) = delete;
+  Part_upload &operator=(Part_upload &&) = default;
+
+  ~Part_upload();
+
+  /**
+   * Waits until the part is uploaded.
+   *
+   * @returns the part summary of the uploaded part.
+   */
+  Multipart_object_part wait();
+
+ private:
+  friend class Bucket;
+
+  struct State {
+    std::string data;
+    Headers response_headers;
+    mysqlshdk::rest::String_buffer response;
+    std::future<Response::Status_code> result;
+  };
+
+  Part_upload() = default;
+
+  Bucket *m_bucket = nullptr;
+  Multipart_object m_object;
+  size_t m_part_num = 0;
+  std::unique_ptr<State> m_state;
+};
+
 /**
  * C++ Implementation for Bucket operations through the OCI Object Store REST
  * API.
@@ -257,6 +298,18 @@ class Bucket : public std::enable_shared_from_this<Bucket> {
                                     size_t partNum, const char *body,
                                     size_t size);
 
+  /**
+   * Starts an asynchronous upload of a part for an object being uploaded.
+   *
+   * @param object: the multipart object data for which this part belongs.
+   * @param partNum: an incremental identifier for the part.
+   * @param data: the contents of the part.
+   *
+   * @returns a handle to the upload in progress.
+   */
+  Part_upload upload_part_async(const Multipart_object &object,
+                                size_t partNum, std::string data);
+
   /**
    * Finishes a multipart object upload.
    *
@@ -42,77 +42,124 @@ std::string service_identifier(Oci_service service) {
 }
 
 namespace {
-std::string sign(EVP_PKEY *sigkey, const std::string &string_to_sign) {
+
 // EVP_MD_CTX_create() and EVP_MD_CTX_destroy() were renamed to EVP_MD_CTX_new()
 // and EVP_MD_CTX_free() in OpenSSL 1.1.
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L /* 1.1.x */
-  std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> mctx(
-      EVP_MD_CTX_new(), ::EVP_MD_CTX_free);
+using Md_ctx_ptr = std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)>;
+
+Md_ctx_ptr new_md_ctx() {
+  return Md_ctx_ptr(EVP_MD_CTX_new(), ::EVP_MD_CTX_free);
+}
 #else
-  std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_destroy)> mctx(
-      EVP_MD_CTX_create(), ::EVP_MD_CTX_destroy);
+using Md_ctx_ptr =
+    std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_destroy)>;
+
+Md_ctx_ptr new_md_ctx() {
+  return Md_ctx_ptr(EVP_MD_CTX_create(), ::EVP_MD_CTX_destroy);
+}
 #endif
-  const EVP_MD *md = EVP_sha256();
-  int r = EVP_DigestSignInit(mctx.get(), nullptr, md, nullptr, sigkey);
+
+/**
+ * Signing context of a thread, prepared once for the most recently used key,
+ * each signature starts from a copy of the prepared context.
+ *
+ * Only a weak reference to the key is held here, but the prepared context
+ * holds its own reference, so the key stays in memory after its owner is
+ * destroyed, until this thread signs using another key or terminates.
+ */
+struct Signing_context {
+  std::weak_ptr<EVP_PKEY> key;
+  Md_ctx_ptr prepared = new_md_ctx();
+  Md_ctx_ptr current = new_md_ctx();
+  std::unique_ptr<unsigned char[]> signature;
+  size_t signature_size = 0;
+
+  void prepare(const std::shared_ptr<EVP_PKEY> &sigkey) {
+    if (key.lock() == sigkey) return;
+
+    key.reset();
+
+    // EVP_MD_CTX_reset() is not available in older versions of OpenSSL
+    prepared = new_md_ctx();
+
+    if (EVP_DigestSignInit(prepared.get(), nullptr, EVP_sha256(), nullptr,
+                           sigkey.get()) != 1) {
+      throw std::runtime_error("Cannot setup signing context.");
+    }
+
+    signature_size = EVP_PKEY_size(sigkey.get());
+    signature = std::make_unique<unsigned char[]>(signature_size + 1);
+    key = sigkey;
+  }
+};
+
+/**
+ * Digest context of a thread, reused by the subsequent hash operations.
+ */
+struct Digest_context {
+  Md_ctx_ptr ctx = new_md_ctx();
+  unsigned char value[EVP_MAX_MD_SIZE];
+};
+
+}  // namespace
+
+std::string sign(const std::shared_ptr<EVP_PKEY> &sigkey,
+                 const std::string &string_to_sign) {
+  thread_local Signing_context context;
+
+  context.prepare(sigkey);
+
+  int r = EVP_MD_CTX_copy_ex(context.current.get(), context.prepared.get());
   if (r != 1) {
     throw std::runtime_error("Cannot setup signing context.");
   }
 
-  const auto siglen = EVP_PKEY_size(sigkey);
-  const auto md_value = std::make_unique<unsigned char[]>(siglen + 1);
-
-  r = EVP_DigestSignUpdate(mctx.get(), string_to_sign.data(),
+  r = EVP_DigestSignUpdate(context.current.get(), string_to_sign.data(),
                            string_to_sign.size());
   if (r != 1) {
     throw std::runtime_error("Cannot hash data while signing request.");
   }
 
-  size_t md_len = siglen;
-  r = EVP_DigestSignFinal(mctx.get(), md_value.get(), &md_len);
+  size_t md_len = context.signature_size;
+  r = EVP_DigestSignFinal(context.current.get(), context.signature.get(),
+                          &md_len);
   if (r != 1) {
     throw std::runtime_error("Cannot finalize signing data.");
   }
 
   std::string signature_b64;
-  shcore::ssl::encode_base64(md_value.get(), md_len, &signature_b64);
+  shcore::ssl::encode_base64(context.signature.get(), md_len, &signature_b64);
   return signature_b64;
 }
 
 std::string encode_sha256(const char *data, size_t size) {
-// EVP_MD_CTX_create() and EVP_MD_CTX_destroy() were renamed to EVP_MD_CTX_new()
-// and EVP_MD_CTX_free() in OpenSSL 1.1.
-#if OPENSSL_VERSION_NUMBER >= 0x10100000L /* 1.1.x */
-  std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> mctx(
-      EVP_MD_CTX_new(), ::EVP_MD_CTX_free);
-#else
-  std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_destroy)> mctx(
-      EVP_MD_CTX_create(), ::EVP_MD_CTX_destroy);
-#endif
-  const EVP_MD *md = EVP_sha256();
-  int r = EVP_DigestInit_ex(mctx.get(), md, nullptr);
+  thread_local Digest_context context;
+
+  int r = EVP_DigestInit_ex(context.ctx.get(), EVP_sha256(), nullptr);
   if (r != 1) {
     throw std::runtime_error("SHA256: error initializing encoder.");
   }
 
-  const auto md_value = std::make_unique<unsigned char[]>(EVP_MAX_MD_SIZE);
-
-  r = EVP_DigestUpdate(mctx.get(), data, size);
+  r = EVP_DigestUpdate(context.ctx.get(), data, size);
   if (r != 1) {
     throw std::runtime_error("SHA256: error while encoding data.");
   }
 
   unsigned int md_len = EVP_MAX_MD_SIZE;
-  r = EVP_DigestFinal_ex(mctx.get(), md_value.get(), &md_len);
+  r = EVP_DigestFinal_ex(context.ctx.get(), context.value, &md_len);
   if (r != 1) {
     throw std::runtime_error("SHA256: error completing encode operation.");
   }
 
   std::string encoded;
-  shcore::ssl::encode_base64(md_value.get(), md_len, &encoded);
+  shcore::ssl::encode_base64(context.value, md_len, &encoded);
 
   return encoded;
 }
 
+namespace {
+
 void check_and_throw(Response::Status_code code, const Headers &headers,
                      Base_response_buffer *buffer) {
   if (code < Response::Status_code::OK ||
@@ -251,24 +298,21 @@ Headers Oci_rest_service::make_header(Type method, const std::string &path,
                                       const Headers headers) {
   time_t now = time(nullptr);
 
-  if (m_signed_header_cache_time.find(path) ==
-      m_signed_header_cache_time.end()) {
-    if (m_signed_header_cache_time[path].find(method) ==
-        m_signed_header_cache_time[path].end()) {
-      m_signed_header_cache_time[path][method] = 0;
-    }
-  }
-
-  Headers all_headers;
-
   // Maximum Allowed Client Clock Skew from the server's clock for OCI
   // requests is 5 minutes. We can exploit that feature to cache auth header,
   // because it is expensive to calculate.
   //
-  // PUT and POST requests are exceptions as the signature includes the body
-  // sha256
-  if (now - m_signed_header_cache_time[path][method] > 60 ||
-      method == Type::POST) {
+  // POST requests are exceptions as the signature includes the body sha256.
+  // PUT requests are used to upload objects and their parts, each one has a
+  // different path, caching them would only grow the cache.
+  const bool use_cache = method != Type::POST && method != Type::PUT;
+  Headers uncached_headers;
+  auto &signed_headers =
+      use_cache ? m_cached_header[path][method] : uncached_headers;
+
+  if (!use_cache || now - m_signed_header_cache_time[path][method] > 60) {
+    Headers all_headers;
+
     const auto date = mysqlshdk::utils::fmttime(
         "%a, %d %b %Y %H:%M:%S GMT", mysqlshdk::utils::Time_type::GMT, &now);
 
@@ -291,7 +335,7 @@ Headers Oci_rest_service::make_header(Type method, const std::string &path,
           "\ncontent-type: " + all_headers["content-type"]);
     }
 
-    const std::string signature_b64 = sign(m_private_key.get(), string_to_sign);
+    const std::string signature_b64 = sign(m_private_key, string_to_sign);
     std::string auth_header =
         "Signature version=\"1\",headers=\"(request-target) host x-date";
 
@@ -303,15 +347,15 @@ Headers Oci_rest_service::make_header(Type method, const std::string &path,
                        "\",algorithm=\"rsa-sha256\",signature=\"" +
                        signature_b64 + "\"");
 
-    m_signed_header_cache_time[path][method] = now;
-
     all_headers["authorization"] = auth_header;
     all_headers["x-date"] = date;
 
-    m_cached_header[path][method] = all_headers;
+    if (use_cache) m_signed_header_cache_time[path][method] = now;
+
+    signed_headers = std::move(all_headers);
   }
 
-  auto final_headers = m_cached_header[path][method];
+  auto final_headers = signed_headers;
 
   // Adds any additional headers
   for (const auto &header : headers) {
@@ -373,5 +417,18 @@ Response::Status_code Oci_rest_service::execute(
   return code;
 }
 
+std::future<Response::Status_code> Oci_rest_service::async_execute(
+    Type type, const std::string &path, const char *body, size_t size,
+    const Headers &request_headers, Base_response_buffer *buffer,
+    Headers *response_headers, bool sign_request) {
+  if (!m_rest) set_service(m_service);
+
+  return m_rest->async_execute(
+      type, path, body, size,
+      sign_request ? make_header(type, path, body, size, request_headers)
+                   : request_headers,
+      buffer, response_headers);
+}
+
 }  // namespace oci
 }  // namespace mysqlshdk
@@ -25,6 +25,8 @@
 #define MYSQLSHDK_LIBS_OCI_OCI_REST_SERVICE_H_
 
 #include <openssl/pem.h>
+#include <future>
+#include <memory>
 #include <string>
 
 #include "mysqlshdk/libs/oci/oci_options.h"
@@ -45,6 +47,28 @@ enum class Oci_service { IDENTITY, OBJECT_STORAGE };
 
 std::string service_identifier(Oci_service service);
 
+/**
+ * Signs the given string using RSA-SHA256, the signing context is prepared
+ * once per thread and key.
+ *
+ * The prepared context keeps the key in memory until the calling thread signs
+ * using a different key or terminates.
+ *
+ * @param sigkey The private key.
+ * @param string_to_sign Data to be signed.
+ *
+ * @returns base64-encoded signature.
+ */
+std::string sign(const std::shared_ptr<EVP_PKEY> &sigkey,
+                 const std::string &string_to_sign);
+
+/**
+ * Computes the SHA256 hash of the given data.
+ *
+ * @returns base64-encoded hash.
+ */
+std::string encode_sha256(const char *data, size_t size);
+
 class Oci_rest_service {
  public:
   Oci_rest_service() = default;
@@ -84,6 +108,16 @@ class Oci_rest_service {
                                 Headers *response_headers = nullptr,
                                 bool sign_request = true);
 
+  /**
+   * Asynchronously executes a request. Body, buffer and response headers must
+   * remain valid until the returned future is ready. Retries are not handled
+   * and the response code is not checked.
+   */
+  std::future<Response::Status_code> async_execute(
+      Type type, const std::string &path, const char *body, size_t size,
+      const Headers &request_headers, Base_response_buffer *buffer,
+      Headers *response_headers, bool sign_request = true);
+
   // TODO(rennox): These configuration properties/functions exists here because
   // the configuration was loaded on the constructor of the REST service,
   // however, it cuold be i.e. passed down through all the chain call when a
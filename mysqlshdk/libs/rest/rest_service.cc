@@ -24,6 +24,12 @@
 #include "mysqlshdk/libs/rest/rest_service.h"
 
 #include <curl/curl.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -131,6 +137,252 @@ static CURLcode sslctx_function(CURL *curl, void *sslctx, void *parm) {
 
 #endif  // _WIN32
 
+Response::Status_code get_status_code(CURL *handle) {
+  long response_code = 0;
+  curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &response_code);
+  return static_cast<Response::Status_code>(response_code);
+}
+
+void log_response(const std::string &id, int sequence,
+                  Response::Status_code code, const std::string &headers) {
+  if (shcore::current_logger()->get_log_level() >=
+      shcore::Logger::LOG_LEVEL::LOG_DEBUG) {
+    log_debug("%s-%d: %d-%s", id.c_str(), sequence, static_cast<int>(code),
+              Response::status_code(code).c_str());
+
+    if (!headers.empty()) {
+      log_debug2("%s-%d: RESPONSE HEADERS:\n  %s", id.c_str(), sequence,
+                 headers.c_str());
+    }
+  }
+}
+
+/**
+ * Process-wide cache of DNS entries and TLS sessions, shared by all the CURL
+ * handles, so that independent REST services talking to the same host do not
+ * need to resolve it and do a full handshake again. Connections are not
+ * shared, each handle (and the multi handle) keeps its own connection cache,
+ * a shared one would be locked by every transfer.
+ */
+class Curl_share {
+ public:
+  static Curl_share &get() {
+    static Curl_share s_share;
+    return s_share;
+  }
+
+  Curl_share(const Curl_share &) = delete;
+  Curl_share &operator=(const Curl_share &) = delete;
+
+  ~Curl_share() { curl_share_cleanup(m_handle); }
+
+  CURLSH *handle() const { return m_handle; }
+
+ private:
+  Curl_share() : m_handle(curl_share_init()) {
+    curl_share_setopt(m_handle, CURLSHOPT_LOCKFUNC, &Curl_share::lock);
+    curl_share_setopt(m_handle, CURLSHOPT_UNLOCKFUNC, &Curl_share::unlock);
+    curl_share_setopt(m_handle, CURLSHOPT_USERDATA, this);
+
+    curl_share_setopt(m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  }
+
+  static void lock(CURL *, curl_lock_data data, curl_lock_access, void *ptr) {
+    static_cast<Curl_share *>(ptr)->m_mutexes[data].lock();
+  }
+
+  static void unlock(CURL *, curl_lock_data data, void *ptr) {
+    static_cast<Curl_share *>(ptr)->m_mutexes[data].unlock();
+  }
+
+  CURLSH *m_handle;
+  std::mutex m_mutexes[CURL_LOCK_DATA_LAST];
+};
+
+/**
+ * A request executed by the Async_engine.
+ */
+struct Async_request {
+  Async_request()
+      : handle(nullptr, &curl_easy_cleanup),
+        request_headers(nullptr, &curl_slist_free_all) {
+    error_buffer[0] = '\0';
+  }
+
+  std::unique_ptr<CURL, void (*)(CURL *)> handle;
+  std::unique_ptr<curl_slist, void (*)(curl_slist *)> request_headers;
+  // used when body is owned by the request
+  std::string body;
+  std::string response_headers;
+  char error_buffer[CURL_ERROR_SIZE];
+  std::shared_ptr<shcore::Logger> logger;
+  // called from the engine thread once the transfer is finished
+  std::function<void(Async_request *, CURLcode)> on_complete;
+};
+
+/**
+ * Event loop built on top of the CURL multi interface. All asynchronous
+ * requests are multiplexed by a single background thread, which is started
+ * when the first request is submitted.
+ */
+class Async_engine {
+ public:
+  static Async_engine &get() {
+    static Async_engine s_engine;
+    return s_engine;
+  }
+
+  Async_engine(const Async_engine &) = delete;
+  Async_engine &operator=(const Async_engine &) = delete;
+
+  ~Async_engine() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+
+    wakeup();
+
+    if (m_thread.joinable()) m_thread.join();
+
+    // cancel anything what was not executed
+    for (auto &request : m_pending) {
+      cancel(request.get());
+    }
+
+    for (auto &request : m_running) {
+      curl_multi_remove_handle(m_multi, request.first);
+      cancel(request.second.get());
+    }
+
+    curl_multi_cleanup(m_multi);
+  }
+
+  void add(std::unique_ptr<Async_request> request) {
+    curl_easy_setopt(request->handle.get(), CURLOPT_PRIVATE, request.get());
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      if (m_stop) {
+        cancel(request.get());
+        return;
+      }
+
+      m_pending.emplace_back(std::move(request));
+
+      if (!m_thread.joinable()) {
+        m_thread = std::thread(&Async_engine::run, this);
+      }
+    }
+
+    wakeup();
+  }
+
+ private:
+  // maximum number of concurrent connections to a single host
+  static constexpr long k_max_host_connections = 32;
+  // maximum number of concurrent connections
+  static constexpr long k_max_total_connections = 128;
+  // how often new requests are picked up, if libcurl cannot be woken up
+  static constexpr int k_poll_timeout_ms = 50;
+
+  Async_engine() : m_multi(curl_multi_init()) {
+    // make sure share is initialized first, and destroyed after this object
+    Curl_share::get();
+
+    curl_multi_setopt(m_multi, CURLMOPT_MAX_HOST_CONNECTIONS,
+                      k_max_host_connections);
+    curl_multi_setopt(m_multi, CURLMOPT_MAX_TOTAL_CONNECTIONS,
+                      k_max_total_connections);
+    curl_multi_setopt(m_multi, CURLMOPT_MAXCONNECTS, k_max_total_connections);
+  }
+
+  void wakeup() {
+    m_pending_cv.notify_one();
+#if LIBCURL_VERSION_NUM >= 0x074400
+    // curl_multi_wakeup() was added in libcurl 7.68.0
+    curl_multi_wakeup(m_multi);
+#endif
+  }
+
+  static void complete(Async_request *request, CURLcode result) {
+    // requests are completed using the logger of the thread which created them
+    mysqlsh::Scoped_logger logger(request->logger);
+    request->on_complete(request, result);
+  }
+
+  static void cancel(Async_request *request) {
+    snprintf(request->error_buffer, CURL_ERROR_SIZE, "Request was cancelled");
+    complete(request, CURLE_ABORTED_BY_CALLBACK);
+  }
+
+  void run() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // nothing to do, sleep until new requests arrive
+        m_pending_cv.wait(lock, [this]() {
+          return m_stop || !m_pending.empty() || !m_running.empty();
+        });
+
+        if (m_stop) break;
+
+        for (auto &request : m_pending) {
+          const auto handle = request->handle.get();
+          curl_multi_add_handle(m_multi, handle);
+          m_running.emplace(handle, std::move(request));
+        }
+
+        m_pending.clear();
+      }
+
+      int running = 0;
+      curl_multi_perform(m_multi, &running);
+
+      CURLMsg *msg = nullptr;
+      int queued = 0;
+
+      while ((msg = curl_multi_info_read(m_multi, &queued))) {
+        if (CURLMSG_DONE == msg->msg) {
+          const auto handle = msg->easy_handle;
+          const auto result = msg->data.result;
+          curl_multi_remove_handle(m_multi, handle);
+
+          std::unique_ptr<Async_request> request;
+
+          {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_running.find(handle);
+            request = std::move(it->second);
+            m_running.erase(it);
+          }
+
+          complete(request.get(), result);
+        }
+      }
+
+      if (running > 0) {
+#if LIBCURL_VERSION_NUM >= 0x074400
+        curl_multi_poll(m_multi, nullptr, 0, k_poll_timeout_ms, nullptr);
+#else
+        curl_multi_wait(m_multi, nullptr, 0, k_poll_timeout_ms, nullptr);
+#endif
+      }
+    }
+  }
+
+  CURLM *m_multi;
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_pending_cv;
+  bool m_stop = false;
+  std::vector<std::unique_ptr<Async_request>> m_pending;
+  std::map<CURL *, std::unique_ptr<Async_request>> m_running;
+};
+
 }  // namespace
 
 std::string type_name(Type method) {
@@ -158,6 +410,7 @@ class Rest_service::Impl {
    */
   Impl(const std::string &base_url, bool verify, const std::string &label)
       : m_handle(curl_easy_init(), &curl_easy_cleanup),
+        m_async_template(nullptr, &curl_easy_cleanup),
         m_base_url{base_url},
         m_request_sequence(0) {
     // Disable signal handlers used by libcurl, we're potentially going to use
@@ -180,6 +433,9 @@ class Rest_service::Impl {
     // called
     curl_easy_setopt(m_handle.get(), CURLOPT_ERRORBUFFER, m_error_buffer);
 
+    // DNS cache and TLS sessions are shared by all the handles
+    curl_easy_setopt(m_handle.get(), CURLOPT_SHARE, Curl_share::get().handle());
+
     verify_ssl(verify);
 
     // Default timeout for HEAD/DELETE: 30000 milliseconds
@@ -208,14 +464,19 @@ class Rest_service::Impl {
 
     m_id += shcore::get_random_string(
         5, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz1234567890");
+
+    // asynchronous requests are copied from a handle which is not used to
+    // execute requests, the main one can be in use by another thread
+    m_async_template.reset(curl_easy_duphandle(m_handle.get()));
   }
 
   ~Impl() = default;
 
-  void log_request(Type type, const std::string &path, const Headers &headers) {
+  void log_request(int sequence, Type type, const std::string &path,
+                   const Headers &headers) {
     if (shcore::current_logger()->get_log_level() >=
         shcore::Logger::LOG_LEVEL::LOG_DEBUG) {
-      log_debug("%s-%d: %s %s", m_id.c_str(), m_request_sequence,
+      log_debug("%s-%d: %s %s", m_id.c_str(), sequence,
                 shcore::str_upper(type_name(type)).c_str(), path.c_str());
 
       if (!headers.empty() && shcore::current_logger()->get_log_level() >=
@@ -225,68 +486,54 @@ class Rest_service::Impl {
           header_data.push_back("'" + header.first + "' : '" + header.second +
                                 "'");
         }
-        log_debug2("%s-%d: REQUEST HEADERS:\n  %s", m_id.c_str(),
-                   m_request_sequence,
+        log_debug2("%s-%d: REQUEST HEADERS:\n  %s", m_id.c_str(), sequence,
                    shcore::str_join(header_data, "\n  ").c_str());
       }
     }
   }
 
-  void log_response(int sequence, Response::Status_code code,
-                    const std::string &headers) {
-    if (shcore::current_logger()->get_log_level() >=
-        shcore::Logger::LOG_LEVEL::LOG_DEBUG) {
-      log_debug("%s-%d: %d-%s", m_id.c_str(), sequence, static_cast<int>(code),
-                Response::status_code(code).c_str());
-
-      if (!headers.empty()) {
-        log_debug2("%s-%d: RESPONSE HEADERS:\n  %s", m_id.c_str(), sequence,
-                   headers.c_str());
-      }
-    }
-  }
-
   Response execute(Type type, const std::string &path,
-                   const shcore::Value &body, const Headers &headers,
-                   bool synch = true) {
-    m_request_sequence++;
+                   const shcore::Value &body, const Headers &headers) {
+    const auto sequence = ++m_request_sequence;
+
+    log_request(sequence, type, path, headers);
 
-    log_request(type, path, headers);
+    const auto handle = m_handle.get();
 
-    set_url(path);
+    set_url(handle, path);
     // body needs to be set before the type, because it implicitly sets type to
     // POST
-    // NOTE: This variable is required here so in synch requests the buffer is
-    // valid through the entire request
+    // NOTE: This variable is required here so the buffer is valid through the
+    // entire request
     auto body_str = body.repr();
     if (body.type == shcore::Value_type::Undefined) body_str.clear();
 
-    set_body(body_str.data(), body_str.length(), synch);
+    set_body(handle, body_str.data(), body_str.length());
 
-    set_type(type);
-    const auto headers_deleter =
-        set_headers(headers, body.type != shcore::Value_type::Undefined);
+    set_type(handle, type);
+    const auto headers_deleter = set_headers(
+        handle, headers, body.type != shcore::Value_type::Undefined);
 
     // set callbacks which will receive the response
     Response response;
 
     std::string response_headers;
 
-    curl_easy_setopt(m_handle.get(), CURLOPT_HEADERDATA, &response_headers);
+    curl_easy_setopt(handle, CURLOPT_HEADERDATA, &response_headers);
     String_ref_buffer buffer(&response.body);
-    curl_easy_setopt(m_handle.get(), CURLOPT_WRITEDATA, &buffer);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, &buffer);
 
     // execute the request
     CURLcode err;
-    if ((err = curl_easy_perform(m_handle.get())) != CURLE_OK) {
-      log_error("%s-%d: %s (CURLcode = %i)", m_id.c_str(), m_request_sequence,
+    if ((err = curl_easy_perform(handle)) != CURLE_OK) {
+      log_error("%s-%d: %s (CURLcode = %i)", m_id.c_str(), sequence,
                 m_error_buffer, err);
       throw Connection_error{m_error_buffer};
     }
 
-    const auto status = get_status_code();
+    const auto status = get_status_code(handle);
 
-    log_response(m_request_sequence, status, response_headers);
+    log_response(m_id, sequence, status, response_headers);
 
     response.status = status;
     response.headers = parse_headers(response_headers);
@@ -299,68 +546,130 @@ class Rest_service::Impl {
                                 const Headers &request_headers,
                                 Base_response_buffer *buffer,
                                 Headers *response_headers) {
-    m_request_sequence++;
+    const auto sequence = ++m_request_sequence;
 
-    log_request(type, path, request_headers);
+    log_request(sequence, type, path, request_headers);
 
-    set_url(path);
+    const auto handle = m_handle.get();
+
+    set_url(handle, path);
     // body needs to be set before the type, because it implicitly sets type
     // to POST
-    set_body(body, size, true);
-    set_type(type);
-    const auto headers_deleter = set_headers(request_headers, true);
+    set_body(handle, body, size);
+    set_type(handle, type);
+    const auto headers_deleter = set_headers(handle, request_headers, true);
 
     // set callbacks which will receive the response
     std::string header_data;
-    curl_easy_setopt(m_handle.get(), CURLOPT_HEADERDATA, &header_data);
-    curl_easy_setopt(m_handle.get(), CURLOPT_WRITEDATA, buffer);
+    curl_easy_setopt(handle, CURLOPT_HEADERDATA, &header_data);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, buffer);
 
     // execute the request
-    auto ret_val = curl_easy_perform(m_handle.get());
+    auto ret_val = curl_easy_perform(handle);
     if (ret_val != CURLE_OK) {
-      log_error("%s-%d: %s (CURLcode = %i)", m_id.c_str(), m_request_sequence,
+      log_error("%s-%d: %s (CURLcode = %i)", m_id.c_str(), sequence,
                 m_error_buffer, ret_val);
       throw Connection_error{m_error_buffer};
     }
 
-    const auto status = get_status_code();
+    const auto status = get_status_code(handle);
 
-    log_response(m_request_sequence, status, header_data);
+    log_response(m_id, sequence, status, header_data);
 
     if (response_headers) *response_headers = parse_headers(header_data);
 
     return status;
   }
 
-  void set_body(const char *body, size_t size, bool synch) {
-    curl_easy_setopt(m_handle.get(), CURLOPT_POSTFIELDSIZE, size);
-    if (synch) {
-      curl_easy_setopt(m_handle.get(), CURLOPT_COPYPOSTFIELDS, NULL);
-      curl_easy_setopt(m_handle.get(), CURLOPT_POSTFIELDS, body);
-    } else {
-      curl_easy_setopt(m_handle.get(), CURLOPT_COPYPOSTFIELDS, body);
-    }
-  }
-
   std::future<Response> execute_async(Type type, const std::string &path,
                                       const shcore::Value &body,
                                       const Headers &headers) {
-    auto current_logger = shcore::current_logger();
-    return std::async(std::launch::async,
-                      [this, type, path, body, headers, current_logger]() {
-                        // We're here in different thread, but we should use the
-                        // parent logger
-                        mysqlsh::Scoped_logger logger(current_logger);
-                        return execute(type, path, body, headers, false);
-                      });
+    struct State {
+      Response response;
+      String_ref_buffer buffer{&response.body};
+      std::promise<Response> promise;
+    };
+
+    const auto state = std::make_shared<State>();
+
+    const auto sequence = ++m_request_sequence;
+    auto request =
+        create_request(sequence, type, path, headers,
+                       body.type != shcore::Value_type::Undefined);
+
+    if (body.type != shcore::Value_type::Undefined) request->body = body.repr();
+
+    prepare_request(request.get(), type, request->body.data(),
+                    request->body.length(), &state->buffer);
+
+    request->on_complete = [state, id = m_id, sequence](Async_request *r,
+                                                        CURLcode result) {
+      if (CURLE_OK == result) {
+        state->response.status = get_status_code(r->handle.get());
+        state->response.headers = parse_headers(r->response_headers);
+
+        log_response(id, sequence, state->response.status,
+                     r->response_headers);
+
+        state->promise.set_value(std::move(state->response));
+      } else {
+        log_error("%s-%d: %s (CURLcode = %i)", id.c_str(), sequence,
+                  r->error_buffer, result);
+        state->promise.set_exception(
+            std::make_exception_ptr(Connection_error{r->error_buffer}));
+      }
+    };
+
+    auto future = state->promise.get_future();
+
+    Async_engine::get().add(std::move(request));
+
+    return future;
+  }
+
+  std::future<Response::Status_code> execute_async(
+      Type type, const std::string &path, const char *body, size_t size,
+      const Headers &request_headers, Base_response_buffer *buffer,
+      Headers *response_headers) {
+    const auto promise =
+        std::make_shared<std::promise<Response::Status_code>>();
+
+    const auto sequence = ++m_request_sequence;
+    auto request = create_request(sequence, type, path, request_headers, true);
+
+    prepare_request(request.get(), type, body, size, buffer);
+
+    request->on_complete = [promise, response_headers, id = m_id, sequence](
+                               Async_request *r, CURLcode result) {
+      if (CURLE_OK == result) {
+        const auto status = get_status_code(r->handle.get());
+
+        log_response(id, sequence, status, r->response_headers);
+
+        if (response_headers) {
+          *response_headers = parse_headers(r->response_headers);
+        }
+
+        promise->set_value(status);
+      } else {
+        log_error("%s-%d: %s (CURLcode = %i)", id.c_str(), sequence,
+                  r->error_buffer, result);
+        promise->set_exception(
+            std::make_exception_ptr(Connection_error{r->error_buffer}));
+      }
+    };
+
+    auto future = promise->get_future();
+
+    Async_engine::get().add(std::move(request));
+
+    return future;
   }
 
   void set(const Basic_authentication &basic) {
-    curl_easy_setopt(m_handle.get(), CURLOPT_HTTPAUTH, CURLAUTH_BASIC);
-    curl_easy_setopt(m_handle.get(), CURLOPT_USERNAME,
-                     basic.username().c_str());
-    curl_easy_setopt(m_handle.get(), CURLOPT_PASSWORD,
-                     basic.password().c_str());
+    set_option(CURLOPT_HTTPAUTH, CURLAUTH_BASIC);
+    set_option(CURLOPT_USERNAME, basic.username().c_str());
+    set_option(CURLOPT_PASSWORD, basic.password().c_str());
   }
 
   void set_default_headers(const Headers &headers) {
@@ -369,10 +678,8 @@ class Rest_service::Impl {
 
   void set_timeout(long timeout, long low_speed_limit, long low_speed_time) {
     m_default_timeout = timeout;
-    curl_easy_setopt(m_handle.get(), CURLOPT_LOW_SPEED_LIMIT,
-                     static_cast<long>(low_speed_limit));
-    curl_easy_setopt(m_handle.get(), CURLOPT_LOW_SPEED_TIME,
-                     static_cast<long>(low_speed_time));
+    set_option(CURLOPT_LOW_SPEED_LIMIT, static_cast<long>(low_speed_limit));
+    set_option(CURLOPT_LOW_SPEED_TIME, static_cast<long>(low_speed_time));
   }
 
   std::string get_last_request_id() const {
@@ -381,59 +688,120 @@ class Rest_service::Impl {
 
  private:
   void verify_ssl(bool verify) {
-    curl_easy_setopt(m_handle.get(), CURLOPT_SSL_VERIFYHOST, verify ? 2L : 0L);
-    curl_easy_setopt(m_handle.get(), CURLOPT_SSL_VERIFYPEER, verify ? 1L : 0L);
+    set_option(CURLOPT_SSL_VERIFYHOST, verify ? 2L : 0L);
+    set_option(CURLOPT_SSL_VERIFYPEER, verify ? 1L : 0L);
+  }
+
+  /**
+   * Sets an option which is common to all the requests, both in the main
+   * handle and in the one used as a template of asynchronous requests.
+   */
+  template <typename T>
+  void set_option(CURLoption option, T value) {
+    curl_easy_setopt(m_handle.get(), option, value);
+
+    std::lock_guard<std::mutex> lock(m_async_template_mutex);
+
+    if (m_async_template) {
+      curl_easy_setopt(m_async_template.get(), option, value);
+    }
   }
 
-  void set_type(Type type) {
+  /**
+   * Creates a request to be executed by the Async_engine, using a copy of the
+   * template handle of this service, which holds all the common settings.
+   */
+  std::unique_ptr<Async_request> create_request(int sequence, Type type,
+                                                const std::string &path,
+                                                const Headers &headers,
+                                                bool has_body) {
+    log_request(sequence, type, path, headers);
+
+    auto request = std::make_unique<Async_request>();
+
+    {
+      std::lock_guard<std::mutex> lock(m_async_template_mutex);
+      request->handle.reset(curl_easy_duphandle(m_async_template.get()));
+    }
+
+    request->logger = shcore::current_logger();
+
+    const auto handle = request->handle.get();
+
+    curl_easy_setopt(handle, CURLOPT_ERRORBUFFER, request->error_buffer);
+    curl_easy_setopt(handle, CURLOPT_HEADERDATA, &request->response_headers);
+    set_url(handle, path);
+    request->request_headers = set_headers(handle, headers, has_body);
+
+    return request;
+  }
+
+  void prepare_request(Async_request *request, Type type, const char *body,
+                       size_t size, Base_response_buffer *buffer) {
+    const auto handle = request->handle.get();
+
+    // body needs to be set before the type, because it implicitly sets type
+    // to POST
+    set_body(handle, body, size);
+    set_type(handle, type);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, buffer);
+  }
+
+  void set_body(CURL *handle, const char *body, size_t size) {
+    curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE, size);
+    curl_easy_setopt(handle, CURLOPT_COPYPOSTFIELDS, NULL);
+    curl_easy_setopt(handle, CURLOPT_POSTFIELDS, body);
+  }
+
+  void set_type(CURL *handle, Type type) {
     // custom request overwrites any other option, make sure it's set to
     // default
-    curl_easy_setopt(m_handle.get(), CURLOPT_CUSTOMREQUEST, nullptr);
-    curl_easy_setopt(m_handle.get(), CURLOPT_TIMEOUT_MS, 0);
+    curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, nullptr);
+    curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, 0);
 
     switch (type) {
       case Type::GET:
-        curl_easy_setopt(m_handle.get(), CURLOPT_HTTPGET, 1L);
+        curl_easy_setopt(handle, CURLOPT_HTTPGET, 1L);
         break;
 
       case Type::HEAD:
-        curl_easy_setopt(m_handle.get(), CURLOPT_HTTPGET, 1L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 1L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_TIMEOUT_MS, m_default_timeout);
+        curl_easy_setopt(handle, CURLOPT_HTTPGET, 1L);
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 1L);
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_default_timeout);
         break;
 
       case Type::POST:
-        curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 0L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_POST, 1L);
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 0L);
+        curl_easy_setopt(handle, CURLOPT_POST, 1L);
         break;
 
       case Type::PUT:
-        curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 0L);
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 0L);
         // We could use CURLOPT_UPLOAD here, but that would mean we have to
         // provide request data using CURLOPT_READDATA. Using custom request
         // allows to always use CURLOPT_COPYPOSTFIELDS.
-        curl_easy_setopt(m_handle.get(), CURLOPT_CUSTOMREQUEST, "PUT");
+        curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, "PUT");
         break;
 
       case Type::PATCH:
-        curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 0L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_CUSTOMREQUEST, "PATCH");
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 0L);
+        curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, "PATCH");
         break;
 
       case Type::DELETE:
-        curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 0L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_CUSTOMREQUEST, "DELETE");
-        curl_easy_setopt(m_handle.get(), CURLOPT_TIMEOUT_MS, m_default_timeout);
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 0L);
+        curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, "DELETE");
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_default_timeout);
         break;
     }
   }
 
-  void set_url(const std::string &path) {
-    curl_easy_setopt(m_handle.get(), CURLOPT_URL, (m_base_url + path).c_str());
+  void set_url(CURL *handle, const std::string &path) {
+    curl_easy_setopt(handle, CURLOPT_URL, (m_base_url + path).c_str());
   }
 
   std::unique_ptr<curl_slist, void (*)(curl_slist *)> set_headers(
-      const Headers &headers, bool has_body) {
+      CURL *handle, const Headers &headers, bool has_body) {
     // create the headers list
     curl_slist *header_list = nullptr;
 
@@ -466,20 +834,17 @@ class Rest_service::Impl {
     }
 
     // set the headers
-    curl_easy_setopt(m_handle.get(), CURLOPT_HTTPHEADER, header_list);
+    curl_easy_setopt(handle, CURLOPT_HTTPHEADER, header_list);
     // automatically delete the headers when leaving the scope
     return std::unique_ptr<curl_slist, void (*)(curl_slist *)>{
         header_list, &curl_slist_free_all};
   }
 
-  Response::Status_code get_status_code() const {
-    long response_code = 0;
-    curl_easy_getinfo(m_handle.get(), CURLINFO_RESPONSE_CODE, &response_code);
-    return static_cast<Response::Status_code>(response_code);
-  }
-
   std::unique_ptr<CURL, void (*)(CURL *)> m_handle;
 
+  std::unique_ptr<CURL, void (*)(CURL *)> m_async_template;
+  std::mutex m_async_template_mutex;
+
   char m_error_buffer[CURL_ERROR_SIZE];
 
   std::string m_base_url;
@@ -488,7 +853,7 @@ class Rest_service::Impl {
 
   std::string m_id;
 
-  int m_request_sequence;
+  std::atomic<int> m_request_sequence;
 
   long m_default_timeout;
 };
@@ -586,6 +951,14 @@ Response::Status_code Rest_service::execute(Type type, const std::string &path,
   }
 }
 
+std::future<Response::Status_code> Rest_service::async_execute(
+    Type type, const std::string &path, const char *body, size_t size,
+    const Headers &request_headers, Base_response_buffer *buffer,
+    Headers *response_headers) {
+  return m_impl->execute_async(type, path, body, size, request_headers, buffer,
+                               response_headers);
+}
+
 std::future<Response> Rest_service::async_get(const std::string &path,
                                               const Headers &headers) {
   return m_impl->execute_async(Type::GET, path, {}, headers);
@@ -47,6 +47,11 @@ std::string type_name(Type t);
  * A REST service. By default, requests will follow redirections and
  * keep the connections alive.
  *
+ * DNS entries and TLS sessions are cached process-wide and shared by all the
+ * services. Asynchronous requests are multiplexed by a single
+ * background thread, they can be executed concurrently with each other and
+ * with the synchronous ones, with a bounded number of connections per host.
+ *
  * This is a move-only type.
  */
 class Rest_service {
@@ -246,8 +251,38 @@ class Rest_service {
                                 Retry_strategy *retry_strategy = nullptr);
 
   /**
-   * Asynchronously executes a GET request. This object must not be modified
-   * nor any other request can be executed again until response is received.
+   * Asynchronously executes a request. Retries are not handled, if required,
+   * caller should check the result and execute the request again.
+   *
+   * @param type Method to be used on the request execution.
+   * @param path Path to the request, it is going to be appended to the base
+   *        URL.
+   * @param body Optional body which is going to be sent along with the
+   * request. It must remain valid until response is received.
+   * @param size The length in bytes of the body to be sent.
+   * @param headers Optional request-specific headers. If default headers were
+   *        also specified, request-specific headers are going to be appended
+   *        that set, overwriting any duplicated values.
+   * @param response_data pointer to a string buffer where the content of the
+   * response body will be written. It must remain valid until response is
+   * received.
+   * @param response_headers pointer to a Headers struct where the response
+   * headers will be placed. It must remain valid until response is received.
+   *
+   * @returns The code of the request response.
+   *
+   * @throws Connection_error In case of any connection-related problems. This
+   *         method does not throw on its own, exception could be thrown from
+   *         future object.
+   */
+  std::future<Response::Status_code> async_execute(
+      Type type, const std::string &path, const char *body = nullptr,
+      size_t size = 0, const Headers &request_headers = {},
+      Base_response_buffer *buffer = nullptr,
+      Headers *response_headers = nullptr);
+
+  /**
+   * Asynchronously executes a GET request.
    *
    * @param path Path to the request, it is going to be appended to the base
    *        URL.
@@ -265,8 +300,7 @@ class Rest_service {
                                   const Headers &headers = {});
 
   /**
-   * Asynchronously executes a HEAD request. This object must not be modified
-   * nor any other request can be executed again until response is received.
+   * Asynchronously executes a HEAD request.
    *
    * @param path Path to the request, it is going to be appended to the base
    *        URL.
@@ -284,8 +318,7 @@ class Rest_service {
                                    const Headers &headers = {});
 
   /**
-   * Asynchronously executes a POST request. This object must not be modified
-   * nor any other request can be executed again until response is received.
+   * Asynchronously executes a POST request.
    *
    * @param path Path to the request, it is going to be appended to the base
    *        URL.
@@ -307,8 +340,7 @@ class Rest_service {
                                    const Headers &headers = {});
 
   /**
-   * Asynchronously executes a PUT request. This object must not be modified
-   * nor any other request can be executed again until response is received.
+   * Asynchronously executes a PUT request.
    *
    * @param path Path to the request, it is going to be appended to the base
    *        URL.
@@ -330,8 +362,7 @@ class Rest_service {
                                   const Headers &headers = {});
 
   /**
-   * Asynchronously executes a PATCH request. This object must not be modified
-   * nor any other request can be executed again until response is received.
+   * Asynchronously executes a PATCH request.
    *
    * @param path Path to the request, it is going to be appended to the base
    *        URL.
@@ -353,9 +384,7 @@ class Rest_service {
                                     const Headers &headers = {});
 
   /**
-   * Asynchronously executes a DELETE request. This object must not be
-   * modified nor any other request can be executed again until response is
-   * received.
+   * Asynchronously executes a DELETE request.
    *
    * @param path Path to the request, it is going to be appended to the base
    *        URL.
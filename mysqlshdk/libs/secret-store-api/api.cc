@@ -25,6 +25,10 @@
 
 #include <string.h>
 
+#include <map>
+#include <mutex>
+#include <utility>
+
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 
@@ -51,6 +55,40 @@ std::string get_helper_name(const std::string &filename) {
   return name;
 }
 
+/**
+ * Checks if helper is valid by running its version command. Result is cached
+ * for the lifetime of the process (as long as the executable does not change
+ * its size), so that i.e. listing helpers doesn't run each of them again.
+ */
+bool is_valid_helper(const Helper_name &name) {
+  static std::mutex mutex;
+  static std::map<std::pair<std::string, size_t>, bool> validated;
+
+  std::pair<std::string, size_t> key{name.path(), 0};
+
+  try {
+    key.second = shcore::file_size(key.first);
+  } catch (const std::exception &) {
+    // run the check anyway, it will report the error
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = validated.find(key);
+
+    if (validated.end() != it) {
+      return it->second;
+    }
+  }
+
+  const auto valid = Helper_invoker{name}.version();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  validated[key] = valid;
+
+  return valid;
+}
+
 }  // namespace
 
 std::vector<Helper_name> get_available_helpers(
@@ -70,7 +108,7 @@ std::vector<Helper_name> get_available_helpers(
       Helper_name name{get_helper_name(entry), path};
 
       // check if helper is valid by running test command
-      if (Helper_invoker{name}.version()) {
+      if (is_valid_helper(name)) {
         helpers.push_back(name);
       }
     }
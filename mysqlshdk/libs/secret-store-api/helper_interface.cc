@@ -26,12 +26,14 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <chrono>
 #include <set>
 #include <vector>
 
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/secret-store-api/helper_invoker.h"
+#include "mysqlshdk/libs/secret-store-api/secret_cache.h"
 
 namespace mysql {
 namespace secret_store {
@@ -45,6 +47,9 @@ constexpr auto k_server_url = "ServerURL";
 
 constexpr auto k_secret_type_password = "password";
 
+// how long secrets retrieved from a helper are kept in memory
+constexpr std::chrono::seconds k_secret_cache_ttl{60};
+
 void throw_json_error(const std::string &msg) {
   throw std::runtime_error{"Failed to parse JSON output: " + msg};
 }
@@ -222,8 +227,10 @@ class Helper_interface::Helper_interface_impl {
       bool ret = m_invoker.store(to_string(spec, secret), &output);
 
       if (ret) {
+        m_cache.put(to_string(spec), secret);
         clear_last_error();
       } else {
+        m_cache.erase(to_string(spec));
         set_last_error(output);
       }
 
@@ -241,11 +248,19 @@ class Helper_interface::Helper_interface_impl {
     }
 
     try {
+      const auto id = to_string(spec);
+
+      if (m_cache.get(id, secret)) {
+        clear_last_error();
+        return true;
+      }
+
       std::string output;
-      bool ret = m_invoker.get(to_string(spec), &output);
+      bool ret = m_invoker.get(id, &output);
 
       if (ret) {
         *secret = to_secret(output).second;
+        m_cache.put(id, *secret);
         clear_last_error();
       } else {
         set_last_error(output);
@@ -260,8 +275,11 @@ class Helper_interface::Helper_interface_impl {
 
   bool erase(const Secret_spec &spec) noexcept {
     try {
+      const auto id = to_string(spec);
+      m_cache.erase(id);
+
       std::string output;
-      bool ret = m_invoker.erase(to_string(spec), &output);
+      bool ret = m_invoker.erase(id, &output);
 
       if (ret) {
         clear_last_error();
@@ -309,6 +327,7 @@ class Helper_interface::Helper_interface_impl {
 
   Helper_invoker m_invoker;
   mutable std::string m_last_error;
+  mutable Secret_cache m_cache{k_secret_cache_ttl};
 };
 
 Helper_interface::Helper_interface(const Helper_name &name) noexcept
@@ -23,8 +23,12 @@
 
 #include "mysqlshdk/libs/secret-store-api/helper_invoker.h"
 
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
 #include <vector>
 
+#include "mysql-secret-store/include/mysql-secret-store/protocol.h"
 #include "mysqlshdk/libs/utils/process_launcher.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -38,6 +42,7 @@ namespace api {
 namespace {
 
 constexpr auto k_secret = "\"Secret\"";
+constexpr auto k_version_command = "version";
 
 std::string hide_secret(const std::string &s) {
   const auto pos = s.find(k_secret);
@@ -54,8 +59,119 @@ std::string hide_secret(const std::string &s) {
 
 }  // namespace
 
+/**
+ * Helper process running in the serve mode, see protocol::k_serve_command.
+ */
+class Helper_invoker::Server final {
+ public:
+  explicit Server(const std::string &path)
+      : m_path{path},
+        m_args{m_path.c_str(), protocol::k_serve_command, nullptr},
+        // stderr is not redirected, anything helper writes there (i.e.
+        // warnings of the libraries it uses) would corrupt the responses; it
+        // is inherited from the shell instead, so it does not need draining
+        m_process{m_args, false} {}
+
+  Server(const Server &) = delete;
+  Server(Server &&) = delete;
+  Server &operator=(const Server &) = delete;
+  Server &operator=(Server &&) = delete;
+
+  ~Server() {
+    if (m_started) {
+      try {
+        // helper finishes once its input is closed
+        m_process.finish_writing();
+        m_process.wait();
+      } catch (const std::exception &ex) {
+        logger::log(std::string{"  Failed to stop the helper process: "} +
+                    ex.what());
+      }
+    }
+  }
+
+  /**
+   * Starts the helper process.
+   *
+   * @returns false if helper does not support the serve mode
+   */
+  bool start() {
+    m_process.start();
+    m_started = true;
+
+    return protocol::k_ready == shcore::str_strip(m_process.read_line());
+  }
+
+  /**
+   * Executes the command.
+   *
+   * @param command Name of the command.
+   * @param input Input of the command.
+   * @param output Output of the command.
+   * @param sent Set to true once request was sent to the helper.
+   *
+   * @returns true if command succeeded
+   * @throws std::exception in case of communication errors
+   */
+  bool execute(const char *command, const std::string &input,
+               std::string *output, bool *sent) {
+    write(std::string{command} + " " + std::to_string(input.length()) + "\n");
+    write(input);
+    *sent = true;
+
+    bool eof = false;
+    const auto header = shcore::str_strip(m_process.read_line(&eof));
+    int status = 0;
+    std::size_t size = 0;
+
+    if (eof || !(std::istringstream{header} >> status >> size)) {
+      throw std::runtime_error{"Malformed response: '" + header + "'"};
+    }
+
+    std::string payload(size, '\0');
+    std::size_t offset = 0;
+
+    while (offset < size) {
+      const auto bytes = m_process.read(&payload[offset], size - offset);
+
+      if (bytes <= 0) {
+        throw std::runtime_error{"Truncated response"};
+      }
+
+      offset += bytes;
+    }
+
+    *output = shcore::str_strip(payload);
+
+    return 0 == status;
+  }
+
+ private:
+  void write(const std::string &data) {
+    std::size_t offset = 0;
+
+    while (offset < data.length()) {
+      const auto bytes =
+          m_process.write(data.c_str() + offset, data.length() - offset);
+
+      if (bytes <= 0) {
+        throw std::runtime_error{"Failed to write to the helper process"};
+      }
+
+      offset += bytes;
+    }
+  }
+
+  std::string m_path;
+  const char *const m_args[3];
+  shcore::Process_launcher m_process;
+  bool m_started = false;
+};
+
 Helper_invoker::Helper_invoker(const Helper_name &name) : m_name{name} {}
 
+Helper_invoker::~Helper_invoker() = default;
+
 bool Helper_invoker::store(const std::string &input) const {
   std::string output;
   return store(input, &output);
@@ -90,11 +206,85 @@ bool Helper_invoker::version() const {
 }
 
 bool Helper_invoker::version(std::string *output) const {
-  return invoke("version", {}, output);
+  return invoke(k_version_command, {}, output);
 }
 
 bool Helper_invoker::invoke(const char *command, const std::string &input,
                             std::string *output) const {
+  bool result = false;
+
+  // version is used to check whether the executable is a valid helper, run it
+  // in a new process
+  if (strcmp(command, k_version_command) != 0 &&
+      invoke_server(command, input, output, &result)) {
+    return result;
+  }
+
+  return invoke_process(command, input, output);
+}
+
+bool Helper_invoker::invoke_server(const char *command,
+                                   const std::string &input,
+                                   std::string *output, bool *result) const {
+  std::lock_guard<std::mutex> lock(m_server_mutex);
+
+  if (m_server_unsupported) {
+    return false;
+  }
+
+  bool sent = false;
+
+  try {
+    if (!m_server) {
+      logger::log("Starting helper process");
+      logger::log("  Command line: " + m_name.path() + " " +
+                  protocol::k_serve_command);
+
+      std::unique_ptr<Server> server{new Server{m_name.path()}};
+
+      if (!server->start()) {
+        logger::log(
+            "  Helper does not support persistent mode, a new process is "
+            "going to be started for each command");
+        m_server_unsupported = true;
+        return false;
+      }
+
+      m_server = std::move(server);
+    }
+
+    logger::log("Invoking helper process");
+    logger::log(std::string{"  Command: "} + command);
+    logger::log("  Input: " + hide_secret(input));
+
+    *result = m_server->execute(command, input, output, &sent);
+
+    logger::log("  Output: " + hide_secret(*output));
+    logger::log(std::string{"  Result: "} + (*result ? "success" : "failure"));
+
+    return true;
+  } catch (const std::exception &ex) {
+    logger::log(std::string{"  Helper process has failed: "} + ex.what());
+
+    // process is going to be restarted by the next command
+    m_server.reset();
+
+    if (!sent) {
+      // command was not executed, it's safe to retry it in a new process
+      return false;
+    }
+
+    *output = std::string{"Exception caught while running helper command '"} +
+              command + "': " + ex.what();
+    *result = false;
+
+    return true;
+  }
+}
+
+bool Helper_invoker::invoke_process(const char *command,
+                                    const std::string &input,
+                                    std::string *output) const {
   try {
     std::string path = m_name.path();
     const char *const args[] = {path.c_str(), command, nullptr};
@@ -24,6 +24,8 @@
 #ifndef MYSQLSHDK_LIBS_SECRET_STORE_API_HELPER_INVOKER_H_
 #define MYSQLSHDK_LIBS_SECRET_STORE_API_HELPER_INVOKER_H_
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
@@ -32,10 +34,26 @@ namespace mysql {
 namespace secret_store {
 namespace api {
 
+/**
+ * Executes commands of a helper.
+ *
+ * The version command, which is used to validate helpers, always runs a new
+ * helper process. Remaining commands are sent to a helper process which is
+ * started on the first use and then kept running for the lifetime of this
+ * object. If the helper doesn't support this mode, a new process is started
+ * for each command.
+ */
 class Helper_invoker {
  public:
   explicit Helper_invoker(const Helper_name &name);
 
+  Helper_invoker(const Helper_invoker &) = delete;
+  Helper_invoker(Helper_invoker &&) = delete;
+  Helper_invoker &operator=(const Helper_invoker &) = delete;
+  Helper_invoker &operator=(Helper_invoker &&) = delete;
+
+  ~Helper_invoker();
+
   Helper_name name() const noexcept { return m_name; }
 
   bool store(const std::string &input) const;
@@ -55,9 +73,26 @@ class Helper_invoker {
   bool version(std::string *output) const;
 
  private:
+  class Server;
+
   bool invoke(const char *command, const std::string &input,
               std::string *output) const;
+
+  bool invoke_process(const char *command, const std::string &input,
+                      std::string *output) const;
+
+  /**
+   * Sends the command to the persistent helper process.
+   *
+   * @returns false if the command could not be sent, output is not set then
+   */
+  bool invoke_server(const char *command, const std::string &input,
+                     std::string *output, bool *result) const;
+
   Helper_name m_name;
+  mutable std::mutex m_server_mutex;
+  mutable std::unique_ptr<Server> m_server;
+  mutable bool m_server_unsupported = false;
 };
 
 }  // namespace api
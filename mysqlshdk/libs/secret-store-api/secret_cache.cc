@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/secret-store-api/secret_cache.h"
+
+namespace mysql {
+namespace secret_store {
+namespace api {
+
+bool Secret_cache::get(const std::string &id, std::string *secret) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto entry = m_entries.find(id);
+
+  if (m_entries.end() == entry) {
+    return false;
+  }
+
+  if (entry->second.expires <= std::chrono::steady_clock::now()) {
+    m_entries.erase(entry);
+    return false;
+  }
+
+  *secret = entry->second.secret;
+  return true;
+}
+
+void Secret_cache::put(const std::string &id, const std::string &secret) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto now = std::chrono::steady_clock::now();
+
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    if (it->second.expires <= now) {
+      it = m_entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  m_entries[id] = {secret, now + m_ttl};
+}
+
+void Secret_cache::erase(const std::string &id) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.erase(id);
+}
+
+std::size_t Secret_cache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+}  // namespace api
+}  // namespace secret_store
+}  // namespace mysql
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_SECRET_STORE_API_SECRET_CACHE_H_
+#define MYSQLSHDK_LIBS_SECRET_STORE_API_SECRET_CACHE_H_
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace mysql {
+namespace secret_store {
+namespace api {
+
+/**
+ * Holds secrets retrieved recently, so that i.e. opening many sessions to the
+ * same server does not query the helper each time.
+ */
+class Secret_cache final {
+ public:
+  /**
+   * Creates the cache.
+   *
+   * @param ttl How long the secrets are kept in memory.
+   */
+  explicit Secret_cache(std::chrono::milliseconds ttl) : m_ttl(ttl) {}
+
+  Secret_cache(const Secret_cache &) = delete;
+  Secret_cache(Secret_cache &&) = delete;
+  Secret_cache &operator=(const Secret_cache &) = delete;
+  Secret_cache &operator=(Secret_cache &&) = delete;
+
+  ~Secret_cache() = default;
+
+  /**
+   * Provides the cached secret.
+   *
+   * @param id ID of the secret.
+   * @param secret Set to the cached secret.
+   *
+   * @returns false if secret is not cached or it has expired
+   */
+  bool get(const std::string &id, std::string *secret);
+
+  /**
+   * Caches the secret, removes the expired ones.
+   *
+   * @param id ID of the secret.
+   * @param secret The secret.
+   */
+  void put(const std::string &id, const std::string &secret);
+
+  /**
+   * Removes the secret from the cache.
+   *
+   * @param id ID of the secret.
+   */
+  void erase(const std::string &id);
+
+  /**
+   * Provides number of secrets held in memory, including the expired ones.
+   */
+  std::size_t size() const;
+
+ private:
+  struct Entry {
+    std::string secret;
+    std::chrono::steady_clock::time_point expires;
+  };
+
+  const std::chrono::milliseconds m_ttl;
+  mutable std::mutex m_mutex;
+  std::map<std::string, Entry> m_entries;
+};
+
+}  // namespace api
+}  // namespace secret_store
+}  // namespace mysql
+
+#endif  // MYSQLSHDK_LIBS_SECRET_STORE_API_SECRET_CACHE_H_
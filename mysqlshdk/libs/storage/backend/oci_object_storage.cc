@@ -374,59 +374,14 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
       size_t buffer_space = MY_MAX_PART_SIZE - m_buffer.size();
       m_buffer.append(incoming + incoming_offset, buffer_space);
 
-      try {
-        m_parts.push_back(
-            m_object->m_bucket->upload_part(m_multipart, m_parts.size() + 1,
-                                            m_buffer.data(), MY_MAX_PART_SIZE));
-      } catch (const mysqlshdk::rest::Response_error &error) {
-        try {
-          log_info(
-              "Cancelling multipart upload after failure uploading part, "
-              "error %s\nobject: %s\n upload id: %s",
-              error.format().c_str(), m_multipart.name.c_str(),
-              m_multipart.upload_id.c_str());
-
-          m_object->m_bucket->abort_multipart_upload(m_multipart);
-        } catch (const mysqlshdk::rest::Response_error &inner_error) {
-          log_error(
-              "Error cancelling multipart upload after failure uploading "
-              "part, "
-              "error %s\nobject: %s\n upload id: %s",
-              inner_error.format().c_str(), m_multipart.name.c_str(),
-              m_multipart.upload_id.c_str());
-        }
+      upload_part(std::move(m_buffer));
 
-        throw shcore::Exception::runtime_error(error.format());
-      }
       m_buffer.clear();
       incoming_offset += buffer_space;
       to_send -= MY_MAX_PART_SIZE;
     } else {
       // NO BUFFERED DATA: sends the data directly from the incoming buffer
-      try {
-        m_parts.push_back(m_object->m_bucket->upload_part(
-            m_multipart, m_parts.size() + 1, incoming + incoming_offset,
-            MY_MAX_PART_SIZE));
-      } catch (const mysqlshdk::rest::Response_error &error) {
-        try {
-          log_info(
-              "Cancelling multipart upload after failure uploading part, "
-              "error %s\nobject: %s\n upload id: %s",
-              error.format().c_str(), m_multipart.name.c_str(),
-              m_multipart.upload_id.c_str());
-
-          m_object->m_bucket->abort_multipart_upload(m_multipart);
-        } catch (const mysqlshdk::rest::Response_error &inner_error) {
-          log_error(
-              "Error cancelling multipart upload after failure uploading "
-              "part, "
-              "error %s\nobject: %s\n upload id: %s",
-              inner_error.format().c_str(), m_multipart.name.c_str(),
-              m_multipart.upload_id.c_str());
-        }
-
-        throw shcore::Exception::runtime_error(error.format());
-      }
+      upload_part(std::string(incoming + incoming_offset, MY_MAX_PART_SIZE));
 
       incoming_offset += MY_MAX_PART_SIZE;
       to_send -= MY_MAX_PART_SIZE;
@@ -443,32 +398,62 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
   return length;
 }
 
+void Object::Writer::upload_part(std::string data) {
+  // makes room for the new part
+  wait_for_uploads(k_max_parts_in_flight - 1);
+
+  m_uploads.emplace_back(m_object->m_bucket->upload_part_async(
+      m_multipart, m_parts.size() + m_uploads.size() + 1, std::move(data)));
+}
+
+void Object::Writer::wait_for_uploads(size_t max_in_flight) {
+  while (m_uploads.size() > max_in_flight) {
+    try {
+      m_parts.push_back(m_uploads.front().wait());
+      m_uploads.pop_front();
+    } catch (const mysqlshdk::rest::Response_error &error) {
+      abort_upload(error, "uploading part");
+      throw shcore::Exception::runtime_error(error.format());
+    }
+  }
+}
+
+void Object::Writer::abort_upload(const mysqlshdk::rest::Response_error &error,
+                                  const char *context) {
+  // waits for any uploads which are still in progress
+  m_uploads.clear();
+
+  try {
+    log_info(
+        "Cancelling multipart upload after failure %s, error %s\nobject: "
+        "%s\n upload id: %s",
+        context, error.format().c_str(), m_multipart.name.c_str(),
+        m_multipart.upload_id.c_str());
+
+    m_object->m_bucket->abort_multipart_upload(m_multipart);
+  } catch (const mysqlshdk::rest::Response_error &inner_error) {
+    log_error(
+        "Error cancelling multipart upload after failure %s, error "
+        "%s\nobject: %s\n upload id: %s",
+        context, inner_error.format().c_str(), m_multipart.name.c_str(),
+        m_multipart.upload_id.c_str());
+  }
+}
+
 void Object::Writer::close() {
   if (m_is_multipart) {
     // MULTIPART UPLOAD STARTED: Sends last part if any and commits the upload
     try {
       if (!m_buffer.empty()) {
-        m_parts.push_back(m_object->m_bucket->upload_part(
-            m_multipart, m_parts.size() + 1, m_buffer.data(), m_buffer.size()));
+        upload_part(std::move(m_buffer));
+        m_buffer.clear();
       }
 
+      wait_for_uploads(0);
+
       m_object->m_bucket->commit_multipart_upload(m_multipart, m_parts);
     } catch (const mysqlshdk::rest::Response_error &error) {
-      try {
-        log_info(
-            "Cancelling multipart upload after failure completing the "
-            "upload, error %s\nobject: %s\n upload id: %s",
-            error.format().c_str(), m_multipart.name.c_str(),
-            m_multipart.upload_id.c_str());
-
-        m_object->m_bucket->abort_multipart_upload(m_multipart);
-      } catch (const mysqlshdk::rest::Response_error &inner_error) {
-        log_error(
-            "Error cancelling multipart upload after failure completing the "
-            "upload, error %s\nobject: %s\n upload id: %s",
-            inner_error.format().c_str(), m_multipart.name.c_str(),
-            m_multipart.upload_id.c_str());
-      }
+      abort_upload(error, "completing the upload");
 
       throw shcore::Exception::runtime_error(error.format());
     } catch (const mysqlshdk::rest::Connection_error &error) {
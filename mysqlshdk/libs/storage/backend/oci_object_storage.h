@@ -25,6 +25,7 @@
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_OCI_OBJECT_STORAGE_H_
 
 #include <openssl/evp.h>
+#include <deque>
 #include <string>
 
 #include "mysqlshdk/libs/config/config_file.h"
@@ -49,6 +50,7 @@ using mysqlshdk::oci::Multipart_object;
 using mysqlshdk::oci::Multipart_object_part;
 using mysqlshdk::oci::Oci_options;
 using mysqlshdk::oci::Oci_rest_service;
+using mysqlshdk::oci::Part_upload;
 
 /**
  * Emulates a directory behavior in a Bucket.
@@ -302,11 +304,22 @@ class Object : public mysqlshdk::storage::IFile {
     void close();
 
    private:
+    // while a part is being uploaded, the next one is being buffered
+    static constexpr size_t k_max_parts_in_flight = 1;
+
+    void upload_part(std::string data);
+
+    void wait_for_uploads(size_t max_in_flight);
+
+    void abort_upload(const mysqlshdk::rest::Response_error &error,
+                      const char *context);
+
     std::string m_buffer;
 
     bool m_is_multipart;
     Multipart_object m_multipart;
     std::vector<Multipart_object_part> m_parts;
+    std::deque<Part_upload> m_uploads;
   };
 
   /**
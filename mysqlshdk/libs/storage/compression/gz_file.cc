@@ -80,7 +80,20 @@ ssize_t Gz_file::read(void *buffer, size_t length) {
     if (consume_bytes > 0) {
       consume(consume_bytes);
     }
-    if (result == Z_STREAM_END || result == Z_BUF_ERROR) {
+    if (result == Z_STREAM_END) {
+      // file may hold multiple concatenated gzip members, continue with the
+      // next one if there's more input
+      if (peek(CHUNK).length == 0) {
+        break;
+      }
+
+      result = inflateReset(&m_stream);
+
+      if (Z_OK != result) {
+        throw std::runtime_error(std::string("inflate reset failed: ") +
+                                 (m_stream.msg ? m_stream.msg : ""));
+      }
+    } else if (result == Z_BUF_ERROR) {
       break;
     }
   }
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/compression/zstd_buffer.h"
+
+#include <zstd.h>
+#include <stdexcept>
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+void zstd_compress(const char *data, std::size_t length, int level,
+                   std::string *out) {
+  out->resize(ZSTD_compressBound(length));
+
+  const auto size = ZSTD_compress(&(*out)[0], out->size(), data, length, level);
+
+  if (ZSTD_isError(size)) {
+    throw std::runtime_error(std::string("zstd.compress: ") +
+                             ZSTD_getErrorName(size));
+  }
+
+  out->resize(size);
+}
+
+void zstd_decompress(const char *data, std::size_t length,
+                     std::size_t decompressed_length, std::string *out) {
+  out->resize(decompressed_length);
+
+  const auto size = ZSTD_decompress(&(*out)[0], out->size(), data, length);
+
+  if (ZSTD_isError(size)) {
+    throw std::runtime_error(std::string("zstd.decompress: ") +
+                             ZSTD_getErrorName(size));
+  }
+
+  if (size != decompressed_length) {
+    throw std::runtime_error(
+        "zstd.decompress: unexpected size of the decompressed data");
+  }
+}
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
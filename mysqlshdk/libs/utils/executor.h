@@ -0,0 +1,411 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_EXECUTOR_H_
+#define MYSQLSHDK_LIBS_UTILS_EXECUTOR_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+/**
+ * Executes tasks using a fixed number of workers.
+ *
+ * Each worker owns a deque per priority. Tasks submitted by a worker are put
+ * in its own deque, tasks submitted by other threads are distributed between
+ * the workers in a round-robin fashion. A worker takes tasks from the front of
+ * its own deques and, once they are empty, steals from the back of the deques
+ * of other workers, so threads do not contend on a single queue and do not
+ * stay idle while there's work to be done. Tasks with a higher priority are
+ * executed first (this is best-effort, there's no global ordering).
+ *
+ * Workers are either threads started by the executor (start()), or threads
+ * owned by the caller which call run(), i.e. when each thread needs to set up
+ * its own context (like a session) before executing any tasks. In both cases,
+ * Args are passed to each executed task.
+ *
+ * run() returns once finish() was called and all tasks are done, or once the
+ * executor is cancelled. Exception thrown by a task is propagated by run().
+ *
+ * Tasks have to be independent of each other: once submitted, a task may be
+ * executed by any worker, in any order. This is not suitable for schedulers
+ * which choose the next task when a worker becomes idle, based on what other
+ * workers are doing (i.e. the dump loader, which limits the number of threads
+ * loading the same table and defers indexes until a table is fully loaded).
+ */
+template <class... Args>
+class Executor final {
+ public:
+  using Task = std::function<void(Args...)>;
+
+  struct Statistics {
+    uint64_t tasks = 0;
+    uint64_t stolen_tasks = 0;
+    double busy_seconds = 0.0;
+    double longest_task_seconds = 0.0;
+
+    Statistics &operator+=(const Statistics &other) {
+      tasks += other.tasks;
+      stolen_tasks += other.stolen_tasks;
+      busy_seconds += other.busy_seconds;
+      longest_task_seconds =
+          std::max(longest_task_seconds, other.longest_task_seconds);
+      return *this;
+    }
+  };
+
+  Executor(std::size_t workers, const std::string &name) : m_name(name) {
+    workers = std::max<std::size_t>(workers, 1);
+
+    for (auto &pending : m_pending) {
+      pending = 0;
+    }
+
+    for (std::size_t i = 0; i < workers; ++i) {
+      m_workers.emplace_back(std::make_unique<Worker>());
+    }
+  }
+
+  Executor(const Executor &) = delete;
+  Executor(Executor &&) = delete;
+
+  Executor &operator=(const Executor &) = delete;
+  Executor &operator=(Executor &&) = delete;
+
+  ~Executor() {
+    if (!m_threads.empty()) {
+      cancel();
+      join();
+    }
+  }
+
+  std::size_t size() const { return m_workers.size(); }
+
+  const std::string &name() const { return m_name; }
+
+  /**
+   * Schedules execution of the given task. Task is silently discarded if
+   * executor was cancelled.
+   */
+  void submit(
+      Task task,
+      shcore::Queue_priority priority = shcore::Queue_priority::MEDIUM) {
+    if (m_cancelled) {
+      return;
+    }
+
+    const auto level = to_level(priority);
+    const auto id = this == s_executor
+                        ? s_worker_id
+                        : m_next_worker.fetch_add(1) % m_workers.size();
+    auto &worker = *m_workers[id];
+
+    {
+      std::lock_guard<std::mutex> lock(worker.mutex);
+      worker.queues[level].emplace_back(std::move(task));
+      ++m_pending[level];
+      ++m_total_pending;
+    }
+
+    if (m_idle > 0) {
+      {
+        // synchronize with the workers which are about to go idle
+        std::lock_guard<std::mutex> lock(m_idle_mutex);
+      }
+      m_work_available.notify_one();
+    }
+  }
+
+  /**
+   * Signals that no more tasks are going to be submitted from outside of the
+   * executor. Workers finish once all tasks are executed (including the ones
+   * submitted by the tasks).
+   */
+  void finish() {
+    {
+      std::lock_guard<std::mutex> lock(m_idle_mutex);
+      m_finished = true;
+    }
+    m_work_available.notify_all();
+  }
+
+  /**
+   * Discards all pending tasks, workers finish after executing the current
+   * task.
+   */
+  void cancel() {
+    {
+      std::lock_guard<std::mutex> lock(m_idle_mutex);
+      m_cancelled = true;
+    }
+
+    for (auto &worker : m_workers) {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+
+      for (std::size_t level = 0; level < k_levels; ++level) {
+        m_pending[level] -= worker->queues[level].size();
+        m_total_pending -= worker->queues[level].size();
+        worker->queues[level].clear();
+      }
+    }
+
+    m_work_available.notify_all();
+  }
+
+  bool cancelled() const { return m_cancelled; }
+
+  /**
+   * Executes tasks in the calling thread, acting as the worker with the given
+   * ID. Each worker ID can be used by one thread at a time.
+   */
+  void run(std::size_t id, Args... args) {
+    assert(id < m_workers.size());
+
+    const auto previous_executor = s_executor;
+    const auto previous_worker_id = s_worker_id;
+
+    s_executor = this;
+    s_worker_id = id;
+
+    shcore::on_leave_scope restore([previous_executor, previous_worker_id]() {
+      s_executor = previous_executor;
+      s_worker_id = previous_worker_id;
+    });
+
+    auto &stats = m_workers[id]->stats;
+
+    shcore::on_leave_scope log_stats([this, id, &stats]() {
+      log_debug(
+          "%s worker #%zu executed %" PRIu64 " tasks (%" PRIu64
+          " stolen), busy for %f seconds, longest task took %f seconds",
+          m_name.c_str(), id, stats.tasks, stats.stolen_tasks,
+          stats.busy_seconds, stats.longest_task_seconds);
+    });
+
+    Task task;
+    bool stolen = false;
+
+    while (!m_cancelled) {
+      if (!next_task(id, &task, &stolen)) {
+        if (!wait_for_task()) {
+          break;
+        }
+
+        continue;
+      }
+
+      const auto start = std::chrono::steady_clock::now();
+
+      shcore::on_leave_scope task_done([this, &task, &stats, &start]() {
+        task = nullptr;
+
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        ++stats.tasks;
+        stats.busy_seconds += elapsed.count();
+        stats.longest_task_seconds =
+            std::max(stats.longest_task_seconds, elapsed.count());
+
+        if (0 == --m_active && 0 == m_total_pending) {
+          {
+            std::lock_guard<std::mutex> lock(m_idle_mutex);
+          }
+          m_work_available.notify_all();
+        }
+      });
+
+      if (stolen) {
+        ++stats.stolen_tasks;
+      }
+
+      task(args...);
+    }
+  }
+
+  /**
+   * Starts threads which execute the tasks, threads inherit the logger,
+   * console, shell options and interrupt handler of the calling thread.
+   */
+  void start(Args... args) {
+    if (!m_threads.empty()) {
+      throw std::logic_error("Executor '" + m_name + "' is already started");
+    }
+
+    for (std::size_t i = 0; i < m_workers.size(); ++i) {
+      m_threads.emplace_back(mysqlsh::spawn_scoped_thread(
+          [this, i](Args... a) { run(i, a...); }, args...));
+    }
+  }
+
+  /**
+   * Waits for the threads started with start().
+   */
+  void join() {
+    for (auto &thread : m_threads) {
+      thread.join();
+    }
+
+    m_threads.clear();
+  }
+
+  /**
+   * Statistics of all workers, should be called once workers are finished.
+   */
+  Statistics statistics() const {
+    Statistics result;
+
+    for (const auto &worker : m_workers) {
+      result += worker->stats;
+    }
+
+    return result;
+  }
+
+ private:
+  static constexpr std::size_t k_levels = 3;
+
+  struct Worker {
+    std::mutex mutex;
+    std::array<std::deque<Task>, k_levels> queues;
+    Statistics stats;
+  };
+
+  static constexpr std::size_t to_level(shcore::Queue_priority priority) {
+    return static_cast<std::size_t>(shcore::Queue_priority::HIGH) -
+           static_cast<std::size_t>(priority);
+  }
+
+  bool take(Worker *worker, std::size_t level, bool front, Task *task) {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    auto &queue = worker->queues[level];
+
+    if (queue.empty()) {
+      return false;
+    }
+
+    if (front) {
+      *task = std::move(queue.front());
+      queue.pop_front();
+    } else {
+      *task = std::move(queue.back());
+      queue.pop_back();
+    }
+
+    // task becomes active before it stops being pending, so that the workers
+    // never see both counters equal to zero while there's still work to do
+    ++m_active;
+    --m_pending[level];
+    --m_total_pending;
+
+    return true;
+  }
+
+  bool next_task(std::size_t id, Task *task, bool *stolen) {
+    const auto workers = m_workers.size();
+
+    for (std::size_t level = 0; level < k_levels; ++level) {
+      if (0 == m_pending[level]) {
+        continue;
+      }
+
+      if (take(m_workers[id].get(), level, true, task)) {
+        *stolen = false;
+        return true;
+      }
+
+      for (std::size_t i = 1; i < workers; ++i) {
+        if (take(m_workers[(id + i) % workers].get(), level, false, task)) {
+          *stolen = true;
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+  bool wait_for_task() {
+    std::unique_lock<std::mutex> lock(m_idle_mutex);
+
+    ++m_idle;
+    m_work_available.wait(lock, [this]() {
+      return m_cancelled || m_total_pending > 0 ||
+             (m_finished && 0 == m_active);
+    });
+    --m_idle;
+
+    return !m_cancelled && m_total_pending > 0;
+  }
+
+  std::string m_name;
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::vector<std::thread> m_threads;
+
+  std::array<std::atomic<std::size_t>, k_levels> m_pending;
+  std::atomic<std::size_t> m_total_pending{0};
+  std::atomic<std::size_t> m_active{0};
+  std::atomic<std::size_t> m_next_worker{0};
+  std::atomic<std::size_t> m_idle{0};
+  std::atomic<bool> m_finished{false};
+  std::atomic<bool> m_cancelled{false};
+
+  std::mutex m_idle_mutex;
+  std::condition_variable m_work_available;
+
+  static thread_local const Executor *s_executor;
+  static thread_local std::size_t s_worker_id;
+};
+
+template <class... Args>
+thread_local const Executor<Args...> *Executor<Args...>::s_executor = nullptr;
+
+template <class... Args>
+thread_local std::size_t Executor<Args...>::s_worker_id = 0;
+
+}  // namespace utils
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_UTILS_EXECUTOR_H_
@@ -23,7 +23,9 @@
 
 #include "mysqlshdk/libs/utils/rate_limit.h"
 
+#include <algorithm>
 #include <ratio>
+#include <thread>
 
 #include "mysqlshdk/libs/utils/utils_general.h"
 
@@ -55,5 +57,57 @@ void Rate_limit::throttle(int64_t bytes) {
 
   shcore::sleep_ms(sleep_us / 1000);
 }
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int64_t k_nano = 1000000000;
+
+int64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             Clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+Shared_rate_limit::Shared_rate_limit(int64_t limit,
+                                     std::chrono::milliseconds burst)
+    : m_limit(std::max(limit, INT64_C(0))),
+      m_burst(std::chrono::duration_cast<std::chrono::nanoseconds>(burst)
+                  .count()),
+      m_paid_off(now_ns()) {}
+
+void Shared_rate_limit::set_limit(int64_t limit) {
+  m_limit.store(std::max(limit, INT64_C(0)), std::memory_order_relaxed);
+}
+
+void Shared_rate_limit::throttle(int64_t units) {
+  const auto limit = this->limit();
+
+  if (limit <= 0 || units <= 0) {
+    return;
+  }
+
+  const auto cost =
+      static_cast<int64_t>(static_cast<double>(units) * k_nano / limit);
+  const auto now = now_ns();
+  auto paid_off = m_paid_off.load();
+  int64_t reserved = 0;
+
+  do {
+    // budget which was not used in the past does not accumulate, only the
+    // burst is allowed
+    reserved = std::max(paid_off, now) + cost;
+  } while (!m_paid_off.compare_exchange_weak(paid_off, reserved));
+
+  const auto wait = reserved - m_burst - now;
+
+  if (wait > 0) {
+    std::this_thread::sleep_for(std::chrono::nanoseconds(wait));
+  }
+}
+
 } /* namespace utils */
 } /* namespace mysqlshdk */
@@ -25,6 +25,7 @@
 #define MYSQLSHDK_LIBS_UTILS_RATE_LIMIT_H_
 
 #include <sys/types.h>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 
@@ -59,6 +60,53 @@ class Rate_limit final {
   std::chrono::high_resolution_clock::time_point m_last{};
 };
 
+/**
+ * Token bucket which limits the aggregate throughput of all the threads which
+ * share it. Limit is measured in units (i.e. bytes, rows) per second and can be
+ * changed at any time.
+ *
+ * Each call to throttle() reserves the requested number of units, threads are
+ * resumed in the order in which reservations were made. Unused budget is
+ * accumulated up to the size of a burst.
+ */
+class Shared_rate_limit final {
+ public:
+  explicit Shared_rate_limit(
+      int64_t limit = 0,
+      std::chrono::milliseconds burst = std::chrono::milliseconds(100));
+
+  Shared_rate_limit(const Shared_rate_limit &other) = delete;
+  Shared_rate_limit(Shared_rate_limit &&other) = delete;
+
+  Shared_rate_limit &operator=(const Shared_rate_limit &other) = delete;
+  Shared_rate_limit &operator=(Shared_rate_limit &&other) = delete;
+
+  ~Shared_rate_limit() = default;
+
+  bool enabled() const { return limit() > 0; }
+
+  int64_t limit() const { return m_limit.load(std::memory_order_relaxed); }
+
+  /**
+   * Changes the limit, 0 disables the limiter. Threads which are already
+   * waiting are not affected.
+   */
+  void set_limit(int64_t limit);
+
+  /**
+   * Consumes the given number of units, blocks the calling thread if budget is
+   * exhausted.
+   */
+  void throttle(int64_t units);
+
+ private:
+  std::atomic<int64_t> m_limit;
+  const int64_t m_burst;
+  // time (in nanoseconds since clock's epoch) at which all the reservations
+  // made so far are paid off
+  std::atomic<int64_t> m_paid_off;
+};
+
 } /* namespace utils */
 } /* namespace mysqlshdk */
 
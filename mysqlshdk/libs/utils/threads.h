@@ -24,17 +24,21 @@
 #ifndef MYSQLSHDK_LIBS_UTILS_THREADS_H_
 #define MYSQLSHDK_LIBS_UTILS_THREADS_H_
 
-#include <atomic>
-#include <functional>
-#include <string>
-#include <thread>
-#include <utility>
-#include <vector>
-#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "mysqlshdk/libs/utils/executor.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 
 namespace mysqlshdk {
 namespace utils {
+
+/**
+ * Maximum number of threads used by map_reduce().
+ */
+constexpr std::size_t k_map_reduce_max_threads = 64;
+
 /**
  * Executes the map function on each value of the given list in parallel and
  * return the aggregation of their results, as computed by the reduce function.
@@ -45,32 +49,30 @@ namespace utils {
 template <class OutputT, class IntermediateT, class InputIter, class MapF,
           class ReduceF>
 OutputT map_reduce(InputIter begin, InputIter end, MapF map, ReduceF reduce) {
-  shcore::Synchronized_queue<std::pair<size_t, IntermediateT>> results;
-  std::vector<std::thread> workers;
+  const auto count = static_cast<std::size_t>(std::distance(begin, end));
+  auto result = OutputT();
 
-  auto iter = begin;
-  // start computation in threads
-  while (iter != end) {
-    size_t index = workers.size();
-    workers.push_back(
-        mysqlsh::spawn_scoped_thread([&results, map, iter, index]() {
-          results.push({index, map(*iter)});
-        }));
-    ++iter;
+  if (0 == count) {
+    return result;
   }
 
-  // wait for threads to finish
-  auto result = OutputT();
-  int threads_left = workers.size();
-  while (threads_left > 0) {
-    std::pair<size_t, IntermediateT> r = results.pop();
+  shcore::Synchronized_queue<IntermediateT> results;
+  Executor<> executor{std::min(count, k_map_reduce_max_threads),
+                      "map_reduce"};
 
-    workers[r.first].join();
-    threads_left--;
+  for (auto iter = begin; iter != end; ++iter) {
+    executor.submit([&results, &map, iter]() { results.push(map(*iter)); });
+  }
 
-    result = reduce(result, r.second);
+  executor.finish();
+  executor.start();
+
+  for (std::size_t i = 0; i < count; ++i) {
+    result = reduce(result, results.pop());
   }
 
+  executor.join();
+
   return result;
 }
 
@@ -32,7 +32,9 @@
 
 #ifdef WIN32
 #include <Lmcons.h>
+#include <psapi.h>
 #else
+#include <sys/resource.h>
 #include <unistd.h>
 #ifdef HAVE_GETPWUID_R
 #include <pwd.h>
@@ -375,6 +377,30 @@ std::string get_system_user() {
   return ret_val;
 }
 
+uint64_t get_peak_memory_usage() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return counters.PeakWorkingSetSize;
+  }
+#else
+  struct rusage usage;
+
+  if (0 == getrusage(RUSAGE_SELF, &usage) && usage.ru_maxrss > 0) {
+#ifdef __APPLE__
+    // macOS reports the value in bytes
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    // value is in kilobytes
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+
+  return 0;
+}
+
 std::string errno_to_string(int err) {
 #ifdef _WIN32
 #define strerror_r(E, B, S) strerror_s(B, S, E)
@@ -152,6 +152,13 @@ void SHCORE_PUBLIC update_connection_data(
 
 std::string SHCORE_PUBLIC get_system_user();
 
+/**
+ * Provides the peak resident set size of the current process.
+ *
+ * @returns peak memory usage in bytes, 0 if it cannot be determined
+ */
+uint64_t SHCORE_PUBLIC get_peak_memory_usage();
+
 std::string SHCORE_PUBLIC strip_password(const std::string &connstring);
 
 std::string SHCORE_PUBLIC strip_ssl_args(const std::string &connstring);
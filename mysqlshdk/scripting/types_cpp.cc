@@ -305,15 +305,65 @@ void Cpp_function::Metadata::set(const std::string &name_, Value_type rtype,
   return_type = rtype;
 }
 
-Cpp_object_bridge::Cpp_object_bridge() {
+Cpp_object_bridge::Cpp_object_bridge()
+    : _funcs(std::make_shared<Function_map>()) {
   expose("help", &Cpp_object_bridge::help, "?item");
 }
 
+Cpp_object_bridge::Cpp_object_bridge(
+    const std::shared_ptr<Function_map> &methods)
+    : _funcs(methods), _funcs_shared(true) {
+  assert(_funcs);
+}
+
 Cpp_object_bridge::~Cpp_object_bridge() {
-  _funcs.clear();
+  _funcs.reset();
   _properties.clear();
 }
 
+std::shared_ptr<Cpp_object_bridge::Function_map>
+Cpp_object_bridge::make_method_table() {
+  auto table = std::make_shared<Function_map>();
+  expose(table.get(), "help", &Cpp_object_bridge::help, "?item");
+  return table;
+}
+
+void Cpp_object_bridge::add_property_getter(Function_map *table,
+                                            const std::string &name,
+                                            const std::string &getter) {
+  std::shared_ptr<Cpp_function> function(
+      new Cpp_function(getter, nullptr, {}));
+  function->is_legacy = true;
+  function->_method = [getter, name](Cpp_object_bridge *object,
+                                     const Argument_list &args) {
+    return object->get_member_method(args, getter, name);
+  };
+  table->emplace(getter, std::move(function));
+}
+
+Cpp_object_bridge::Function_map &Cpp_object_bridge::own_funcs() {
+  if (_funcs_shared) {
+    _funcs = std::make_shared<Function_map>(*_funcs);
+    _funcs_shared = false;
+  }
+
+  return *_funcs;
+}
+
+std::shared_ptr<Cpp_function> Cpp_object_bridge::bind(
+    const std::shared_ptr<Cpp_function> &func) const {
+  if (func->is_bound()) return func;
+
+  const auto object = const_cast<Cpp_object_bridge *>(this);
+  std::shared_ptr<Cpp_function> bound(new Cpp_function(
+      func->get_metadata(), [object, func](const Argument_list &args) {
+        return func->_method(object, args);
+      }));
+  bound->is_legacy = func->is_legacy;
+
+  return bound;
+}
+
 std::string &Cpp_object_bridge::append_descr(std::string &s_out, int,
                                              int) const {
   s_out.append("<" + class_name() + ">");
@@ -330,7 +380,7 @@ std::vector<std::string> Cpp_object_bridge::get_members() const {
   for (const auto &prop : _properties)
     members.push_back(prop.name(current_naming_style()));
 
-  for (const auto &func : _funcs) {
+  for (const auto &func : *_funcs) {
     members.push_back(func.second->name(current_naming_style()));
   }
   return members;
@@ -381,12 +431,12 @@ Value Cpp_object_bridge::get_member_advanced(const std::string &prop) const {
   Value ret_val;
 
   auto func = std::find_if(
-      _funcs.begin(), _funcs.end(), [prop](const FunctionEntry &f) {
+      _funcs->begin(), _funcs->end(), [prop](const FunctionEntry &f) {
         return f.second->name(current_naming_style()) == prop;
       });
 
-  if (func != _funcs.end()) {
-    ret_val = Value(std::shared_ptr<Function_base>(func->second));
+  if (func != _funcs->end()) {
+    ret_val = Value(std::shared_ptr<Function_base>(bind(func->second)));
   } else {
     auto prop_index =
         std::find_if(_properties.begin(), _properties.end(),
@@ -403,9 +453,9 @@ Value Cpp_object_bridge::get_member_advanced(const std::string &prop) const {
 }
 
 Value Cpp_object_bridge::get_member(const std::string &prop) const {
-  std::map<std::string, std::shared_ptr<Cpp_function>>::const_iterator i;
-  if ((i = _funcs.find(prop)) != _funcs.end()) {
-    return Value(std::shared_ptr<Function_base>(i->second));
+  const auto i = _funcs->find(prop);
+  if (i != _funcs->end()) {
+    return Value(std::shared_ptr<Function_base>(bind(i->second)));
   }
   throw Exception::attrib_error("Invalid object member " + prop);
 }
@@ -462,9 +512,9 @@ void Cpp_object_bridge::set_member(size_t, Value) {
 }
 
 bool Cpp_object_bridge::has_method(const std::string &name) const {
-  auto method_index = _funcs.find(name);
+  auto method_index = _funcs->find(name);
 
-  return method_index != _funcs.end();
+  return method_index != _funcs->end();
 }
 
 bool Cpp_object_bridge::has_method_advanced(const std::string &name) const {
@@ -475,19 +525,20 @@ bool Cpp_object_bridge::has_method_advanced(const std::string &name) const {
 void Cpp_object_bridge::add_method_(
     const std::string &name, Cpp_function::Function func,
     std::vector<std::pair<std::string, Value_type>> *signature) {
-  auto f = _funcs.find(name);
-  if (f != _funcs.end()) {
+  auto &funcs = own_funcs();
+  auto f = funcs.find(name);
+  if (f != funcs.end()) {
 #ifndef NDEBUG
     log_warning("Attempt to register a duplicate method: %s", name.c_str());
 #endif
     // overloading not supported in old API, erase the previous one
-    _funcs.erase(f);
+    funcs.erase(f);
   }
 
   auto function =
       std::shared_ptr<Cpp_function>(new Cpp_function(name, func, *signature));
   function->is_legacy = true;
-  _funcs.emplace(name.substr(0, name.find("|")), function);
+  funcs.emplace(name.substr(0, name.find("|")), function);
 }
 
 void Cpp_object_bridge::add_constant(const std::string &name) {
@@ -510,7 +561,7 @@ void Cpp_object_bridge::delete_property(const std::string &name,
   if (prop_index != _properties.end()) {
     _properties.erase(prop_index);
 
-    if (!getter.empty()) _funcs.erase(getter);
+    if (!getter.empty()) own_funcs().erase(getter);
   }
 }
 
@@ -579,10 +630,10 @@ Value Cpp_object_bridge::call_function(
     const std::string &scope, const std::shared_ptr<Cpp_function> &func,
     const Argument_list &args) {
   if (func->is_legacy) {
-    return func->invoke(args);
+    return func->invoke(this, args);
   } else {
     try {
-      return func->invoke(args);
+      return func->invoke(this, args);
     } catch (const shcore::Exception &e) {
       throw shcore::Exception(e.type(), scope + ": " + e.what(), e.code());
     } catch (const shcore::Error &e) {
@@ -601,11 +652,11 @@ std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function(
     const std::string &method) const {
   // NOTE this linear lookup is no good, but needed until the naming style
   // mechanism is improved
-  std::multimap<std::string, std::shared_ptr<Cpp_function>>::const_iterator i;
-  for (i = _funcs.begin(); i != _funcs.end(); ++i) {
+  Function_map::const_iterator i;
+  for (i = _funcs->begin(); i != _funcs->end(); ++i) {
     if (i->second->name(current_naming_style()) == method) break;
   }
-  if (i == _funcs.end()) {
+  if (i == _funcs->end()) {
     return std::shared_ptr<Cpp_function>(nullptr);
   }
   // ignore the overloads and just return first match...
@@ -617,11 +668,11 @@ std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function_overload(
     const shcore::Dictionary_t &kwds) const {
   // NOTE this linear lookup is no good, but needed until the naming style
   // mechanism is improved
-  std::multimap<std::string, std::shared_ptr<Cpp_function>>::const_iterator i;
-  for (i = _funcs.begin(); i != _funcs.end(); ++i) {
+  Function_map::const_iterator i;
+  for (i = _funcs->begin(); i != _funcs->end(); ++i) {
     if (i->second->name(current_naming_style()) == method) break;
   }
-  if (i == _funcs.end()) {
+  if (i == _funcs->end()) {
     throw Exception::attrib_error("Invalid object function " + method);
   }
 
@@ -638,7 +689,7 @@ std::shared_ptr<Cpp_function> Cpp_object_bridge::lookup_function_overload(
   int max_error_score = -1;
   shcore::Exception match_error("", 0);
   shcore::Exception error("", 0);
-  while (i != _funcs.end() &&
+  while (i != _funcs->end() &&
          i->second->name(current_naming_style()) == method) {
     if (i->second->is_legacy) return i->second;
 
@@ -736,9 +787,10 @@ std::string Cpp_object_bridge::help(const std::string &item) {
 }
 
 void Cpp_object_bridge::detect_overload_conflicts(
-    const std::string &name, const Cpp_function::Metadata &md) {
+    const Function_map &funcs, const std::string &name,
+    const Cpp_function::Metadata &md) {
   const auto &function_sig = md.signature;
-  auto range = _funcs.equal_range(name);
+  auto range = funcs.equal_range(name);
   for (auto it = range.first; it != range.second; ++it) {
     if (it->second->is_legacy)
       throw Exception::attrib_error("Attempt to overload legacy function: " +
@@ -829,6 +881,11 @@ static std::string num_args_expected(
 }
 
 Value Cpp_function::invoke(const Argument_list &args) {
+  return invoke(nullptr, args);
+}
+
+Value Cpp_function::invoke(Cpp_object_bridge *object,
+                           const Argument_list &args) {
   // Check that the list of arguments is correct
   if (!_meta->signature.empty() && !is_legacy) {
     auto a = args.begin();
@@ -874,6 +931,14 @@ Value Cpp_function::invoke(const Argument_list &args) {
   // enough for the caller to figure out what's wrong. Other specific
   // exception types should have been caught earlier, in the bridges
   try {
+    if (_method) {
+      if (!object) {
+        throw std::logic_error(name() + ": method called without an object");
+      }
+
+      return _method(object, args);
+    }
+
     return _func(args);
   } catch (const shcore::Error &) {
     // shcore::Error can be thrown by bridges
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/adminapi/common/async_utils.h"
+#include "modules/adminapi/common/dba_errors.h"
+
+namespace mysqlsh {
+namespace dba {
+
+TEST(Async_utils, gtid_sync_time_left) {
+  using std::chrono::milliseconds;
+
+  const auto now = std::chrono::steady_clock::now();
+
+  EXPECT_EQ(3, gtid_sync_time_left(now + milliseconds(3000), now));
+  // partial seconds are rounded up
+  EXPECT_EQ(2, gtid_sync_time_left(now + milliseconds(1200), now));
+  // never 0, which would wait forever
+  EXPECT_EQ(1, gtid_sync_time_left(now + milliseconds(1), now));
+}
+
+TEST(Async_utils, gtid_sync_time_left_deadline_passed) {
+  using std::chrono::milliseconds;
+
+  const auto now = std::chrono::steady_clock::now();
+
+  for (const auto deadline : {now, now - milliseconds(1500)}) {
+    try {
+      gtid_sync_time_left(deadline, now);
+      FAIL() << "Expected a timeout";
+    } catch (const shcore::Exception &e) {
+      EXPECT_EQ(SHERR_DBA_GTID_SYNC_TIMEOUT, e.code());
+      EXPECT_STREQ("Timeout waiting for replica to synchronize", e.what());
+    }
+  }
+}
+
+}  // namespace dba
+}  // namespace mysqlsh
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/adminapi/common/instance_monitoring.h"
+
+namespace mysqlsh {
+namespace dba {
+
+TEST(Status_poller, interval_backoff) {
+  // short intervals, so that the test does not take long
+  constexpr int k_min = 10;
+  Status_poller poller(4 * k_min + 5, -1, nullptr, k_min);
+
+  EXPECT_FALSE(poller.expired());
+  EXPECT_EQ(0, poller.remaining_sec());
+
+  poller.observe("a");
+  poller.wait();
+  EXPECT_EQ(k_min, poller.interval_ms());
+
+  // steady state backs off, up to the maximum
+  poller.observe("a");
+  poller.wait();
+  EXPECT_EQ(2 * k_min, poller.interval_ms());
+
+  poller.observe("a");
+  poller.wait();
+  EXPECT_EQ(4 * k_min, poller.interval_ms());
+
+  poller.observe("a");
+  poller.wait();
+  EXPECT_EQ(4 * k_min + 5, poller.interval_ms());
+
+  // a state change goes back to the minimum
+  poller.observe("b");
+  poller.wait();
+  EXPECT_EQ(k_min, poller.interval_ms());
+
+  poller.observe("b");
+  poller.reset();
+  poller.wait();
+  EXPECT_EQ(k_min, poller.interval_ms());
+}
+
+TEST(Status_poller, default_intervals) {
+  Status_poller poller(1000);
+  EXPECT_EQ(k_status_poll_min_interval_ms, poller.interval_ms());
+
+  // minimum is capped by the maximum
+  Status_poller capped(100);
+  EXPECT_EQ(100, capped.interval_ms());
+}
+
+TEST(Status_poller, timeout) {
+  {
+    Status_poller poller(1000, 0);
+    EXPECT_TRUE(poller.expired());
+    EXPECT_EQ(0, poller.remaining_sec());
+  }
+
+  {
+    Status_poller poller(5000, 1);
+    EXPECT_FALSE(poller.expired());
+    EXPECT_EQ(1, poller.remaining_sec());
+
+    // waits never go past the deadline
+    const auto start = std::chrono::steady_clock::now();
+    while (!poller.expired()) poller.wait();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(0, poller.remaining_sec());
+    EXPECT_GT(std::chrono::milliseconds(2000), elapsed);
+  }
+}
+
+TEST(Status_poller, stop) {
+  constexpr int k_interval = 5000;
+  bool stop = true;
+  Status_poller poller(k_interval, -1, &stop, k_interval);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  poller.observe("a");
+  poller.wait();
+  poller.wait();
+  poller.wait();
+
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // stop flag set, so none of the waits should have taken the full interval
+  EXPECT_GT(std::chrono::milliseconds(k_interval / 10), elapsed);
+  EXPECT_FALSE(poller.expired());
+}
+
+}  // namespace dba
+}  // namespace mysqlsh
@@ -144,7 +144,7 @@ class Dump_scheduler : public ::testing::Test {
   template <typename SchedF>
   std::vector<std::string> test_scheduling(
       SchedF f, const std::vector<Dump_reader::Table_info> &tables,
-      size_t nthreads) {
+      size_t nthreads, uint64_t max_threads_per_table = 0) {
     std::vector<std::string> schedule_order;
 
     std::unordered_multimap<std::string, size_t> tables_being_loaded;
@@ -157,7 +157,8 @@ class Dump_scheduler : public ::testing::Test {
 
     auto schedule_one = [&](std::string *out_table, std::string *out_file,
                             size_t *out_size) {
-      auto iter = f(tables_being_loaded, &tables_with_data);
+      auto iter = f(tables_being_loaded, &tables_with_data,
+                    max_threads_per_table);
 
       if (iter != tables_with_data.end()) {
         *out_table = schema_table_key((*iter)->schema, (*iter)->table);
@@ -245,7 +246,27 @@ class Dump_scheduler : public ::testing::Test {
       }
       if (n_busy_threads == 0 && tables_with_data.empty()) break;
 
-      if (old_tables_with_data.size() < nthreads) {
+      if (max_threads_per_table > 0) {
+        // chunked tables with a primary key must not exceed the limit
+        for (const auto &t : copy) {
+          if (t.chunked && !t.primary_index.empty()) {
+            EXPECT_GE(max_threads_per_table,
+                      tables_being_loaded.count(
+                          schema_table_key(t.schema, t.table)));
+          }
+        }
+      }
+
+      if (old_tables_with_data.size() < nthreads &&
+          max_threads_per_table > 0) {
+        // threads may be idle because of the limit, but every pending table
+        // which is not being loaded must have been scheduled
+        for (auto tbl : old_tables_with_data) {
+          EXPECT_NE(tables_being_loaded.end(),
+                    tables_being_loaded.find(
+                        schema_table_key(tbl->schema, tbl->table)));
+        }
+      } else if (old_tables_with_data.size() < nthreads) {
         // if there are more threads than tables
 
         std::map<std::string, size_t> data_loaded;
@@ -299,7 +320,7 @@ class Dump_scheduler : public ::testing::Test {
       while (!done) {
         for (auto &t : threads) {
           if (t.count_left > 0 && --t.count_left == 0) {
-            tables_being_loaded.erase(t.table);
+            tables_being_loaded.erase(tables_being_loaded.find(t.table));
             t.table = "";
             done = true;
           }
@@ -374,4 +395,98 @@ TEST_F(Dump_scheduler, load_scheduler) {
     test_scheduling(Dump_reader::schedule_chunk_proportionally, tables, 16);
   }
 }
+
+TEST_F(Dump_scheduler, max_threads_per_table) {
+  std::vector<Dump_reader::Table_info> tables;
+  tables.push_back(make_table("pk-big", 200, 20, 5));
+  tables.push_back(make_table("pk-small", 20, 20, 5));
+  tables.push_back(make_table("nopk", 100, 20, 5));
+  tables.push_back(make_table("unchunked", 0, 20, 5));
+
+  tables[0].primary_index = "id";
+  tables[1].primary_index = "id";
+  tables[3].primary_index = "id";
+
+  const auto check_order = [&tables](const std::vector<std::string> &order) {
+    for (const auto &t : tables) {
+      if (!t.chunked) continue;
+
+      std::vector<std::string> expected;
+      std::vector<std::string> actual;
+
+      for (size_t i = 0; i < t.num_chunks; ++i) {
+        expected.emplace_back(dump::get_table_data_filename(
+            t.basename, t.extension, i, i + 1 == t.num_chunks));
+      }
+
+      for (const auto &file : order) {
+        if (0 == file.compare(0, t.basename.length() + 1, t.basename + "@")) {
+          actual.emplace_back(file);
+        }
+      }
+
+      // chunks are loaded in the ascending order of the primary key
+      EXPECT_EQ(expected, actual);
+    }
+  };
+
+  for (const uint64_t limit : {1, 2, 3}) {
+    for (const size_t nthreads : {1, 3, 4, 8, 16}) {
+      SCOPED_TRACE(std::to_string(limit) + "-" + std::to_string(nthreads));
+      check_order(test_scheduling(Dump_reader::schedule_chunk_proportionally,
+                                  tables, nthreads, limit));
+    }
+  }
+}
+
+TEST_F(Dump_scheduler, deferred_indexes_biggest_first) {
+  Load_dump_options options;
+  Dump_reader reader(nullptr, options);
+
+  auto schema = std::make_shared<Dump_reader::Schema_info>();
+  schema->schema = "myschema";
+  reader.m_contents.schemas.emplace(schema->schema, schema);
+
+  const auto add_table = [this, &schema](const std::string &name,
+                                         size_t chunks, bool data_loaded) {
+    auto table = std::make_shared<Dump_reader::Table_info>(
+        make_table(name, chunks, 20, 5));
+    table->indexes = {"KEY `a` (`a`)"};
+    table->indexes_done = false;
+    if (data_loaded) table->chunks_consumed = table->num_chunks;
+    schema->tables.emplace(name, table);
+  };
+
+  add_table("small", 5, true);
+  add_table("big", 50, true);
+  add_table("unchunked", 0, true);
+  add_table("medium", 20, true);
+  // biggest tables, but their data is not loaded yet
+  add_table("pending", 100, false);
+  add_table("loading", 200, true);
+
+  const auto next = [&reader]() {
+    std::string schema_name;
+    std::string table_name;
+    std::vector<std::string> *indexes = nullptr;
+
+    if (!reader.next_deferred_index(
+            &schema_name, &table_name, &indexes,
+            [](const std::string &key) {
+              return key != schema_table_key("myschema", "loading");
+            })) {
+      return std::string();
+    }
+
+    EXPECT_EQ("myschema", schema_name);
+    EXPECT_NE(nullptr, indexes);
+    return table_name;
+  };
+
+  EXPECT_EQ("big", next());
+  EXPECT_EQ("medium", next());
+  EXPECT_EQ("small", next());
+  EXPECT_EQ("unchunked", next());
+  EXPECT_EQ("", next());
+}
 }  // namespace mysqlsh
@@ -112,6 +112,38 @@ TEST(Load_dump, sql_transforms_strip_sql_mode) {
             "sql_mode='ANSI_QUOTES,NO_AUTO_CREATE_USER,NO_ZERO_DATE' */"));
 }
 
+TEST(Load_dump, alter_table_for_indexes) {
+  const std::string key = "`db`.`t`";
+
+  EXPECT_EQ(std::vector<std::string>{},
+            Dump_loader::alter_table_for_indexes(key, {}));
+
+  // regular indexes are added by a single statement
+  EXPECT_EQ(std::vector<std::string>{"ALTER TABLE `db`.`t` ADD KEY `a` (`a`)"
+                                     ", ADD UNIQUE KEY `b` (`b`)"
+                                     ", ADD INDEX `c` (`c`, `a`);"},
+            Dump_loader::alter_table_for_indexes(
+                key, {"KEY `a` (`a`)", "UNIQUE KEY `b` (`b`)",
+                      "INDEX `c` (`c`, `a`)"}));
+
+  // FULLTEXT and SPATIAL indexes get a statement each, after the regular ones
+  EXPECT_EQ(
+      (std::vector<std::string>{
+          "ALTER TABLE `db`.`t` ADD KEY `a` (`a`), ADD KEY `b` (`b`);",
+          "ALTER TABLE `db`.`t` ADD FULLTEXT KEY `ft1` (`x`);",
+          "ALTER TABLE `db`.`t` ADD SPATIAL KEY `sp` (`g`);",
+          "ALTER TABLE `db`.`t` ADD fulltext KEY `ft2` (`y`);"}),
+      Dump_loader::alter_table_for_indexes(
+          key, {"FULLTEXT KEY `ft1` (`x`)", "KEY `a` (`a`)",
+                "SPATIAL KEY `sp` (`g`)", "KEY `b` (`b`)",
+                "fulltext KEY `ft2` (`y`)"}));
+
+  EXPECT_EQ(
+      std::vector<std::string>{"ALTER TABLE `db`.`t` ADD FULLTEXT KEY `ft` "
+                               "(`x`);"},
+      Dump_loader::alter_table_for_indexes(key, {"FULLTEXT KEY `ft` (`x`)"}));
+}
+
 static std::string table_name_for_chunk_file(const std::string &f) {
   return shcore::str_rstrip(f.substr(0, f.rfind('@')), "@");
 }
@@ -852,6 +852,72 @@ TEST_F(MySQL_upgrade_check_test, engine_mixup_check) {
   // datadir files
 }
 
+TEST_F(MySQL_upgrade_check_test, parallel_runner) {
+  if (_target_server_version < Version(5, 7, 0) ||
+      _target_server_version >= Version(8, 0, 0))
+    SKIP_TEST("This test requires running against MySQL server version 5.7");
+  PrepareTestDatabase("mysql_parallel_runner_test");
+
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_NO_THROW(session->execute(
+        "create table t" + std::to_string(i) +
+        " (i integer, dt datetime default '0000-00-00', c char(1) zerofill)"));
+  }
+
+  auto checklist = Upgrade_check::create_checklist(opts);
+
+  const auto run = [&checklist, this](std::size_t threads) {
+    std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions{session};
+
+    for (std::size_t i = 1; i < threads; ++i) {
+      auto s = mysqlshdk::db::mysql::Session::create();
+      s->connect(session->get_connection_options());
+      sessions.emplace_back(std::move(s));
+    }
+
+    std::vector<std::string> output;
+    std::size_t last_done = 0;
+    std::size_t last_total = 0;
+
+    Upgrade_check_runner runner{sessions, opts};
+    runner.run(
+        checklist,
+        [&output](const Upgrade_check &check,
+                  const Upgrade_check_result &result) {
+          output.emplace_back(check.get_name());
+
+          if (result.exception) {
+            output.emplace_back("exception");
+          }
+
+          for (const auto &issue : result.issues) {
+            output.emplace_back(upgrade_issue_to_string(issue));
+          }
+        },
+        [&last_done, &last_total](std::size_t done, std::size_t total) {
+          EXPECT_LE(last_done, done);
+          last_done = done;
+          last_total = total;
+        });
+
+    EXPECT_EQ(last_total, last_done);
+
+    for (std::size_t i = 1; i < sessions.size(); ++i) {
+      sessions[i]->close();
+    }
+
+    return output;
+  };
+
+  const auto sequential = run(1);
+  ASSERT_FALSE(sequential.empty());
+  EXPECT_EQ(checklist.front()->get_name(), sequential.front());
+
+  // results are reported in the same order regardless of number of threads
+  EXPECT_EQ(sequential, run(4));
+  EXPECT_EQ(sequential, run(32));
+}
+
 TEST_F(MySQL_upgrade_check_test, manual_checks) {
   auto manual = Upgrade_check::create_checklist(
       Upgrade_check_options{Version("5.7.0"), Version("8.0.11"), "", ""});
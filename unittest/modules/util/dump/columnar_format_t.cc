@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "modules/util/dump/columnar_format.h"
+#include "modules/util/import_table/columnar_file.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+namespace columnar {
+
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Type;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+namespace {
+
+const std::vector<Type> k_types = {Type::Integer, Type::UInteger, Type::String,
+                                   Type::String, Type::Bytes};
+
+std::vector<mysqlshdk::db::Column> columns() {
+  std::vector<mysqlshdk::db::Column> result;
+  int i = 0;
+
+  for (const auto type : k_types) {
+    const auto name = "c" + std::to_string(i++);
+    // binary collation
+    result.emplace_back("def", "schema", "table", "table", name, name, 0, 0,
+                        type, Type::Bytes == type ? 63 : 0,
+                        Type::UInteger == type, false, Type::Bytes == type);
+  }
+
+  return result;
+}
+
+std::vector<Mutable_row> rows(int count) {
+  std::vector<Mutable_row> result;
+
+  for (int i = 0; i < count; ++i) {
+    result.emplace_back(k_types);
+    auto &row = result.back();
+
+    if (0 == i % 7) {
+      row.set_field(0, nullptr);
+    } else if (1 == i) {
+      row.set_field(0, std::numeric_limits<int64_t>::min());
+    } else {
+      row.set_field(0, static_cast<int64_t>(i * (i % 2 ? -1 : 1)));
+    }
+
+    row.set_field(1, 2 == i ? std::numeric_limits<uint64_t>::max()
+                            : static_cast<uint64_t>(i));
+    // repeated values
+    row.set_field(2, "value " + std::to_string(i % 3));
+    // the same value
+    row.set_field(3, std::string{"constant"});
+    // binary data, unique values
+    row.set_field(4, std::string{"a\tb\nc\\d\0e", 9} + std::to_string(i));
+  }
+
+  return result;
+}
+
+std::string encode(const std::vector<Mutable_row> &data) {
+  Row_group group;
+  std::string encoded;
+
+  group.set_columns(columns());
+
+  for (const auto &row : data) {
+    group.append(&row);
+  }
+
+  group.encode(&encoded);
+
+  return encoded;
+}
+
+}  // namespace
+
+TEST(Columnar_format, round_trip) {
+  const auto data = rows(1000);
+  Memory_file file{"file"};
+
+  file.set_content(encode(data));
+  file.open(Mode::READ);
+
+  Row_group group;
+
+  ASSERT_TRUE(group.decode(&file));
+  ASSERT_EQ(data.size(), group.rows());
+  ASSERT_EQ(k_types.size(), group.columns().size());
+
+  for (std::size_t c = 0; c < k_types.size(); ++c) {
+    EXPECT_EQ("c" + std::to_string(c), group.columns()[c].name);
+    EXPECT_EQ(k_types[c], group.columns()[c].type);
+    EXPECT_EQ(Type::Bytes == k_types[c], group.columns()[c].binary);
+
+    for (uint32_t r = 0; r < group.rows(); ++r) {
+      SCOPED_TRACE("column: " + std::to_string(c) +
+                   ", row: " + std::to_string(r));
+
+      ASSERT_EQ(data[r].is_null(c), group.is_null(c, r));
+
+      if (!data[r].is_null(c)) {
+        std::size_t length = 0;
+        const auto value = group.value(c, r, &length);
+        EXPECT_EQ(data[r].get_as_string(c), std::string(value, length));
+      }
+    }
+  }
+
+  EXPECT_FALSE(group.decode(&file));
+}
+
+TEST(Columnar_format, concatenated_row_groups) {
+  Memory_file file{"file"};
+
+  file.set_content(encode(rows(10)) + encode(rows(20)) + encode({}));
+  file.open(Mode::READ);
+
+  Row_group group;
+
+  ASSERT_TRUE(group.decode(&file));
+  EXPECT_EQ(10, group.rows());
+  ASSERT_TRUE(group.decode(&file));
+  EXPECT_EQ(20, group.rows());
+  ASSERT_TRUE(group.decode(&file));
+  EXPECT_EQ(0, group.rows());
+  EXPECT_FALSE(group.decode(&file));
+}
+
+TEST(Columnar_format, repeated_values_are_compact) {
+  std::vector<Mutable_row> data;
+
+  for (int i = 0; i < 10000; ++i) {
+    data.emplace_back(std::vector<Type>{Type::String}, std::string{"value"});
+  }
+
+  Row_group group;
+  std::string encoded;
+
+  group.set_columns({{"def", "schema", "table", "table", "c", "c", 0, 0,
+                      Type::String, 0, false, false, false}});
+
+  for (const auto &row : data) {
+    group.append(&row);
+  }
+
+  EXPECT_EQ(50000, group.data_size());
+
+  group.encode(&encoded);
+
+  EXPECT_GT(200, encoded.size());
+}
+
+TEST(Columnar_format, corrupted_data) {
+  const auto encoded = encode(rows(100));
+  Row_group group;
+
+  {
+    // truncated
+    Memory_file file{"file"};
+    file.set_content(encoded.substr(0, encoded.size() - 1));
+    file.open(Mode::READ);
+
+    EXPECT_THROW(group.decode(&file), std::runtime_error);
+  }
+
+  {
+    // invalid magic
+    Memory_file file{"file"};
+    file.set_content("X" + encoded.substr(1));
+    file.open(Mode::READ);
+
+    EXPECT_THROW(group.decode(&file), std::runtime_error);
+  }
+}
+
+TEST(Columnar_format, columnar_file) {
+  std::vector<Mutable_row> data;
+  data.emplace_back(k_types, int64_t{-1}, uint64_t{1}, std::string{"a\\b"},
+                    nullptr, std::string{"x\ty\nz"});
+  data.emplace_back(k_types, nullptr, uint64_t{2}, std::string{""},
+                    std::string{"N"}, std::string{"\0", 1});
+
+  auto file = std::make_unique<Memory_file>("file");
+  file->set_content(encode(data) + encode(data));
+
+  import_table::Columnar_file columnar{std::move(file)};
+  columnar.open(Mode::READ);
+
+  std::string content;
+  char buffer[7];
+  ssize_t bytes = 0;
+
+  // small buffer, rows are returned in multiple reads
+  while ((bytes = columnar.read(buffer, sizeof(buffer))) > 0) {
+    content.append(buffer, bytes);
+  }
+
+  const std::string expected{
+      "-1\t1\ta\\\\b\t\\N\tx\\\ty\\\nz\n"
+      "\\N\t2\t\tN\t\0\n",
+      31};
+
+  EXPECT_EQ(expected + expected, content);
+  EXPECT_EQ(content.size(), columnar.tell());
+
+  EXPECT_THROW(columnar.write(buffer, sizeof(buffer)), std::logic_error);
+}
+
+TEST(Columnar_format, columnar_file_columns) {
+  std::vector<Mutable_row> data;
+  data.emplace_back(k_types, int64_t{-1}, uint64_t{1}, std::string{"a"},
+                    std::string{"b"}, std::string{"c"});
+
+  const auto content = encode(data);
+
+  {
+    auto file = std::make_unique<Memory_file>("file");
+    file->set_content(content);
+
+    import_table::Columnar_file columnar{std::move(file)};
+    columnar.open(Mode::READ);
+
+    const auto &columns = columnar.columns();
+    ASSERT_EQ(k_types.size(), columns.size());
+
+    for (std::size_t c = 0; c < k_types.size(); ++c) {
+      EXPECT_EQ("c" + std::to_string(c), columns[c].name);
+      EXPECT_EQ(k_types[c], columns[c].type);
+      EXPECT_EQ(Type::Bytes == k_types[c], columns[c].binary);
+    }
+
+    // reading the columns does not consume any rows
+    char buffer[64];
+    EXPECT_EQ(std::string("-1\t1\ta\tb\tc\n"),
+              std::string(buffer, columnar.read(buffer, sizeof(buffer))));
+  }
+
+  {
+    auto file = std::make_unique<Memory_file>("file");
+    file->set_content("");
+
+    import_table::Columnar_file columnar{std::move(file)};
+    columnar.open(Mode::READ);
+
+    EXPECT_TRUE(columnar.columns().empty());
+  }
+
+  {
+    // columns match
+    auto file = std::make_unique<Memory_file>("file");
+    file->set_content(content + content);
+
+    import_table::Columnar_file columnar{std::move(file),
+                                         {},
+                                         {"c0", "c1", "c2", "c3", "c4"}};
+    columnar.open(Mode::READ);
+
+    char buffer[64];
+    EXPECT_EQ(22, columnar.read(buffer, sizeof(buffer)));
+  }
+
+  {
+    // columns are in a different order
+    auto file = std::make_unique<Memory_file>("file");
+    file->set_content(content);
+
+    import_table::Columnar_file columnar{std::move(file),
+                                         {},
+                                         {"c1", "c0", "c2", "c3", "c4"}};
+    columnar.open(Mode::READ);
+
+    char buffer[64];
+    EXPECT_THROW(columnar.read(buffer, sizeof(buffer)), std::runtime_error);
+  }
+
+  {
+    // missing columns
+    auto file = std::make_unique<Memory_file>("file");
+    file->set_content(content);
+
+    import_table::Columnar_file columnar{std::move(file), {}, {"c0", "c1"}};
+    columnar.open(Mode::READ);
+
+    EXPECT_THROW(columnar.columns(), std::runtime_error);
+  }
+}
+
+}  // namespace columnar
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,158 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License, version 2.0,
+ as published by the Free Software Foundation.
+
+ This program is also distributed with certain software (including
+ but not limited to OpenSSL) that is licensed under separate terms, as
+ designated in a particular file or component or in included license
+ documentation.  The authors of MySQL hereby grant you an additional
+ permission to link the program and your derivative works with the
+ separately licensed software that they have included with MySQL.
+ This program is distributed in the hope that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ the GNU General Public License, version 2.0, for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software Foundation, Inc.,
+ 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
+
+
+#include "modules/util/load/thread_count_controller.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+
+namespace {
+
+using Sample = Thread_count_controller::Sample;
+
+class Thread_count_controller_test : public ::testing::Test {
+ protected:
+  // feeds a sample which reports given throughput since the previous one
+  bool feed(Thread_count_controller *controller, uint64_t throughput,
+            int64_t history_list_length = -1, double checkpoint_age = -1.0) {
+    Sample sample;
+
+    m_time += 1.0;
+    m_bytes += throughput;
+
+    sample.time = m_time;
+    sample.bytes_loaded = m_bytes;
+    sample.history_list_length = history_list_length;
+    sample.checkpoint_age = checkpoint_age;
+
+    return controller->update(sample);
+  }
+
+  double m_time = 0.0;
+  uint64_t m_bytes = 0;
+};
+
+}  // namespace
+
+TEST_F(Thread_count_controller_test, limits) {
+  EXPECT_EQ(1u, Thread_count_controller(0, 0, 0).threads());
+  EXPECT_EQ(1u, Thread_count_controller(0, 0, 0).max_threads());
+  EXPECT_EQ(2u, Thread_count_controller(2, 8, 1).threads());
+  EXPECT_EQ(8u, Thread_count_controller(2, 8, 10).threads());
+  EXPECT_EQ(4u, Thread_count_controller(1, 8, 4).threads());
+}
+
+TEST_F(Thread_count_controller_test, grow_while_throughput_improves) {
+  Thread_count_controller controller{1, 4, 1};
+
+  // first sample is just a reference point
+  EXPECT_FALSE(feed(&controller, 0));
+  // decision needs to be confirmed
+  EXPECT_FALSE(feed(&controller, 100));
+  EXPECT_TRUE(feed(&controller, 100));
+  EXPECT_EQ(2u, controller.threads());
+  EXPECT_NE(std::string::npos,
+            controller.last_decision().find("Increasing the number of threads "
+                                            "to 2"));
+
+  EXPECT_FALSE(feed(&controller, 200));
+  EXPECT_TRUE(feed(&controller, 200));
+  EXPECT_EQ(3u, controller.threads());
+
+  EXPECT_FALSE(feed(&controller, 300));
+  EXPECT_TRUE(feed(&controller, 300));
+  EXPECT_EQ(4u, controller.threads());
+
+  // maximum was reached
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_FALSE(feed(&controller, 400));
+  }
+
+  EXPECT_EQ(4u, controller.threads());
+}
+
+TEST_F(Thread_count_controller_test, shrink_if_throughput_does_not_improve) {
+  Thread_count_controller controller{1, 8, 2};
+
+  EXPECT_FALSE(feed(&controller, 0));
+  EXPECT_FALSE(feed(&controller, 100));
+  EXPECT_TRUE(feed(&controller, 100));
+  EXPECT_EQ(3u, controller.threads());
+
+  // additional thread did not help
+  EXPECT_FALSE(feed(&controller, 101));
+  EXPECT_TRUE(feed(&controller, 101));
+  EXPECT_EQ(2u, controller.threads());
+  EXPECT_NE(std::string::npos,
+            controller.last_decision().find("Decreasing the number of threads "
+                                            "to 2"));
+
+  // do not try to grow again right away
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_FALSE(feed(&controller, 100));
+  }
+
+  EXPECT_EQ(2u, controller.threads());
+}
+
+TEST_F(Thread_count_controller_test, shrink_under_pressure) {
+  Thread_count_controller controller{1, 8, 4};
+
+  EXPECT_FALSE(feed(&controller, 0));
+
+  EXPECT_FALSE(feed(&controller, 100, 2000000));
+  EXPECT_TRUE(feed(&controller, 100, 2000000));
+  EXPECT_EQ(3u, controller.threads());
+  EXPECT_NE(std::string::npos,
+            controller.last_decision().find("history list length"));
+
+  EXPECT_FALSE(feed(&controller, 100, -1, 0.9));
+  EXPECT_TRUE(feed(&controller, 100, -1, 0.9));
+  EXPECT_EQ(2u, controller.threads());
+  EXPECT_NE(std::string::npos,
+            controller.last_decision().find("checkpoint age"));
+
+  EXPECT_FALSE(feed(&controller, 100, -1, 0.9));
+  EXPECT_TRUE(feed(&controller, 100, -1, 0.9));
+  EXPECT_EQ(1u, controller.threads());
+
+  // minimum was reached
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_FALSE(feed(&controller, 100, -1, 0.9));
+  }
+
+  EXPECT_EQ(1u, controller.threads());
+}
+
+TEST_F(Thread_count_controller_test, idle) {
+  Thread_count_controller controller{1, 8, 4};
+
+  // no data is being loaded, number of threads is not changed
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_FALSE(feed(&controller, 0));
+  }
+
+  EXPECT_EQ(4u, controller.threads());
+}
+
+}  // namespace mysqlsh
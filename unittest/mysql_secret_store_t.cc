@@ -24,13 +24,18 @@
 #include <rapidjson/document.h>
 
 #include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <iterator>
 #include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
+#include "mysql-secret-store/include/mysql-secret-store/protocol.h"
+#include "mysqlshdk/libs/secret-store-api/secret_cache.h"
 #include "mysqlshdk/libs/utils/process_launcher.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -44,8 +49,10 @@ using mysql::secret_store::api::get_available_helpers;
 using mysql::secret_store::api::get_helper;
 using mysql::secret_store::api::Helper_interface;
 using mysql::secret_store::api::Helper_name;
+using mysql::secret_store::api::Secret_cache;
 using mysql::secret_store::api::Secret_spec;
 using mysql::secret_store::api::Secret_type;
+using mysql::secret_store::api::set_logger;
 
 namespace tests {
 
@@ -1249,6 +1256,159 @@ TEST_P(Mysql_secret_store_api_test, list_nullptr) {
   expect_error("Invalid pointer");
 }
 
+TEST_P(Mysql_secret_store_api_test, persistent_helper_started_once) {
+  const auto helpers = get_available_helpers();
+  const auto name =
+      std::find_if(helpers.begin(), helpers.end(),
+                   [](const Helper_name &n) { return n.get() == GetParam(); });
+  ASSERT_NE(helpers.end(), name);
+
+  const auto helper = get_helper(*name);
+  std::vector<std::string> log;
+
+  set_logger([&log](const std::string &msg) { log.emplace_back(msg); });
+  shcore::on_leave_scope reset_logger([]() { set_logger({}); });
+
+  std::vector<Secret_spec> specs;
+
+  for (int i = 0; i < 5; ++i) {
+    specs.clear();
+    ASSERT_TRUE(helper->list(&specs)) << helper->get_last_error();
+  }
+
+  // first command starts the helper, the remaining ones reuse its process
+  EXPECT_EQ(1, std::count(log.begin(), log.end(), "Starting helper process"));
+  EXPECT_EQ(5, std::count(log.begin(), log.end(), "Invoking helper process"));
+  // no command was executed in a new process
+  EXPECT_EQ(0, std::count(log.begin(), log.end(), "Invoking helper"));
+}
+
+TEST_P(Mysql_secret_store_api_test, get_uses_cached_secret) {
+  const auto helpers = get_available_helpers();
+  const auto name =
+      std::find_if(helpers.begin(), helpers.end(),
+                   [](const Helper_name &n) { return n.get() == GetParam(); });
+  ASSERT_NE(helpers.end(), name);
+
+  const auto helper = get_helper(*name);
+  const Secret_spec spec{Secret_type::PASSWORD, "cached@example.com:3306"};
+  std::vector<std::string> log;
+  std::string secret;
+
+  set_logger([&log](const std::string &msg) { log.emplace_back(msg); });
+  shcore::on_leave_scope reset_logger([&helper, &spec]() {
+    helper->erase(spec);
+    set_logger({});
+  });
+
+  const auto invocations = [&log]() {
+    return std::count(log.begin(), log.end(), "Invoking helper process");
+  };
+
+  ASSERT_TRUE(helper->store(spec, "cached")) << helper->get_last_error();
+  EXPECT_EQ(1, invocations());
+
+  // secret is cached by store(), helper is not asked for it
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(helper->get(spec, &secret)) << helper->get_last_error();
+    EXPECT_EQ("cached", secret);
+  }
+
+  EXPECT_EQ(1, invocations());
+
+  // erase() removes the secret from the cache
+  ASSERT_TRUE(helper->erase(spec)) << helper->get_last_error();
+  EXPECT_EQ(2, invocations());
+  EXPECT_FALSE(helper->get(spec, &secret));
+  EXPECT_EQ(3, invocations());
+}
+
+TEST_P(Mysql_secret_store_api_test, persistent_helper_benchmark) {
+  const auto helpers = get_available_helpers();
+  const auto name =
+      std::find_if(helpers.begin(), helpers.end(),
+                   [](const Helper_name &n) { return n.get() == GetParam(); });
+  ASSERT_NE(helpers.end(), name);
+
+  const int iterations = 20;
+  std::string output;
+  std::vector<Secret_spec> specs;
+
+  // new process for each command
+  Helper_invoker invoker{name->path()};
+  auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < iterations; ++i) {
+    ASSERT_TRUE(invoker.list(&output)) << output;
+  }
+
+  const auto process = std::chrono::steady_clock::now() - start;
+
+  // persistent process, started by the first command
+  const auto helper = get_helper(*name);
+  start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < iterations; ++i) {
+    specs.clear();
+    ASSERT_TRUE(helper->list(&specs)) << helper->get_last_error();
+  }
+
+  const auto persistent = std::chrono::steady_clock::now() - start;
+
+  const auto us = [](std::chrono::steady_clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count() /
+           iterations;
+  };
+
+  // timings depend on the machine, they are only reported
+  std::cout << GetParam() << ", process per command: " << us(process)
+            << "us/op, persistent process: " << us(persistent) << "us/op"
+            << std::endl;
+}
+
+TEST(Helpers, Mysql_secret_store_api_test_secret_cache) {
+  Secret_cache cache{std::chrono::milliseconds{200}};
+  std::string secret;
+
+  EXPECT_FALSE(cache.get("one", &secret));
+
+  cache.put("one", "first");
+  ASSERT_TRUE(cache.get("one", &secret));
+  EXPECT_EQ("first", secret);
+
+  // put() replaces the secret
+  cache.put("one", "second");
+  ASSERT_TRUE(cache.get("one", &secret));
+  EXPECT_EQ("second", secret);
+
+  cache.erase("one");
+  EXPECT_FALSE(cache.get("one", &secret));
+  EXPECT_EQ(0, cache.size());
+}
+
+TEST(Helpers, Mysql_secret_store_api_test_secret_cache_ttl) {
+  Secret_cache cache{std::chrono::milliseconds{200}};
+  std::string secret;
+
+  cache.put("one", "first");
+  std::this_thread::sleep_for(std::chrono::milliseconds{300});
+
+  // expired secret is removed when it's requested
+  EXPECT_EQ(1, cache.size());
+  EXPECT_FALSE(cache.get("one", &secret));
+  EXPECT_EQ(0, cache.size());
+
+  cache.put("one", "first");
+  std::this_thread::sleep_for(std::chrono::milliseconds{300});
+
+  // expired secrets are removed when a new one is cached
+  cache.put("two", "second");
+  EXPECT_EQ(1, cache.size());
+  EXPECT_FALSE(cache.get("one", &secret));
+  ASSERT_TRUE(cache.get("two", &secret));
+  EXPECT_EQ("second", secret);
+}
+
 TEST(Helpers, Mysql_secret_store_api_test_secret_spec_operators) {
   Secret_spec one{Secret_type::PASSWORD, "first URL"};
   Secret_spec two{Secret_type::PASSWORD, "second URL"};
@@ -1559,6 +1719,69 @@ TEST_P(Helper_executable_test, invalid_json_input_wrong_type_secret) {
   output.clear();
 }
 
+TEST_P(Helper_executable_test, serve_command) {
+  const auto &path = tester.get_invoker().m_path;
+  const char *const args[] = {path.c_str(),
+                              mysql::secret_store::protocol::k_serve_command,
+                              nullptr};
+  shcore::Process_launcher app{args};
+
+  app.start();
+
+  EXPECT_EQ(mysql::secret_store::protocol::k_ready,
+            shcore::str_strip(app.read_line()));
+
+  const auto request = [&app](const std::string &command,
+                              const std::string &input, std::string *output) {
+    const auto header =
+        command + " " + std::to_string(input.length()) + "\n" + input;
+    app.write(header.c_str(), header.length());
+
+    int status = -1;
+    std::size_t size = 0;
+    EXPECT_EQ(2, sscanf(app.read_line().c_str(), "%d %zu", &status, &size));
+
+    std::string payload(size, '\0');
+    std::size_t offset = 0;
+
+    while (offset < size) {
+      const auto bytes = app.read(&payload[offset], size - offset);
+      EXPECT_LT(0, bytes);
+      if (bytes <= 0) break;
+      offset += bytes;
+    }
+
+    *output = shcore::str_strip(payload);
+    return 0 == status;
+  };
+
+  std::string output;
+  const std::string spec =
+      R"({"ServerURL":"user@host","SecretType":"password"})";
+  const std::string secret =
+      R"({"ServerURL":"user@host","SecretType":"password","Secret":"pass"})";
+
+  EXPECT_TRUE(request("version", "", &output));
+  EXPECT_THAT(output, ::testing::HasSubstr(shcore::get_long_version()));
+
+  EXPECT_FALSE(request("unknown", "", &output));
+  EXPECT_THAT(output, ::testing::HasSubstr("Unknown command"));
+
+  // helper keeps serving requests after a command fails
+  EXPECT_TRUE(request("store", secret, &output)) << output;
+
+  EXPECT_TRUE(request("get", spec, &output)) << output;
+  EXPECT_THAT(output, ::testing::HasSubstr("\"pass\""));
+
+  EXPECT_TRUE(request("erase", spec, &output)) << output;
+
+  EXPECT_FALSE(request("get", spec, &output));
+  EXPECT_THAT(output, ::testing::HasSubstr("Could not find the secret"));
+
+  app.finish_writing();
+  EXPECT_EQ(0, app.wait());
+}
+
 TEST_P(Helper_executable_test, version_command) {
   auto &invoker = tester.get_invoker();
   std::string output;
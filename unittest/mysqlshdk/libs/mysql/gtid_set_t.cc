@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/mysql/gtid_set.h"
+#include "mysqlshdk/libs/mysql/instance.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils/shell_base_test.h"
+
+namespace mysqlshdk {
+namespace mysql {
+
+namespace {
+
+const std::vector<std::string> k_uuids = {
+    "a75881c0-6ae5-11e9-bef7-24bb3d014d7f",
+    "b75881c0-6ae5-11e9-bef7-24bb3d014d7f",
+    "c75881c0-6ae5-11e9-bef7-24bb3d014d7f"};
+
+using Reference_set = std::set<std::pair<std::string, uint64_t>>;
+
+/**
+ * Generates a random GTID set, returns its textual representation and all of
+ * its transactions.
+ */
+std::string random_gtid_set(std::mt19937 *rng, Reference_set *reference) {
+  std::uniform_int_distribution<int> count(0, 4);
+  std::uniform_int_distribution<int> uuid(0, k_uuids.size() - 1);
+  std::uniform_int_distribution<uint64_t> gno(1, 40);
+  std::uniform_int_distribution<uint64_t> length(0, 6);
+  std::string result;
+
+  for (int i = count(*rng); i > 0; --i) {
+    const auto &u = k_uuids[uuid(*rng)];
+
+    if (!result.empty()) result += ",";
+
+    result += u;
+
+    for (int j = count(*rng); j > 0; --j) {
+      const auto first = gno(*rng);
+      const auto last = first + length(*rng);
+
+      result += ":" + std::to_string(first);
+
+      if (last != first) result += "-" + std::to_string(last);
+
+      for (auto g = first; g <= last; ++g) {
+        reference->emplace(u, g);
+      }
+    }
+  }
+
+  return result;
+}
+
+Reference_set to_reference(const Gtid_set &set) {
+  Reference_set result;
+  const auto text = set.str();
+
+  if (!text.empty()) {
+    for (const auto &uuid : shcore::str_split(text, ",\n", -1, true)) {
+      const auto parts = shcore::str_split(uuid, ":");
+
+      for (auto it = std::next(parts.begin()); it != parts.end(); ++it) {
+        const auto range = shcore::str_split(*it, "-");
+        const auto first = std::stoull(range[0]);
+        const auto last = range.size() > 1 ? std::stoull(range[1]) : first;
+
+        for (auto g = first; g <= last; ++g) {
+          result.emplace(parts[0], g);
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Gtid_set_test, parse) {
+  EXPECT_TRUE(Gtid_set::from_string("").empty());
+  EXPECT_TRUE(Gtid_set::from_string("  \n ").empty());
+
+  EXPECT_EQ("a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-5:7",
+            Gtid_set::from_string("A75881C0-6AE5-11E9-BEF7-24BB3D014D7F:7:1-5")
+                .str());
+  EXPECT_EQ("a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-10",
+            Gtid_set::from_string("a75881c06ae511e9bef724bb3d014d7f:1-5,\n"
+                                  "{a75881c0-6ae5-11e9-bef7-24bb3d014d7f}:6-10")
+                .str());
+  EXPECT_EQ(
+      "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-3,\n"
+      "b75881c0-6ae5-11e9-bef7-24bb3d014d7f:4",
+      Gtid_set::from_string(" b75881c0-6ae5-11e9-bef7-24bb3d014d7f : 4 , "
+                            "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-2:2-3")
+          .str());
+
+  // empty intervals and UUIDs without intervals are ignored
+  EXPECT_EQ("", Gtid_set::from_string("a75881c0-6ae5-11e9-bef7-24bb3d014d7f:5-4,"
+                                      "b75881c0-6ae5-11e9-bef7-24bb3d014d7f")
+                    .str());
+
+  for (const auto &invalid :
+       {"a75881c0", "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:",
+        "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:0",
+        "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-",
+        "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:a",
+        "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1 2",
+        "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:9223372036854775807",
+        "g75881c0-6ae5-11e9-bef7-24bb3d014d7f:1"}) {
+    SCOPED_TRACE(invalid);
+    EXPECT_THROW(Gtid_set::from_string(invalid), std::invalid_argument);
+  }
+
+  EXPECT_EQ(9223372036854775806ULL,
+            Gtid_set::from_string(
+                "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-9223372036854775806")
+                .count());
+}
+
+TEST(Gtid_set_test, operations) {
+  const auto a = Gtid_set::from_string(
+      "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-10:20-30,"
+      "b75881c0-6ae5-11e9-bef7-24bb3d014d7f:1");
+  const auto b = Gtid_set::from_string(
+      "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:5-25,"
+      "c75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-3");
+
+  EXPECT_EQ(22u, a.count());
+  EXPECT_EQ(24u, b.count());
+
+  EXPECT_EQ(
+      "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-30,\n"
+      "b75881c0-6ae5-11e9-bef7-24bb3d014d7f:1,\n"
+      "c75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-3",
+      Gtid_set(a).add(b).str());
+  EXPECT_EQ(
+      "a75881c0-6ae5-11e9-bef7-24bb3d014d7f:1-4:26-30,\n"
+      "b75881c0-6ae5-11e9-bef7-24bb3d014d7f:1",
+      Gtid_set(a).subtract(b).str());
+  EXPECT_EQ("a75881c0-6ae5-11e9-bef7-24bb3d014d7f:5-10:20-25",
+            Gtid_set(a).intersect(b).str());
+
+  EXPECT_TRUE(a.intersects(b));
+  EXPECT_FALSE(a.contains(b));
+  EXPECT_TRUE(Gtid_set(a).add(b).contains(b));
+  EXPECT_TRUE(a.contains(Gtid_set()));
+  EXPECT_FALSE(Gtid_set().contains(a));
+  EXPECT_FALSE(Gtid_set(a).subtract(b).intersects(b));
+  EXPECT_TRUE(Gtid_set(a).subtract(a).empty());
+  EXPECT_EQ(a, Gtid_set::from_string(a.str()));
+}
+
+TEST(Gtid_set_test, fuzz) {
+  std::mt19937 rng(42);
+
+  for (int i = 0; i < 2000; ++i) {
+    Reference_set ref_a;
+    Reference_set ref_b;
+    const auto text_a = random_gtid_set(&rng, &ref_a);
+    const auto text_b = random_gtid_set(&rng, &ref_b);
+    SCOPED_TRACE(text_a + " | " + text_b);
+
+    const auto a = Gtid_set::from_string(text_a);
+    const auto b = Gtid_set::from_string(text_b);
+
+    ASSERT_EQ(ref_a, to_reference(a));
+    ASSERT_EQ(ref_a.size(), a.count());
+
+    Reference_set expected;
+    std::set_union(ref_a.begin(), ref_a.end(), ref_b.begin(), ref_b.end(),
+                   std::inserter(expected, expected.end()));
+    ASSERT_EQ(expected, to_reference(Gtid_set(a).add(b)));
+
+    expected.clear();
+    std::set_difference(ref_a.begin(), ref_a.end(), ref_b.begin(),
+                        ref_b.end(), std::inserter(expected, expected.end()));
+    ASSERT_EQ(expected, to_reference(Gtid_set(a).subtract(b)));
+
+    expected.clear();
+    std::set_intersection(ref_a.begin(), ref_a.end(), ref_b.begin(),
+                          ref_b.end(), std::inserter(expected, expected.end()));
+    ASSERT_EQ(expected, to_reference(Gtid_set(a).intersect(b)));
+    ASSERT_EQ(!expected.empty(), a.intersects(b));
+
+    ASSERT_EQ(std::includes(ref_a.begin(), ref_a.end(), ref_b.begin(),
+                            ref_b.end()),
+              a.contains(b));
+  }
+}
+
+class Gtid_set_server_test : public tests::Shell_base_test {};
+
+TEST_F(Gtid_set_server_test, fuzz) {
+  // results need to be the same as the ones of the server functions
+  auto session = create_mysql_session(_mysql_uri);
+  Instance instance(session);
+  std::mt19937 rng(7);
+
+  for (int i = 0; i < 200; ++i) {
+    Reference_set ignored;
+    const auto text_a = random_gtid_set(&rng, &ignored);
+    const auto text_b = random_gtid_set(&rng, &ignored);
+    SCOPED_TRACE(text_a + " | " + text_b);
+
+    const auto a = Gtid_set::from_string(text_a);
+    const auto b = Gtid_set::from_string(text_b);
+
+    const auto row = instance
+                         .queryf("SELECT GTID_SUBTRACT(?, ''), "
+                                 "GTID_SUBTRACT(?, ?), GTID_SUBSET(?, ?)",
+                                 text_a, text_a, text_b, text_b, text_a)
+                         ->fetch_one_or_throw();
+
+    EXPECT_EQ(row->get_string(0), a.str());
+    EXPECT_EQ(row->get_string(1), Gtid_set(a).subtract(b).str());
+    EXPECT_EQ(row->get_int(2) != 0, a.contains(b));
+  }
+}
+
+}  // namespace mysql
+}  // namespace mysqlshdk
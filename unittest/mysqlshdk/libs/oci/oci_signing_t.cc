@@ -0,0 +1,172 @@
+/* Copyright (c) 2020, Oracle and/or its affiliates.
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License, version 2.0,
+ as published by the Free Software Foundation.
+
+ This program is also distributed with certain software (including
+ but not limited to OpenSSL) that is licensed under separate terms, as
+ designated in a particular file or component or in included license
+ documentation.  The authors of MySQL hereby grant you an additional
+ permission to link the program and your derivative works with the
+ separately licensed software that they have included with MySQL.
+ This program is distributed in the hope that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ the GNU General Public License, version 2.0, for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software Foundation, Inc.,
+ 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
+
+#include <openssl/evp.h>
+#include <openssl/rsa.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/oci/oci_rest_service.h"
+#include "mysqlshdk/libs/utils/ssl_keygen.h"
+
+namespace mysqlshdk {
+namespace oci {
+
+namespace {
+
+std::shared_ptr<EVP_PKEY> generate_key() {
+  std::unique_ptr<EVP_PKEY_CTX, decltype(&::EVP_PKEY_CTX_free)> ctx(
+      EVP_PKEY_CTX_new_id(EVP_PKEY_RSA, nullptr), ::EVP_PKEY_CTX_free);
+  EVP_PKEY *key = nullptr;
+
+  if (!ctx || EVP_PKEY_keygen_init(ctx.get()) != 1 ||
+      EVP_PKEY_CTX_set_rsa_keygen_bits(ctx.get(), 2048) != 1 ||
+      EVP_PKEY_keygen(ctx.get(), &key) != 1) {
+    throw std::runtime_error("Failed to generate a key");
+  }
+
+  return std::shared_ptr<EVP_PKEY>(key, ::EVP_PKEY_free);
+}
+
+bool verify(const std::shared_ptr<EVP_PKEY> &key, const std::string &data,
+            const std::string &signature_b64) {
+  std::string signature;
+  if (!shcore::ssl::decode_base64(signature_b64, &signature)) return false;
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L /* 1.1.x */
+  std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> ctx(
+      EVP_MD_CTX_new(), ::EVP_MD_CTX_free);
+#else
+  std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_destroy)> ctx(
+      EVP_MD_CTX_create(), ::EVP_MD_CTX_destroy);
+#endif
+
+  return EVP_DigestVerifyInit(ctx.get(), nullptr, EVP_sha256(), nullptr,
+                              key.get()) == 1 &&
+         EVP_DigestVerifyUpdate(ctx.get(), data.data(), data.size()) == 1 &&
+         EVP_DigestVerifyFinal(
+             ctx.get(),
+             reinterpret_cast<const unsigned char *>(signature.data()),
+             signature.size()) == 1;
+}
+
+}  // namespace
+
+TEST(Oci_signing_test, encode_sha256) {
+  EXPECT_EQ("47DEQpj8HBSa+/TImW+5JCeuQeRkm5NMpJWZG3hSuFU=",
+            encode_sha256("", 0));
+  EXPECT_EQ("ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=",
+            encode_sha256("abc", 3));
+  // context is reused by subsequent calls
+  EXPECT_EQ("ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=",
+            encode_sha256("abc", 3));
+}
+
+TEST(Oci_signing_test, sign) {
+  const auto first = generate_key();
+  const auto second = generate_key();
+  const std::string data = "(request-target): get /n/\nhost: localhost";
+
+  // prepared context is reused and replaced when key changes
+  EXPECT_TRUE(verify(first, data, sign(first, data)));
+  EXPECT_TRUE(verify(first, data + "1", sign(first, data + "1")));
+  EXPECT_TRUE(verify(second, data, sign(second, data)));
+  EXPECT_FALSE(verify(first, data, sign(second, data)));
+  EXPECT_TRUE(verify(first, data, sign(first, data)));
+}
+
+TEST(Oci_signing_test, sign_benchmark) {
+  const auto key = generate_key();
+  const std::string data =
+      "(request-target): put /n/namespace/b/bucket/u/object?uploadId=id&"
+      "uploadPartNum=1\nhost: objectstorage.region.oraclecloud.com\n"
+      "x-date: Thu, 01 Jan 1970 00:00:00 GMT";
+  const int iterations = 200;
+
+  // signing context created for each signature
+  auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < iterations; ++i) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L /* 1.1.x */
+    std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> ctx(
+        EVP_MD_CTX_new(), ::EVP_MD_CTX_free);
+#else
+    std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_destroy)> ctx(
+        EVP_MD_CTX_create(), ::EVP_MD_CTX_destroy);
+#endif
+    size_t length = EVP_PKEY_size(key.get());
+    const auto signature = std::make_unique<unsigned char[]>(length);
+
+    ASSERT_EQ(1, EVP_DigestSignInit(ctx.get(), nullptr, EVP_sha256(), nullptr,
+                                    key.get()));
+    ASSERT_EQ(1, EVP_DigestSignUpdate(ctx.get(), data.data(), data.size()));
+    ASSERT_EQ(1, EVP_DigestSignFinal(ctx.get(), signature.get(), &length));
+  }
+
+  const auto fresh = std::chrono::steady_clock::now() - start;
+
+  // prepared signing context
+  start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < iterations; ++i) {
+    sign(key, data);
+  }
+
+  const auto prepared = std::chrono::steady_clock::now() - start;
+
+  const auto us = [](std::chrono::steady_clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count() /
+           iterations;
+  };
+
+  // timings depend on the machine, they are only reported
+  std::cout << "Signing, fresh context: " << us(fresh)
+            << "us/op, prepared context: " << us(prepared) << "us/op"
+            << std::endl;
+
+  // signatures created using the prepared context are still valid
+  EXPECT_TRUE(verify(key, data, sign(key, data)));
+}
+
+TEST(Oci_signing_test, sign_does_not_own_key) {
+  const std::string data = "(request-target): get /n/\nhost: localhost";
+  std::weak_ptr<EVP_PKEY> weak;
+
+  {
+    const auto key = generate_key();
+    weak = key;
+    EXPECT_TRUE(verify(key, data, sign(key, data)));
+  }
+
+  // owner of the key is gone, prepared context does not hold it
+  EXPECT_TRUE(weak.expired());
+
+  const auto key = generate_key();
+  EXPECT_TRUE(verify(key, data, sign(key, data)));
+}
+
+}  // namespace oci
+}  // namespace mysqlshdk
@@ -21,6 +21,7 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -352,6 +353,42 @@ TEST_F(Rest_service_test, cycle_async_methods) {
             response.json().as_map()->get_map("headers")->get_string("seven"));
 }
 
+TEST_F(Rest_service_test, concurrent_async_requests) {
+  FAIL_IF_NO_SERVER
+
+  // requests are executed concurrently, total time should be close to the time
+  // of a single request
+  const auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::future<Response>> responses;
+
+  for (int i = 0; i < 10; ++i) {
+    responses.emplace_back(m_service.async_get("/timeout/1"));
+  }
+
+  for (auto &response : responses) {
+    EXPECT_EQ(Response::Status_code::OK, response.get().status);
+  }
+
+  EXPECT_GT(std::chrono::seconds(5), std::chrono::steady_clock::now() - start);
+
+  // synchronous and raw asynchronous requests can be mixed
+  String_buffer buffer;
+  Headers response_headers;
+  auto code = m_service.async_execute(Type::GET, "/get", nullptr, 0,
+                                      {{"one", "1"}}, &buffer,
+                                      &response_headers);
+
+  EXPECT_EQ(Response::Status_code::OK, m_service.get("/get").status);
+
+  EXPECT_EQ(Response::Status_code::OK, code.get());
+  EXPECT_EQ("application/json; charset=UTF-8",
+            response_headers["Content-Type"]);
+  const auto json = shcore::Value::parse(buffer.data(), buffer.size()).as_map();
+  EXPECT_EQ("GET", json->get_string("method"));
+  EXPECT_EQ("1", json->get_map("headers")->get_string("one"));
+}
+
 TEST_F(Rest_service_test, redirect) {
   FAIL_IF_NO_SERVER
 
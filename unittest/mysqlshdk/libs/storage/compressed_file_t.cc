@@ -313,6 +313,50 @@ TEST_P(Compression, binary_data) {
   }
 }
 
+TEST_P(Compression, concatenated_streams) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+
+  const auto ctype = std::get<0>(GetParam());
+  Generate_text g;
+  std::string input_text;
+  std::string compressed;
+
+  // data compressed independently and concatenated (i.e. output of a parallel
+  // export) has to be read back as a single stream
+  for (const auto length : {0, 1024, 8313, 1024 * 1024}) {
+    SCOPED_TRACE(length);
+
+    const auto part = g.bytes(length);
+    auto part_file = std::make_unique<Memory_file>("");
+    const auto part_file_ptr = part_file.get();
+    auto compress = mysqlshdk::storage::make_file(std::move(part_file), ctype);
+
+    compress->open(Mode::WRITE);
+    compress->write(part.data(), part.size());
+    compress->close();
+
+    input_text += part;
+    compressed += part_file_ptr->content();
+  }
+
+  auto concatenated = std::make_unique<Memory_file>("");
+  concatenated->set_content(compressed);
+  auto uncompress =
+      mysqlshdk::storage::make_file(std::move(concatenated), ctype);
+
+  byte buffer[BUFSIZE];
+  std::string output_text;
+
+  uncompress->open(Mode::READ);
+  for (auto read_bytes = uncompress->read(buffer, BUFSIZE); read_bytes > 0;
+       read_bytes = uncompress->read(buffer, BUFSIZE)) {
+    output_text.append(buffer, read_bytes);
+  }
+  uncompress->close();
+
+  EXPECT_EQ(input_text, output_text);
+}
+
 extern "C" const char *g_test_home;
 TEST_P(Compression, compress_decompress_bigdata) {
   SKIP_TEST("Slow test");
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/executor.h"
+#include "mysqlshdk/libs/utils/threads.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+TEST(Utils_executor, all_tasks_are_executed) {
+  Executor<> executor{4, "test"};
+  std::atomic<int> sum{0};
+
+  for (int i = 1; i <= 1000; ++i) {
+    executor.submit([&sum, i]() { sum += i; });
+  }
+
+  executor.finish();
+  executor.start();
+  executor.join();
+
+  EXPECT_EQ(500500, sum);
+
+  const auto stats = executor.statistics();
+  EXPECT_EQ(1000, stats.tasks);
+}
+
+TEST(Utils_executor, tasks_submitted_by_tasks) {
+  Executor<> executor{3, "test"};
+  std::atomic<int> count{0};
+
+  executor.start();
+
+  for (int i = 0; i < 10; ++i) {
+    executor.submit([&executor, &count]() {
+      for (int j = 0; j < 10; ++j) {
+        executor.submit([&count]() { ++count; });
+      }
+
+      ++count;
+    });
+  }
+
+  executor.finish();
+  executor.join();
+
+  EXPECT_EQ(110, count);
+}
+
+TEST(Utils_executor, priorities) {
+  Executor<> executor{1, "test"};
+  std::vector<int> order;
+
+  executor.submit([&order]() { order.emplace_back(3); },
+                  shcore::Queue_priority::LOW);
+  executor.submit([&order]() { order.emplace_back(2); },
+                  shcore::Queue_priority::MEDIUM);
+  executor.submit([&order]() { order.emplace_back(1); },
+                  shcore::Queue_priority::HIGH);
+  executor.submit([&order]() { order.emplace_back(4); },
+                  shcore::Queue_priority::LOW);
+
+  executor.finish();
+  executor.run(0);
+
+  EXPECT_EQ((std::vector<int>{1, 2, 3, 4}), order);
+}
+
+TEST(Utils_executor, arguments_and_caller_threads) {
+  Executor<int *> executor{2, "test"};
+  int counters[2] = {0, 0};
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < 100; ++i) {
+    executor.submit([](int *counter) { ++*counter; });
+  }
+
+  executor.finish();
+
+  for (std::size_t i = 0; i < 2; ++i) {
+    threads.emplace_back([&executor, &counters, i]() {
+      executor.run(i, &counters[i]);
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(100, counters[0] + counters[1]);
+}
+
+TEST(Utils_executor, cancel) {
+  Executor<> executor{2, "test"};
+  std::atomic<int> count{0};
+
+  executor.start();
+
+  for (int i = 0; i < 100; ++i) {
+    executor.submit([&count, &executor]() {
+      if (10 == ++count) {
+        executor.cancel();
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+  }
+
+  executor.join();
+
+  EXPECT_TRUE(executor.cancelled());
+  EXPECT_GE(12, count);
+
+  // tasks submitted after cancellation are discarded
+  executor.submit([&count]() { ++count; });
+  EXPECT_GE(12, count);
+}
+
+TEST(Utils_executor, exception) {
+  Executor<> executor{1, "test"};
+
+  executor.submit([]() { throw std::runtime_error("failed"); });
+  executor.finish();
+
+  EXPECT_THROW(executor.run(0), std::runtime_error);
+}
+
+TEST(Utils_map_reduce, sum) {
+  std::vector<int> input;
+
+  for (int i = 1; i <= 100; ++i) {
+    input.emplace_back(i);
+  }
+
+  EXPECT_EQ(10100, (map_reduce<int, int>(
+                       input.begin(), input.end(), [](int i) { return 2 * i; },
+                       [](int total, int i) { return total + i; })));
+
+  EXPECT_EQ(0, (map_reduce<int, int>(
+                   input.end(), input.end(), [](int i) { return 2 * i; },
+                   [](int total, int i) { return total + i; })));
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
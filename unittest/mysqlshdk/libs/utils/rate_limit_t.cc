@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, Oracle and/or its affiliates. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/rate_limit.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+namespace {
+
+double measure(const std::function<void()> &f) {
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+}  // namespace
+
+TEST(Utils_shared_rate_limit, disabled) {
+  Shared_rate_limit limit;
+
+  EXPECT_FALSE(limit.enabled());
+  EXPECT_EQ(0, limit.limit());
+
+  EXPECT_GT(0.5, measure([&limit]() {
+              for (int i = 0; i < 1000; ++i) {
+                limit.throttle(1000000);
+              }
+            }));
+
+  limit.set_limit(-1);
+  EXPECT_FALSE(limit.enabled());
+  EXPECT_EQ(0, limit.limit());
+}
+
+TEST(Utils_shared_rate_limit, single_thread) {
+  Shared_rate_limit limit{100000, std::chrono::milliseconds(0)};
+
+  EXPECT_TRUE(limit.enabled());
+  EXPECT_EQ(100000, limit.limit());
+
+  // 50000 units at 100000 units/s
+  EXPECT_LE(0.45, measure([&limit]() {
+              for (int i = 0; i < 50; ++i) {
+                limit.throttle(1000);
+              }
+            }));
+}
+
+TEST(Utils_shared_rate_limit, aggregate_limit) {
+  Shared_rate_limit limit{100000, std::chrono::milliseconds(0)};
+
+  // 4 threads, 50000 units in total, limit is shared
+  EXPECT_LE(0.45, measure([&limit]() {
+              std::vector<std::thread> threads;
+
+              for (int t = 0; t < 4; ++t) {
+                threads.emplace_back([&limit]() {
+                  for (int i = 0; i < 25; ++i) {
+                    limit.throttle(500);
+                  }
+                });
+              }
+
+              for (auto &t : threads) {
+                t.join();
+              }
+            }));
+}
+
+TEST(Utils_shared_rate_limit, change_limit) {
+  Shared_rate_limit limit{1000, std::chrono::milliseconds(0)};
+
+  // reservation made with the old limit needs to be paid off
+  limit.throttle(100);
+
+  limit.set_limit(1000000);
+  EXPECT_EQ(1000000, limit.limit());
+
+  // 100000 units at 1000000 units/s + previous reservation
+  const auto elapsed = measure([&limit]() {
+    for (int i = 0; i < 100; ++i) {
+      limit.throttle(1000);
+    }
+  });
+
+  EXPECT_LE(0.09, elapsed);
+  EXPECT_GT(5.0, elapsed);
+
+  limit.set_limit(0);
+  EXPECT_FALSE(limit.enabled());
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
@@ -55,6 +55,9 @@ FUNCTIONS
       getSchemas()
             Retrieves the Schemas available on the session.
 
+      getStatementCacheStats()
+            Returns the statistics of the statement cache of this session.
+
       getUri()
             Retrieves the URI for the current session.
 
@@ -0,0 +1,43 @@
+//@<> Setup
+var pool = shell.createSessionPool(__uripwd, 3);
+
+//@<> Invalid arguments
+EXPECT_THROWS(function() { shell.createSessionPool(__uripwd, 0); }, "Shell.createSessionPool: The size of the pool must be a positive number.");
+EXPECT_THROWS(function() { pool.runSql(""); }, "SessionPool.runSql: No query specified.");
+
+//@<> Queries are executed asynchronously
+var futures = [];
+for (var i = 0; i < 10; ++i) {
+  futures.push(pool.runSql("SELECT ?, SLEEP(0.1)", [i]));
+}
+
+var results = pool.all(futures);
+EXPECT_EQ(10, results.length);
+
+for (var i = 0; i < 10; ++i) {
+  EXPECT_EQ(i, results[i].fetchOne()[0]);
+  EXPECT_TRUE(futures[i].isDone());
+}
+
+//@<> then() is called with the result
+var future = pool.runSql("SELECT 2").then(function(r) { return r.fetchOne()[0] * 2; });
+EXPECT_EQ(4, future.wait());
+
+//@<> Errors are thrown by wait()
+var future = pool.runSql("SELECT * FROM mysql.no_such_table");
+EXPECT_THROWS(function() { future.wait(); }, "Table 'mysql.no_such_table' doesn't exist");
+
+var chained = pool.runSql("SELECT * FROM mysql.no_such_table").then(function(r) { return 1; });
+EXPECT_THROWS(function() { chained.wait(); }, "Table 'mysql.no_such_table' doesn't exist");
+
+//@<> Warnings are available
+var result = pool.runSql("SELECT 1/0").wait();
+EXPECT_EQ(1, result.warningsCount);
+EXPECT_EQ(1365, result.getWarnings()[0][1]);
+
+//@<> Closed pool
+var future = pool.runSql("SELECT SLEEP(0.5)");
+pool.close();
+EXPECT_TRUE(future.isDone());
+EXPECT_EQ(0, future.wait().fetchOne()[0]);
+EXPECT_THROWS(function() { pool.runSql("SELECT 1"); }, "SessionPool.runSql: The session pool is closed.");
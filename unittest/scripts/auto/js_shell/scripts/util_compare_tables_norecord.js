@@ -0,0 +1,112 @@
+//@{VER(>=8.0.0)}
+// Tests of util.compareTables() and util.compareSchemas() using two sandboxes
+
+//@<> Setup
+testutil.deploySandbox(__mysql_sandbox_port1, "root");
+testutil.deploySandbox(__mysql_sandbox_port2, "root");
+
+function setup_schema(uri) {
+  shell.connect(uri);
+  session.runSql("DROP SCHEMA IF EXISTS cmp");
+  session.runSql("CREATE SCHEMA cmp");
+  // primary key columns are declared in a different order than in the table
+  session.runSql("CREATE TABLE cmp.composite (a INT, b VARCHAR(10), c INT, PRIMARY KEY (b, a))");
+  session.runSql("INSERT INTO cmp.composite VALUES (1, 'z', 1), (2, 'y', 2), (3, 'x', 3), (5, 'v', 5)");
+  // big enough to be split into several chunks
+  session.runSql("CREATE TABLE cmp.big (a INT, b VARCHAR(10), c VARCHAR(100), PRIMARY KEY (b, a))");
+  session.runSql("SET SESSION cte_max_recursion_depth = 10000");
+  session.runSql("INSERT INTO cmp.big WITH RECURSIVE seq(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < 5000) SELECT n, LPAD(5000 - n, 5, '0'), REPEAT('x', 100) FROM seq");
+  session.runSql("CREATE TABLE cmp.noindex (a INT, b TEXT)");
+  session.runSql("INSERT INTO cmp.noindex VALUES (1, 'one'), (2, 'two')");
+  session.close();
+}
+
+setup_schema(__sandbox_uri1);
+setup_schema(__sandbox_uri2);
+
+shell.connect(__sandbox_uri1);
+
+//@<> identical tables
+EXPECT_NO_THROWS(function() { util.compareSchemas(["cmp"], __sandbox_uri2); });
+EXPECT_OUTPUT_CONTAINS("5006 identical rows found, 0 out of 3 tables are different.");
+
+//@<> missing, extra and changed rows with a composite key
+session2 = mysql.getSession(__sandbox_uri2);
+session2.runSql("DELETE FROM cmp.composite WHERE a = 2");
+session2.runSql("UPDATE cmp.composite SET c = 30 WHERE a = 3");
+session2.runSql("INSERT INTO cmp.composite VALUES (4, 'w', 4)");
+
+WIPE_OUTPUT();
+EXPECT_THROWS(function() { util.compareTables("cmp", ["composite"], __sandbox_uri2); }, "Compared tables are different");
+EXPECT_OUTPUT_CONTAINS("`cmp`.`composite`: row (y, 2) does not exist on target");
+EXPECT_OUTPUT_CONTAINS("`cmp`.`composite`: row (x, 3) differs");
+EXPECT_OUTPUT_CONTAINS("`cmp`.`composite`: row (w, 4) exists only on target");
+EXPECT_OUTPUT_NOT_CONTAINS("row (z, 1)");
+EXPECT_OUTPUT_NOT_CONTAINS("row (v, 5)");
+EXPECT_OUTPUT_CONTAINS("2 identical rows found, 1 out of 1 tables are different.");
+
+//@<> differences in a table split into chunks
+session2.runSql("DELETE FROM cmp.big WHERE a = 10");
+session2.runSql("UPDATE cmp.big SET c = 'changed' WHERE a = 2500");
+session2.runSql("INSERT INTO cmp.big VALUES (5001, '99999', 'extra')");
+
+WIPE_OUTPUT();
+EXPECT_THROWS(function() { util.compareTables("cmp", ["big"], __sandbox_uri2, { bytesPerChunk: "128k" }); }, "Compared tables are different");
+EXPECT_OUTPUT_CONTAINS("`cmp`.`big`: row (04990, 10) does not exist on target");
+EXPECT_OUTPUT_CONTAINS("`cmp`.`big`: row (02500, 2500) differs");
+EXPECT_OUTPUT_CONTAINS("`cmp`.`big`: row (99999, 5001) exists only on target");
+EXPECT_OUTPUT_CONTAINS("4998 identical rows found, 1 out of 1 tables are different.");
+
+//@<> table without an index
+session2.runSql("UPDATE cmp.noindex SET b = 'three' WHERE a = 2");
+
+WIPE_OUTPUT();
+EXPECT_THROWS(function() { util.compareTables("cmp", ["noindex"], __sandbox_uri2); }, "Compared tables are different");
+EXPECT_OUTPUT_CONTAINS("`cmp`.`noindex`: checksum differs, table has no primary key or unique index, differing rows cannot be identified");
+EXPECT_OUTPUT_CONTAINS("0 identical rows found, 1 out of 1 tables are different.");
+
+//@<> all tables are reported by compareSchemas()
+WIPE_OUTPUT();
+EXPECT_THROWS(function() { util.compareSchemas(["cmp"], __sandbox_uri2); }, "Compared tables are different");
+EXPECT_OUTPUT_CONTAINS("3 out of 3 tables are different.");
+
+//@<> rows with NULL values in a unique key are compared as a whole
+for (const s of [session, session2]) {
+  s.runSql("CREATE SCHEMA cmp2");
+  s.runSql("CREATE TABLE cmp2.nullkey (u INT, data VARCHAR(10), UNIQUE KEY (u))");
+}
+
+// the same rows, inserted in a different order
+session.runSql("INSERT INTO cmp2.nullkey VALUES (1, 'a'), (NULL, 'x'), (NULL, 'y'), (NULL, 'z')");
+session2.runSql("INSERT INTO cmp2.nullkey VALUES (NULL, 'z'), (NULL, 'y'), (1, 'a'), (NULL, 'x')");
+
+WIPE_OUTPUT();
+EXPECT_NO_THROWS(function() { util.compareTables("cmp2", ["nullkey"], __sandbox_uri2); });
+EXPECT_OUTPUT_CONTAINS("4 identical rows found, 0 out of 1 tables are different.");
+
+session2.runSql("UPDATE cmp2.nullkey SET data = 'w' WHERE data = 'y'");
+
+WIPE_OUTPUT();
+EXPECT_THROWS(function() { util.compareTables("cmp2", ["nullkey"], __sandbox_uri2); }, "Compared tables are different");
+EXPECT_OUTPUT_CONTAINS("`cmp2`.`nullkey`: row (NULL, y) does not exist on target");
+EXPECT_OUTPUT_CONTAINS("`cmp2`.`nullkey`: row (NULL, w) exists only on target");
+EXPECT_OUTPUT_NOT_CONTAINS("differs");
+EXPECT_OUTPUT_CONTAINS("3 identical rows found, 1 out of 1 tables are different.");
+
+//@<> values containing the separator used by the checksum
+for (const s of [session, session2]) {
+  s.runSql("CREATE TABLE cmp2.separator (id INT PRIMARY KEY, a VARCHAR(10), b VARCHAR(10))");
+  s.runSql("INSERT INTO cmp2.separator VALUES (1, 'a#', 'b')");
+}
+
+session2.runSql("UPDATE cmp2.separator SET a = 'a', b = '#b'");
+
+WIPE_OUTPUT();
+EXPECT_THROWS(function() { util.compareTables("cmp2", ["separator"], __sandbox_uri2); }, "Compared tables are different");
+EXPECT_OUTPUT_CONTAINS("`cmp2`.`separator`: row (1) differs");
+
+//@<> Cleanup
+session2.close();
+session.close();
+testutil.destroySandbox(__mysql_sandbox_port1);
+testutil.destroySandbox(__mysql_sandbox_port2);
@@ -10,6 +10,18 @@ util.help('checkForServerUpgrade');
 //@ util checkForServerUpgrade help, \? [USE:util checkForServerUpgrade help]
 \? checkForServerUpgrade
 
+//@ util compareSchemas help
+util.help('compareSchemas');
+
+//@ util compareSchemas help, \? [USE:util compareSchemas help]
+\? compareSchemas
+
+//@ util compareTables help
+util.help('compareTables');
+
+//@ util compareTables help, \? [USE:util compareTables help]
+\? compareTables
+
 // WL13807-TSFR_1_1
 //@ util dumpInstance help
 util.help('dumpInstance');
@@ -627,6 +627,64 @@ id	bool_not0	bool_not1	not0	not1	a_or_b	not_set	null_set
 table
 `);
 
+//@<> exportTable() and importTable() round trip using the columnar dialect
+const columnar_dir = __tmp_dir + "/columnar";
+testutil.mkdir(columnar_dir);
+
+session.runSql("CREATE TABLE t_columnar (id INT PRIMARY KEY, b BLOB, vb VARBINARY(16), bt BIT(12), g GEOMETRY, t VARCHAR(20) CHARACTER SET latin1, u TEXT CHARACTER SET utf8mb4)");
+session.runSql("INSERT INTO t_columnar VALUES (1, 0x00090A5C0D27FF4E, 0xC3A9, b'101010101010', ST_GeomFromText('POINT(1 2)'), 'caf\u00e9', 'za\u017c\u00f3\u0142\u0107')");
+session.runSql("INSERT INTO t_columnar VALUES (2, '', 0x5C4E, b'0', ST_GeomFromText('LINESTRING(0 0, 1 1)'), '\\\\N', '\t\n')");
+session.runSql("INSERT INTO t_columnar VALUES (3, NULL, NULL, NULL, NULL, NULL, NULL)");
+session.runSql("INSERT INTO t_columnar VALUES (4, REPEAT(0xFE, 1000), 0x00, b'111111111111', ST_GeomFromText('POLYGON((0 0, 1 0, 1 1, 0 0))'), '', '')");
+session.runSql("CREATE TABLE t_columnar_copy LIKE t_columnar");
+
+util.exportTable(target_schema + ".t_columnar", columnar_dir + "/t_columnar.mshc", { dialect: "columnar" });
+EXPECT_NO_THROWS(function () { util.importTable(columnar_dir + "/t_columnar.mshc", { schema: target_schema, table: "t_columnar_copy", dialect: "columnar" }); });
+
+const columnar_query = "SELECT id, HEX(b), HEX(vb), HEX(bt), ST_AsText(g), HEX(t), HEX(u) FROM ! ORDER BY id";
+EXPECT_EQ(session.runSql(columnar_query, ["t_columnar"]).fetchAll(), session.runSql(columnar_query, ["t_columnar_copy"]).fetchAll());
+EXPECT_EQ(4, session.runSql("SELECT COUNT(*) FROM t_columnar_copy").fetchOne()[0]);
+
+//@<> importTable() with the columnar dialect and a subset of columns
+session.runSql("TRUNCATE TABLE t_columnar_copy");
+EXPECT_NO_THROWS(function () { util.importTable(columnar_dir + "/t_columnar.mshc", { schema: target_schema, table: "t_columnar_copy", dialect: "columnar", columns: ["id", "b", 1, 2, 3, 4, 5] }); });
+EXPECT_EQ(session.runSql("SELECT id, HEX(b) FROM t_columnar ORDER BY id").fetchAll(), session.runSql("SELECT id, HEX(b) FROM t_columnar_copy ORDER BY id").fetchAll());
+EXPECT_EQ(0, session.runSql("SELECT COUNT(*) FROM t_columnar_copy WHERE vb IS NOT NULL OR u IS NOT NULL").fetchOne()[0]);
+
+//@<> importTable() with the columnar dialect loads values into the columns stored in the file
+session.runSql("CREATE TABLE t_columnar_reordered (u TEXT CHARACTER SET utf8mb4, t VARCHAR(20) CHARACTER SET latin1, g GEOMETRY, bt BIT(12), vb VARBINARY(16), b BLOB, id INT PRIMARY KEY, extra INT DEFAULT 7)");
+EXPECT_NO_THROWS(function () { util.importTable(columnar_dir + "/t_columnar.mshc", { schema: target_schema, table: "t_columnar_reordered", dialect: "columnar" }); });
+EXPECT_EQ(session.runSql(columnar_query, ["t_columnar"]).fetchAll(), session.runSql(columnar_query, ["t_columnar_reordered"]).fetchAll());
+EXPECT_EQ(4, session.runSql("SELECT COUNT(*) FROM t_columnar_reordered WHERE extra = 7").fetchOne()[0]);
+
+//@<> importTable() with the columnar dialect fails if the target does not have a column stored in the file
+session.runSql("CREATE TABLE t_columnar_missing (id INT PRIMARY KEY, b BLOB, vb VARBINARY(16), bt BIT(12), g GEOMETRY, t VARCHAR(20) CHARACTER SET latin1)");
+EXPECT_THROWS(function () { util.importTable(columnar_dir + "/t_columnar.mshc", { schema: target_schema, table: "t_columnar_missing", dialect: "columnar" }); }, `t_columnar.mshc' does not exist in the target table \`${target_schema}\`.\`t_columnar_missing\`.`);
+EXPECT_EQ(0, session.runSql("SELECT COUNT(*) FROM t_columnar_missing").fetchOne()[0]);
+
+//@<> importTable() with the columnar dialect fails if the type of a column does not match
+session.runSql("CREATE TABLE t_columnar_text (id INT PRIMARY KEY, b TEXT, vb VARBINARY(16), bt BIT(12), g GEOMETRY, t VARCHAR(20) CHARACTER SET latin1, u TEXT CHARACTER SET utf8mb4)");
+EXPECT_THROWS(function () { util.importTable(columnar_dir + "/t_columnar.mshc", { schema: target_schema, table: "t_columnar_text", dialect: "columnar" }); }, `t_columnar.mshc' holds binary data, but it has a non-binary type in the target table \`${target_schema}\`.\`t_columnar_text\`.`);
+
+session.runSql("CREATE TABLE t_columnar_blob (id INT PRIMARY KEY, b BLOB, vb VARBINARY(16), bt BIT(12), g GEOMETRY, t VARCHAR(20) CHARACTER SET latin1, u BLOB)");
+EXPECT_THROWS(function () { util.importTable(columnar_dir + "/t_columnar.mshc", { schema: target_schema, table: "t_columnar_blob", dialect: "columnar" }); }, `t_columnar.mshc' holds text, but it has a binary type in the target table \`${target_schema}\`.\`t_columnar_blob\`.`);
+
+//@<> importTable() with the columnar dialect fails if files hold different columns
+session.runSql("TRUNCATE TABLE t_columnar_copy");
+session.runSql("CREATE TABLE t_columnar_subset (id INT PRIMARY KEY, b BLOB)");
+session.runSql("INSERT INTO t_columnar_subset VALUES (5, 0x01)");
+util.exportTable(target_schema + ".t_columnar_subset", columnar_dir + "/t_columnar_subset.mshc", { dialect: "columnar" });
+EXPECT_THROWS(function () { util.importTable(columnar_dir + "/t_columnar*.mshc", { schema: target_schema, table: "t_columnar_copy", dialect: "columnar" }); }, `t_columnar_subset.mshc' (id, b) do not match the columns being loaded (id, b, vb, bt, g, t, u).`);
+
+session.runSql("DROP TABLE t_columnar");
+session.runSql("DROP TABLE t_columnar_copy");
+session.runSql("DROP TABLE t_columnar_reordered");
+session.runSql("DROP TABLE t_columnar_missing");
+session.runSql("DROP TABLE t_columnar_text");
+session.runSql("DROP TABLE t_columnar_blob");
+session.runSql("DROP TABLE t_columnar_subset");
+testutil.rmdir(columnar_dir, true);
+
 //@<> Teardown
 session.runSql("DROP SCHEMA IF EXISTS " + target_schema);
 session.close();
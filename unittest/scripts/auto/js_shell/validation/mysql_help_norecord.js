@@ -39,6 +39,10 @@ CLASSES
                   Protocol.
  - ClassicSession Enables interaction with a MySQL Server using the MySQL
                   Protocol.
+ - Future         Handle to the result of a query executed asynchronously by a
+                  SessionPool.
+ - SessionPool    Executes queries asynchronously using a pool of MySQL
+                  Protocol sessions.
 
 //@<OUT> getClassicSession help
 NAME
@@ -27,6 +27,9 @@ FUNCTIONS
             Creates an extension object, it can be used to extend shell
             functionality.
 
+      createSessionPool(connectionData, size)
+            Creates a pool of sessions which execute queries asynchronously.
+
       deleteAllCredentials()
             Deletes all credentials managed by the configured helper.
 
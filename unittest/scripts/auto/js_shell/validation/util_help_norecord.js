@@ -12,6 +12,14 @@ FUNCTIONS
             Performs series of tests on specified MySQL server to check if the
             upgrade process will succeed.
 
+      compareSchemas(schemas, connectionData[, options])
+            Compares all tables from the specified schemas with the tables on
+            another server.
+
+      compareTables(schema, tables, connectionData[, options])
+            Compares the specified tables from the given schema with the tables
+            on another server.
+
       configureOci([profile])
             Wizard to create a valid configuration for the OCI SDK.
 
@@ -66,6 +74,8 @@ DESCRIPTION
       - targetVersion - version to which upgrade will be checked
         (default=<<<__mysh_version>>>)
       - password - password for connection.
+      - threads - number of sessions used to execute the checks, 'check table x
+        for upgrade' is run concurrently for multiple tables (default=1).
 
       The connection data may be specified in the following formats:
 
@@ -143,6 +153,117 @@ DESCRIPTION
 
       For additional information on connection data use \? connection.
 
+//@<OUT> util compareSchemas help
+NAME
+      compareSchemas - Compares all tables from the specified schemas with the
+                       tables on another server.
+
+SYNTAX
+      util.compareSchemas(schemas, connectionData[, options])
+
+WHERE
+      schemas: List of schemas to be compared.
+      connectionData: Connection data of the target server.
+      options: Dictionary with the comparison options.
+
+DESCRIPTION
+      The schemas parameter cannot be an empty list.
+
+      The connectionData parameter specifies the target server, the tables on
+      the server the global session is connected to are compared with the
+      tables on the target server.
+
+      For additional information on connection data use \? connection.
+
+      The following options are supported:
+
+      - threads: int (default: 4) - Use N threads to compare the data.
+      - bytesPerChunk: string (default: "16M") - Approximate number of bytes of
+        a table compared using a single checksum query. Allowed unit suffixes -
+        k (kilobytes), M (Megabytes), G (Gigabytes). Minimum value: 128k.
+
+      Details
+
+      Each table is split into chunks using its primary key or, if it does not
+      have one, its first unique index. Checksums of the chunks are computed by
+      both servers and compared, only chunks with different checksums are split
+      further, until the different rows are found and reported. Tables without
+      a primary key and without a unique index are compared using a single
+      checksum.
+
+      Tables which are missing on the target server, or which have different
+      columns on the target server, are reported as different.
+
+      The compared tables should not be modified while this operation is
+      running, otherwise the reported differences may be inaccurate.
+
+EXCEPTIONS
+      ArgumentError in the following scenarios:
+
+      - If any of the input arguments contains an invalid value.
+
+      RuntimeError in the following scenarios:
+
+      - If there is no open global session.
+      - If connection to the target server cannot be established.
+      - If the compared tables are different.
+
+//@<OUT> util compareTables help
+NAME
+      compareTables - Compares the specified tables from the given schema with
+                      the tables on another server.
+
+SYNTAX
+      util.compareTables(schema, tables, connectionData[, options])
+
+WHERE
+      schema: Name of the schema that contains tables to be compared.
+      tables: List of tables to be compared.
+      connectionData: Connection data of the target server.
+      options: Dictionary with the comparison options.
+
+DESCRIPTION
+      The tables parameter cannot be an empty list.
+
+      The connectionData parameter specifies the target server, the tables on
+      the server the global session is connected to are compared with the
+      tables on the target server.
+
+      For additional information on connection data use \? connection.
+
+      The following options are supported:
+
+      - threads: int (default: 4) - Use N threads to compare the data.
+      - bytesPerChunk: string (default: "16M") - Approximate number of bytes of
+        a table compared using a single checksum query. Allowed unit suffixes -
+        k (kilobytes), M (Megabytes), G (Gigabytes). Minimum value: 128k.
+
+      Details
+
+      Each table is split into chunks using its primary key or, if it does not
+      have one, its first unique index. Checksums of the chunks are computed by
+      both servers and compared, only chunks with different checksums are split
+      further, until the different rows are found and reported. Tables without
+      a primary key and without a unique index are compared using a single
+      checksum.
+
+      Tables which are missing on the target server, or which have different
+      columns on the target server, are reported as different.
+
+      The compared tables should not be modified while this operation is
+      running, otherwise the reported differences may be inaccurate.
+
+EXCEPTIONS
+      ArgumentError in the following scenarios:
+
+      - If any of the input arguments contains an invalid value.
+
+      RuntimeError in the following scenarios:
+
+      - If there is no open global session.
+      - If connection to the target server cannot be established.
+      - If the compared tables are different.
+
 //@<OUT> util dumpInstance help
 NAME
       dumpInstance - Dumps the whole database to files in the output directory.
@@ -200,14 +321,30 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything.
+      - trackChanges: bool (default: false) - Store checksums of the dumped
+        tables, so that the dump can be used as a base of an incremental dump.
+      - baseDump: string (default: not set) - URL of a previous dump created
+        with the trackChanges or baseDump option. If set, an incremental dump
+        is created, data of tables which have not changed since the base dump
+        is not dumped. Enables trackChanges.
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - useServerSideFiles: bool (default: false) - If enabled and the server
+        runs on this host and is allowed to write to the output directory (see
+        the secure_file_priv system variable), data chunks are written directly
+        by the server using SELECT ... INTO OUTFILE, instead of being
+        transferred to the shell. Requires the FILE privilege, a local output
+        directory and compression set to "none". If the shell cannot read the
+        files written by the server, data is written by the shell.
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit data read throughput of all
+        threads to maximum rate, measured in bytes per second. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
@@ -310,7 +447,8 @@ DESCRIPTION
 
       The value of the threads option must be a positive number.
 
-      Both the bytesPerChunk and maxRate options support unit suffixes:
+      The bytesPerChunk, maxRate and maxTotalRate options support unit
+      suffixes:
 
       - k - for kilobytes,
       - M - for Megabytes,
@@ -482,14 +620,30 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything.
+      - trackChanges: bool (default: false) - Store checksums of the dumped
+        tables, so that the dump can be used as a base of an incremental dump.
+      - baseDump: string (default: not set) - URL of a previous dump created
+        with the trackChanges or baseDump option. If set, an incremental dump
+        is created, data of tables which have not changed since the base dump
+        is not dumped. Enables trackChanges.
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - useServerSideFiles: bool (default: false) - If enabled and the server
+        runs on this host and is allowed to write to the output directory (see
+        the secure_file_priv system variable), data chunks are written directly
+        by the server using SELECT ... INTO OUTFILE, instead of being
+        transferred to the shell. Requires the FILE privilege, a local output
+        directory and compression set to "none". If the shell cannot read the
+        files written by the server, data is written by the shell.
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit data read throughput of all
+        threads to maximum rate, measured in bytes per second. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
@@ -581,7 +735,8 @@ DESCRIPTION
 
       The value of the threads option must be a positive number.
 
-      Both the bytesPerChunk and maxRate options support unit suffixes:
+      The bytesPerChunk, maxRate and maxTotalRate options support unit
+      suffixes:
 
       - k - for kilobytes,
       - M - for Megabytes,
@@ -751,14 +906,30 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything.
+      - trackChanges: bool (default: false) - Store checksums of the dumped
+        tables, so that the dump can be used as a base of an incremental dump.
+      - baseDump: string (default: not set) - URL of a previous dump created
+        with the trackChanges or baseDump option. If set, an incremental dump
+        is created, data of tables which have not changed since the base dump
+        is not dumped. Enables trackChanges.
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - useServerSideFiles: bool (default: false) - If enabled and the server
+        runs on this host and is allowed to write to the output directory (see
+        the secure_file_priv system variable), data chunks are written directly
+        by the server using SELECT ... INTO OUTFILE, instead of being
+        transferred to the shell. Requires the FILE privilege, a local output
+        directory and compression set to "none". If the shell cannot read the
+        files written by the server, data is written by the shell.
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit data read throughput of all
+        threads to maximum rate, measured in bytes per second. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
@@ -846,7 +1017,8 @@ DESCRIPTION
 
       The value of the threads option must be a positive number.
 
-      Both the bytesPerChunk and maxRate options support unit suffixes:
+      The bytesPerChunk, maxRate and maxTotalRate options support unit
+      suffixes:
 
       - k - for kilobytes,
       - M - for Megabytes,
@@ -1010,17 +1182,26 @@ DESCRIPTION
         that matches specific data file format. Can be used as base dialect and
         customized with fieldsTerminatedBy, fieldsEnclosedBy,
         fieldsOptionallyEnclosed, fieldsEscapedBy and linesTerminatedBy
-        options. Must be one of the following values: default, csv, tsv or
-        csv-unix.
+        options. Must be one of the following values: default, csv, tsv,
+        csv-unix or columnar.
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxTotalRate: string (default: "0") - Limit data read throughput of all
+        threads to maximum rate, measured in bytes per second. Use
+        maxTotalRate="0" to set no limit.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable dump progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "none") - Compression used when writing
         the data dump files, one of: "none", "gzip", "zstd".
+      - threads: int (default: 1) - Use N threads to dump data chunks from the
+        server. If greater than 1, table data is split into chunks which are
+        dumped concurrently and then merged into the output file.
+      - bytesPerChunk: string (minimum: "128k", default: "64M") - Sets average
+        estimated number of bytes to be dumped in each chunk, used only if
+        threads is greater than 1.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1061,8 +1242,14 @@ DESCRIPTION
         FESC='\', FT=<TAB>, FE='"', FOE=true)
       - csv-unix: fully quoted, comma-separated, LF line endings. (LT=<LF>,
         FESC='\', FT=",", FE='"', FOE=false)
+      - columnar: binary format, rows are split into groups and values of each
+        column are stored together, using dictionary or run-length encoding
+        where it reduces the size, and compressed using zstd. Cannot be
+        customized or used together with the compression option. Values of
+        binary columns are written as they are. Such files can be loaded only
+        using the import table utility.
 
-      The maxRate option supports unit suffixes:
+      The maxRate and maxTotalRate options support unit suffixes:
 
       - k - for kilobytes,
       - M - for Megabytes,
@@ -1337,6 +1524,9 @@ DESCRIPTION
         k - for Kilobytes (n * 1'000 bytes), M - for Megabytes (n * 1'000'000
         bytes), G - for Gigabytes (n * 1'000'000'000 bytes), maxRate="2k" -
         limit to 2 kilobytes per second.
+      - maxTotalRate: string (default: "0") - Limit data send throughput of all
+        threads to maxTotalRate in bytes per second. maxTotalRate="0" - no
+        limit. Supports the same unit suffixes as maxRate.
       - showProgress: bool (default: true if stdout is a tty, false otherwise)
         - Enable or disable import progress information.
       - skipRows: int (default: 0) - Skip first n rows of the data in the file.
@@ -1346,8 +1536,8 @@ DESCRIPTION
         that matches specific data file format. Can be used as base dialect and
         customized with fieldsTerminatedBy, fieldsEnclosedBy,
         fieldsOptionallyEnclosed, fieldsEscapedBy and linesTerminatedBy
-        options. Must be one of the following values: default, csv, tsv, json
-        or csv-unix.
+        options. Must be one of the following values: default, csv, tsv, json,
+        csv-unix or columnar.
       - decodeColumns: map (default: not set) - a map between columns names and
         SQL expressions to be applied on the loaded data. Column value captured
         in 'columns' by integer is available as user variable '@i', where `i`
@@ -1357,6 +1547,12 @@ DESCRIPTION
         "binary" specifies "no conversion". If not set, the server will use the
         character set indicated by the character_set_database system variable
         to interpret the information in the file.
+      - useServerSideFiles: bool (default: false) - If enabled and the server
+        runs on this host and is allowed to read the files (see the
+        secure_file_priv system variable), uncompressed files which are loaded
+        whole are read directly by the server using LOAD DATA INFILE, instead
+        of being sent through the connection. Other files are loaded using LOAD
+        DATA LOCAL INFILE. Requires the FILE privilege.
 
       OCI Object Storage Options
 
@@ -1384,6 +1580,14 @@ DESCRIPTION
         FE=<empty>, FOE=false)
       - csv-unix: fully quoted, comma-separated, lf line endings. (LT=<LF>,
         FESC='\', FT=",", FE='"', FOE=false)
+      - columnar: binary file written by the export table utility, values are
+        stored column by column. Cannot be customized, each file is loaded
+        whole by a single thread. Unless the columns option is given, values
+        are loaded into the columns with names stored in the file, these need
+        to exist in the target table and hold the same kind of data, binary or
+        text. Values of binary columns are sent HEX-encoded and decoded with
+        UNHEX(), unless the decodeColumns option specifies a transformation for
+        them.
 
       Example input data for dialects:
 
@@ -1573,6 +1777,14 @@ DESCRIPTION
       - excludeUsers: array of strings (default not set) - Skip loading
         specified users from the dump. Strings are in format user_name
         (equivalent to 'user_name'@'%') or 'user_name'@'host'.
+      - fastIngest: bool (default: false) - Disables the InnoDB redo log and
+        increases the innodb_log_buffer_size while the dump is loaded, original
+        settings are restored once the load finishes, is interrupted or is
+        resumed. The target server must not be used by other clients. An
+        unexpected server stoppage during the load may cause data loss and
+        instance corruption. Requires MySQL 8.0.21 or newer and the PROCESS
+        privilege. Original settings are stored in the progress file, which
+        cannot be disabled.
       - ignoreExistingObjects: bool (default false) - Load the dump even if it
         contains objects that already exist in the target database.
       - ignoreVersion: bool (default false) - Load the dump even if the major
@@ -1596,6 +1808,16 @@ DESCRIPTION
       - loadUsers: bool (default: false) - Executes SQL scripts for user
         accounts, roles and grants contained in the dump. Note: statements for
         the current user will be skipped.
+      - maxThreadsPerTable: int (default: 0) - Maximum number of threads which
+        load chunks of a single table with a primary key at the same time, 0 -
+        no limit. If set, chunks of such tables are loaded in the ascending
+        order of the primary key, which reduces the number of InnoDB page
+        splits and results in smaller tables, at the cost of less parallelism
+        within a table.
+      - maxTotalRate: string (default: "0") - Limit data send throughput of all
+        threads to maximum rate, measured in bytes per second. Use
+        maxTotalRate="0" to set no limit. Unit suffixes are supported, i.e.
+        maxTotalRate="2M" - limit throughput to 2000000 bytes per second.
       - progressFile: path (default: load-progress.<server_uuid>.progress) -
         Stores load progress information in the given local file path.
       - resetProgress: bool (default: false) - Discards progress information of
@@ -1608,11 +1830,19 @@ DESCRIPTION
         - Enable or disable import progress information.
       - skipBinlog: bool (default: false) - Disables the binary log for the
         MySQL sessions used by the loader (set sql_log_bin=0).
-      - threads: int (default: 4) - Number of threads to use to import table
-        data.
+      - threads: int, "auto" (default: 4) - Number of threads to use to import
+        table data. If set to "auto", up to 32 threads are used, their number
+        is adjusted while the data is loaded, based on the load throughput and
+        the server load.
       - updateGtidSet: "off", "replace", "append" (default: off) - if set to a
         value other than 'off' updates GTID_PURGED by either replacing its
         contents or appending to it the gtid set present in the dump.
+      - useServerSideFiles: bool (default: false) - If enabled and the server
+        runs on this host and is allowed to read the files of the dump (see the
+        secure_file_priv system variable), uncompressed data chunks which are
+        loaded whole are read directly by the server using LOAD DATA INFILE,
+        instead of being sent through the connection. Other chunks are loaded
+        using LOAD DATA LOCAL INFILE. Requires the FILE privilege.
       - waitDumpTimeout: int (default: 0) - Loads a dump while it's still being
         created. Once all uploaded tables are processed the command will either
         wait for more data, the dump is marked as completed or the given
@@ -1652,6 +1882,14 @@ DESCRIPTION
       located on the same location of the "@.manifest.json" file. Finally
       specify the PAR URL on the progressFile option.
 
+      Incremental dumps, created using the baseDump option of the dump
+      functions, need to be loaded on top of their base dump. The base dump and
+      all the preceding incremental dumps must be loaded first, in the order
+      they were created. Tables which have changed since the base dump are
+      dropped and loaded again, tables which have not changed are not modified.
+      Both the loadDdl and loadData options must be enabled when loading an
+      incremental dump.
+
       Examples:
       util.loadDump("sakila_dump")
 
@@ -55,6 +55,9 @@ FUNCTIONS
       get_schemas()
             Retrieves the Schemas available on the session.
 
+      get_statement_cache_stats()
+            Returns the statistics of the statement cache of this session.
+
       get_uri()
             Retrieves the URI for the current session.
 
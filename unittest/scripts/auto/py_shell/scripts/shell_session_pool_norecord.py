@@ -0,0 +1,79 @@
+#@<> Setup
+import threading
+import time
+
+pool = shell.create_session_pool(__uripwd, 2)
+
+#@<> Invalid arguments
+EXPECT_THROWS(lambda: shell.create_session_pool(__uripwd, 0), "Shell.create_session_pool: The size of the pool must be a positive number.")
+EXPECT_THROWS(lambda: pool.run_sql(""), "SessionPool.run_sql: No query specified.")
+
+#@<> Queries are executed asynchronously
+futures = [pool.run_sql("SELECT ?, SLEEP(0.1)", [i]) for i in range(6)]
+
+results = pool.all(futures)
+EXPECT_EQ(6, len(results))
+
+for i in range(6):
+  EXPECT_EQ(i, results[i].fetch_one()[0])
+  EXPECT_TRUE(futures[i].is_done())
+
+#@<> then() is called with the result
+future = pool.run_sql("SELECT 2").then(lambda r: r.fetch_one()[0] * 2)
+EXPECT_EQ(4, future.wait())
+
+#@<> GIL is released while waiting for the result
+ticks = []
+stop = threading.Event()
+
+def tick():
+  while not stop.is_set():
+    ticks.append(time.time())
+    time.sleep(0.05)
+
+ticker = threading.Thread(target=tick)
+future = pool.run_sql("SELECT SLEEP(1)")
+ticker.start()
+
+start = time.time()
+EXPECT_EQ(0, future.wait().fetch_one()[0])
+end = time.time()
+
+stop.set()
+ticker.join()
+
+# other Python threads were running while the script was blocked in wait()
+EXPECT_LE(5, len([t for t in ticks if start <= t <= end]))
+
+#@<> GIL is released while waiting for all the results
+del ticks[:]
+stop.clear()
+
+ticker = threading.Thread(target=tick)
+futures = [pool.run_sql("SELECT SLEEP(0.5)") for i in range(4)]
+ticker.start()
+
+start = time.time()
+EXPECT_EQ(4, len(pool.all(futures)))
+end = time.time()
+
+stop.set()
+ticker.join()
+
+EXPECT_LE(5, len([t for t in ticks if start <= t <= end]))
+
+#@<> Errors are thrown by wait()
+future = pool.run_sql("SELECT * FROM mysql.no_such_table")
+EXPECT_THROWS(lambda: future.wait(), "Table 'mysql.no_such_table' doesn't exist")
+
+#@<> Warnings are available
+result = pool.run_sql("SELECT 1/0").wait()
+EXPECT_EQ(1, result.warnings_count)
+EXPECT_EQ(1365, result.get_warnings()[0][1])
+
+#@<> Closed pool
+future = pool.run_sql("SELECT SLEEP(0.5)")
+pool.close()
+EXPECT_TRUE(future.is_done())
+EXPECT_EQ(0, future.wait().fetch_one()[0])
+EXPECT_THROWS(lambda: pool.run_sql("SELECT 1"), "SessionPool.run_sql: The session pool is closed.")
@@ -1,4 +1,5 @@
 # imports
+import gzip
 import hashlib
 import json
 import os
@@ -622,6 +623,30 @@ EXPECT_FAIL("MySQL Error (1115)", "Unknown character set: 'dummy'", quote(types_
 EXPECT_SUCCESS(quote(world_x_schema, world_x_table), test_output_absolute, { "showProgress": False })
 EXPECT_EQ(expected_hash, hash_file(test_output_absolute))
 
+#@<> The `options` dictionary may contain a `threads` key with an unsigned integer value, which specifies the number of threads to be used to perform the export.
+TEST_UINT_OPTION("threads")
+EXPECT_FAIL("ValueError", "The value of 'threads' option must be greater than 0.", quote(types_schema, types_schema_tables[0]), test_output_relative, { "threads": 0 })
+
+#@<> The `options` dictionary may contain a `bytesPerChunk` key with a string value, which specifies the size of chunks dumped by each thread.
+TEST_STRING_OPTION("bytesPerChunk")
+EXPECT_FAIL("ValueError", "The option 'bytesPerChunk' cannot be set to an empty string.", quote(types_schema, types_schema_tables[0]), test_output_relative, { "bytesPerChunk": "" })
+EXPECT_FAIL("ValueError", 'Wrong input number "xyz"', quote(types_schema, types_schema_tables[0]), test_output_relative, { "bytesPerChunk": "xyz" })
+EXPECT_FAIL("ValueError", "The value of 'bytesPerChunk' option must be greater or equal to 128k.", quote(types_schema, types_schema_tables[0]), test_output_relative, { "bytesPerChunk": "127k" })
+
+#@<> If the `threads` option is greater than 1, the output file must be the same as in case of a single thread
+EXPECT_SUCCESS(quote(world_x_schema, world_x_table), test_output_absolute, { "threads": 4, "bytesPerChunk": "128k", "showProgress": False })
+EXPECT_STDOUT_CONTAINS("Running data dump using 4 threads.")
+EXPECT_EQ(expected_hash, hash_file(test_output_absolute))
+# temporary chunk files are removed
+EXPECT_EQ(["data.txt"], os.listdir(test_output_absolute_parent))
+
+#@<> If the `threads` option is greater than 1, compressed output is a valid compressed file
+EXPECT_SUCCESS(quote(world_x_schema, world_x_table), test_output_absolute, { "threads": 4, "bytesPerChunk": "128k", "compression": "gzip", "showProgress": False })
+EXPECT_EQ(GZIP_MAGIC_NUMBER, get_magic_number(test_output_absolute, 2))
+
+with gzip.open(test_output_absolute, "rb") as f:
+    EXPECT_EQ(expected_hash, hashlib.md5(f.read()).hexdigest())
+
 # WL13804-FR5.9 - The options which specify the output format of the data dump file, along with their default values, the same as in the `util.importTable()` function (specified in WL#12193), must be supported:
 # * `fieldsTerminatedBy`,
 # * `fieldsEnclosedBy`,
@@ -689,8 +714,6 @@ EXPECT_FAIL("ValueError", "Invalid options: ddlOnly", quote(types_schema, types_
 EXPECT_FAIL("ValueError", "Invalid options: dataOnly", quote(types_schema, types_schema_tables[0]), test_output_relative, { "dataOnly": "dummy" })
 EXPECT_FAIL("ValueError", "Invalid options: dryRun", quote(types_schema, types_schema_tables[0]), test_output_relative, { "dryRun": "dummy" })
 EXPECT_FAIL("ValueError", "Invalid options: chunking", quote(types_schema, types_schema_tables[0]), test_output_relative, { "chunking": "dummy" })
-EXPECT_FAIL("ValueError", "Invalid options: bytesPerChunk", quote(types_schema, types_schema_tables[0]), test_output_relative, { "bytesPerChunk": "dummy" })
-EXPECT_FAIL("ValueError", "Invalid options: threads", quote(types_schema, types_schema_tables[0]), test_output_relative, { "threads": "dummy" })
 EXPECT_FAIL("ValueError", "Invalid options: excludeTables", quote(types_schema, types_schema_tables[0]), test_output_relative, { "excludeTables": "dummy" })
 EXPECT_FAIL("ValueError", "Invalid options: excludeSchemas", quote(types_schema, types_schema_tables[0]), test_output_relative, { "excludeSchemas": "dummy" })
 EXPECT_FAIL("ValueError", "Invalid options: ociParManifest", quote(types_schema, types_schema_tables[0]), test_output_relative, { "ociParManifest": "dummy" })
@@ -10,6 +10,18 @@ util.help('check_for_server_upgrade')
 #@ util check_for_server_upgrade help, \? [USE:util check_for_server_upgrade help]
 \? check_for_server_upgrade
 
+#@ util compare_schemas help
+util.help('compare_schemas')
+
+#@ util compare_schemas help, \? [USE:util compare_schemas help]
+\? compare_schemas
+
+#@ util compare_tables help
+util.help('compare_tables')
+
+#@ util compare_tables help, \? [USE:util compare_tables help]
+\? compare_tables
+
 # WL13807-TSFR_1_1
 #@ util dump_instance help
 util.help('dump_instance');
@@ -27,6 +27,9 @@ FUNCTIONS
             Creates an extension object, it can be used to extend shell
             functionality.
 
+      create_session_pool(connectionData, size)
+            Creates a pool of sessions which execute queries asynchronously.
+
       delete_all_credentials()
             Deletes all credentials managed by the configured helper.
 
@@ -14,6 +14,7 @@ validateMembers(mySession, [
     'getDefaultSchema',
     'getSchema',
     'getSchemas',
+    'getStatementCacheStats',
     'getUri',
     'help',
     'isOpen',
@@ -262,5 +263,30 @@ mysqlx.getSession(42)
 mysqlx.getSession(["bla"])
 mysqlx.getSession(null)
 
+//@<> Session: statement cache stats
+mySession.sql('drop schema if exists stmt_cache').execute();
+var coll = mySession.createSchema('stmt_cache').createCollection('coll');
+var before = mySession.getStatementCacheStats();
+
+for (var i = 0; i < 3; ++i) {
+  coll.find('name = :name').bind('name', 'foo').execute();
+}
+
+// expression is normalized, whitespace does not matter
+coll.find('name=:name').bind('name', 'bar').execute();
+
+var after = mySession.getStatementCacheStats();
+
+function cache_delta(cache, counter) {
+  return after[cache][counter] - before[cache][counter];
+}
+
+EXPECT_EQ(3, cache_delta('expressions', 'hits'));
+EXPECT_EQ(1, cache_delta('expressions', 'misses'));
+EXPECT_EQ(2, cache_delta('preparedStatements', 'hits'));
+EXPECT_EQ(2, cache_delta('preparedStatements', 'misses'));
+EXPECT_EQ(1, cache_delta('preparedStatements', 'size'));
+mySession.dropSchema('stmt_cache');
+
 // Cleanup
 mySession.close();
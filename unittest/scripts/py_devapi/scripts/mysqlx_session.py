@@ -15,6 +15,7 @@ validate_members(mySession, [
   'get_default_schema',
   'get_schema',
   'get_schemas',
+  'get_statement_cache_stats',
   'get_uri',
   'help',
   'is_open',
@@ -266,5 +267,28 @@ mysqlx.get_session(42)
 mysqlx.get_session(["bla"])
 mysqlx.get_session(None)
 
+#@<> Session: statement cache stats
+mySession.sql('drop schema if exists stmt_cache').execute()
+coll = mySession.create_schema('stmt_cache').create_collection('coll')
+before = mySession.get_statement_cache_stats()
+
+for i in range(3):
+  coll.find('name = :name').bind('name', 'foo').execute()
+
+# expression is normalized, whitespace does not matter
+coll.find('name=:name').bind('name', 'bar').execute()
+
+after = mySession.get_statement_cache_stats()
+
+def cache_delta(cache, counter):
+  return after[cache][counter] - before[cache][counter]
+
+EXPECT_EQ(3, cache_delta('expressions', 'hits'))
+EXPECT_EQ(1, cache_delta('expressions', 'misses'))
+EXPECT_EQ(2, cache_delta('preparedStatements', 'hits'))
+EXPECT_EQ(2, cache_delta('preparedStatements', 'misses'))
+EXPECT_EQ(1, cache_delta('preparedStatements', 'size'))
+mySession.drop_schema('stmt_cache')
+
 # Cleanup
 mySession.close()
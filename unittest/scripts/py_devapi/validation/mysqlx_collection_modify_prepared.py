@@ -250,7 +250,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> second execution after set(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 2
+  stmt_id: 4
   stmt {
     type: UPDATE
     update {
@@ -308,7 +308,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 2
+  stmt_id: 4
 }
 
 #@<OUT> second execution after set(), prepares statement and executes it
@@ -343,7 +343,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> third execution after set(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 2
+  stmt_id: 4
 }
 
 #@<OUT> third execution after set(), uses prepared statement
@@ -378,7 +378,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> unset() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
+  stmt_id: 4
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -471,7 +471,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> second execution after unset(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 3
+  stmt_id: 6
   stmt {
     type: UPDATE
     update {
@@ -538,7 +538,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 3
+  stmt_id: 6
 }
 
 #@<OUT> second execution after unset(), prepares statement and executes it
@@ -570,7 +570,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> third execution after unset(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 3
+  stmt_id: 6
 }
 
 #@<OUT> third execution after unset(), uses prepared statement
@@ -602,7 +602,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> patch() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 3
+  stmt_id: 6
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -791,7 +791,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> second execution after patch(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 4
+  stmt_id: 8
   stmt {
     type: UPDATE
     update {
@@ -930,7 +930,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 8
 }
 
 #@<OUT> second execution after patch(), prepares statement and executes it
@@ -986,7 +986,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> third execution after patch(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 8
 }
 
 #@<OUT> third execution after patch(), uses prepared statement
@@ -1042,7 +1042,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> array_insert() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 4
+  stmt_id: 8
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -1256,7 +1256,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> second execution after array_insert(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 5
+  stmt_id: 10
   stmt {
     type: UPDATE
     update {
@@ -1417,7 +1417,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 10
 }
 
 #@<OUT> second execution after array_insert(), prepares statement and executes it
@@ -1476,7 +1476,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> third execution after array_insert(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 10
 }
 
 #@<OUT> third execution after array_insert(), uses prepared statement
@@ -1535,7 +1535,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> array_append() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 5
+  stmt_id: 10
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -1770,7 +1770,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> second execution after array_append(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 6
+  stmt_id: 11
   stmt {
     type: UPDATE
     update {
@@ -1949,7 +1949,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 11
 }
 
 #@<OUT> second execution after array_append(), prepares statement and executes it
@@ -2011,7 +2011,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> third execution after array_append(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 11
 }
 
 #@<OUT> third execution after array_append(), uses prepared statement
@@ -2073,7 +2073,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> sort() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 6
+  stmt_id: 11
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -2320,7 +2320,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> second execution after sort(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 7
+  stmt_id: 12
   stmt {
     type: UPDATE
     update {
@@ -2511,7 +2511,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 7
+  stmt_id: 12
 }
 
 #@<OUT> second execution after sort(), prepares statement and executes it
@@ -2573,7 +2573,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> third execution after sort(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 7
+  stmt_id: 12
 }
 
 #@<OUT> third execution after sort(), uses prepared statement
@@ -2635,7 +2635,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> limit() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 7
+  stmt_id: 12
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -2875,7 +2875,7 @@ Rows matched: 3  Changed: 2  Warnings: 0
 
 #@<PROTOCOL> second execution after limit(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 8
+  stmt_id: 13
   stmt {
     type: UPDATE
     update {
@@ -3072,7 +3072,7 @@ Rows matched: 3  Changed: 2  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 8
+  stmt_id: 13
   args {
     type: SCALAR
     scalar {
@@ -3130,7 +3130,7 @@ Rows matched: 3  Changed: 2  Warnings: 0
 
 #@<PROTOCOL> third execution after limit(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 8
+  stmt_id: 13
   args {
     type: SCALAR
     scalar {
@@ -3263,7 +3263,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> Reusing statement with bind() using j%
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 9
+  stmt_id: 14
   stmt {
     type: UPDATE
     update {
@@ -3321,7 +3321,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 9
+  stmt_id: 14
   args {
     type: SCALAR
     scalar {
@@ -3363,7 +3363,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> Reusing statement with new limit()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 9
+  stmt_id: 14
   args {
     type: SCALAR
     scalar {
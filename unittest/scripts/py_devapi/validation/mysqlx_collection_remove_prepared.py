@@ -196,7 +196,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> second execution after sort(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 2
+  stmt_id: 3
   stmt {
     type: DELETE
     delete {
@@ -249,7 +249,7 @@ Query OK, 1 item affected ([[*]] sec)
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 2
+  stmt_id: 3
 }
 
 #@<OUT> second execution after sort(), prepares statement and executes it
@@ -269,7 +269,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> third execution after set(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 2
+  stmt_id: 3
 }
 
 #@<OUT> third execution after set(), uses prepared statement
@@ -289,7 +289,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> limit() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
+  stmt_id: 3
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -360,7 +360,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> second execution after limit(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 3
+  stmt_id: 4
   stmt {
     type: DELETE
     delete {
@@ -419,7 +419,7 @@ Query OK, 1 item affected ([[*]] sec)
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 3
+  stmt_id: 4
   args {
     type: SCALAR
     scalar {
@@ -446,7 +446,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> third execution after limit(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 3
+  stmt_id: 4
   args {
     type: SCALAR
     scalar {
@@ -526,7 +526,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> Prepares and executes statement
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 4
+  stmt_id: 5
   stmt {
     type: DELETE
     delete {
@@ -568,7 +568,7 @@ Query OK, 1 item affected ([[*]] sec)
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 5
   args {
     type: SCALAR
     scalar {
@@ -604,7 +604,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> Executes prepared statement with bind()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 5
   args {
     type: SCALAR
     scalar {
@@ -640,7 +640,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> Executes prepared statement with limit(1)
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 5
   args {
     type: SCALAR
     scalar {
@@ -676,7 +676,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> Executes prepared statement with limit(2)
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 5
   args {
     type: SCALAR
     scalar {
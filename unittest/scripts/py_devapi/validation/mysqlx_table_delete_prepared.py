@@ -105,7 +105,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> second execution after where(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 2
+  stmt_id: 3
   stmt {
     type: DELETE
     delete {
@@ -143,7 +143,7 @@ Query OK, 1 item affected ([[*]] sec)
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 2
+  stmt_id: 3
 }
 
 #@<OUT> second execution after where(), prepares statement and executes it
@@ -159,7 +159,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> third execution after where(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 2
+  stmt_id: 3
 }
 
 #@<OUT> third execution after where(), uses prepared statement
@@ -175,7 +175,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> order_by() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
+  stmt_id: 3
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -232,7 +232,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> second execution after order_by(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 3
+  stmt_id: 4
   stmt {
     type: DELETE
     delete {
@@ -279,7 +279,7 @@ Query OK, 1 item affected ([[*]] sec)
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 3
+  stmt_id: 4
 }
 
 #@<OUT> second execution after order_by(), prepares statement and executes it
@@ -295,7 +295,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> third execution after order_by(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 3
+  stmt_id: 4
 }
 
 #@<OUT> third execution after order_by(), uses prepared statement
@@ -311,7 +311,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> limit() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 3
+  stmt_id: 4
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -371,7 +371,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> second execution after limit(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 4
+  stmt_id: 5
   stmt {
     type: DELETE
     delete {
@@ -424,7 +424,7 @@ Query OK, 1 item affected ([[*]] sec)
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 5
   args {
     type: SCALAR
     scalar {
@@ -447,7 +447,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> third execution after limit(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 5
   args {
     type: SCALAR
     scalar {
@@ -509,7 +509,7 @@ Empty set ([[*]] sec)
 
 #@<PROTOCOL> prepares statement to test no changes when reusing bind(), limit() and offset()
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 5
+  stmt_id: 6
   stmt {
     type: DELETE
     delete {
@@ -548,7 +548,7 @@ Empty set ([[*]] sec)
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 6
   args {
     type: SCALAR
     scalar {
@@ -573,7 +573,7 @@ Empty set ([[*]] sec)
 
 #@<PROTOCOL> Reusing statement with bind() using g%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 6
   args {
     type: SCALAR
     scalar {
@@ -604,7 +604,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> Reusing statement with bind() using j%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 6
   args {
     type: SCALAR
     scalar {
@@ -634,7 +634,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> Reusing statement with bind() using l%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 6
   args {
     type: SCALAR
     scalar {
@@ -659,7 +659,7 @@ Empty set ([[*]] sec)
 
 #@<PROTOCOL> Reusing statement with new limit()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 6
   args {
     type: SCALAR
     scalar {
@@ -691,7 +691,7 @@ Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> Reusing statement with new limit() and offset()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 6
   args {
     type: SCALAR
     scalar {
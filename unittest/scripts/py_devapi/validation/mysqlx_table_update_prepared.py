@@ -243,7 +243,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> second execution after set(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 2
+  stmt_id: 3
   stmt {
     type: UPDATE
     update {
@@ -349,7 +349,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 2
+  stmt_id: 3
 }
 
 #@<OUT> second execution after set(), prepares statement and executes it
@@ -367,7 +367,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> third execution after set(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 2
+  stmt_id: 3
 }
 
 #@<OUT> third execution after set(), uses prepared statement
@@ -385,7 +385,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> where() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
+  stmt_id: 3
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -524,7 +524,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> second execution after where(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 3
+  stmt_id: 4
   stmt {
     type: UPDATE
     update {
@@ -651,7 +651,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 3
+  stmt_id: 4
 }
 
 #@<OUT> second execution after where(), prepares statement and executes it
@@ -669,7 +669,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> third execution after where(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 3
+  stmt_id: 4
 }
 
 #@<OUT> third execution after where(), uses prepared statement
@@ -687,7 +687,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> order_by() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 3
+  stmt_id: 4
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -835,7 +835,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> second execution after order_by(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 4
+  stmt_id: 5
   stmt {
     type: UPDATE
     update {
@@ -971,7 +971,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 5
 }
 
 #@<OUT> second execution after order_by(), prepares statement and executes it
@@ -989,7 +989,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> third execution after order_by(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 4
+  stmt_id: 5
 }
 
 #@<OUT> third execution after order_by(), uses prepared statement
@@ -1007,7 +1007,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> limit() changes statement, back to normal execution
 >>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 4
+  stmt_id: 5
 }
 
 <<<< RECEIVE Mysqlx.Ok {
@@ -1158,7 +1158,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> second execution after limit(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 5
+  stmt_id: 6
   stmt {
     type: UPDATE
     update {
@@ -1300,7 +1300,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 6
   args {
     type: SCALAR
     scalar {
@@ -1325,7 +1325,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> third execution after limit(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 5
+  stmt_id: 6
   args {
     type: SCALAR
     scalar {
@@ -1422,7 +1422,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> prepares statement to test no changes when reusing bind(), limit() and offset()
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 6
+  stmt_id: 7
   stmt {
     type: UPDATE
     update {
@@ -1486,7 +1486,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 7
   args {
     type: SCALAR
     scalar {
@@ -1520,7 +1520,7 @@ Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> Reusing statement with bind() using g%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 7
   args {
     type: SCALAR
     scalar {
@@ -1554,7 +1554,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> Reusing statement with bind() using j%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 7
   args {
     type: SCALAR
     scalar {
@@ -1588,7 +1588,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> Reusing statement with bind() using l%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 7
   args {
     type: SCALAR
     scalar {
@@ -1622,7 +1622,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> Reusing statement with new limit()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 7
   args {
     type: SCALAR
     scalar {
@@ -1656,7 +1656,7 @@ Rows matched: 1  Changed: 1  Warnings: 0
 
 #@<PROTOCOL> Reusing statement with new limit() and offset()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 7
   args {
     type: SCALAR
     scalar {
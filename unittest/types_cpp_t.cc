@@ -202,6 +202,41 @@ class Test_object : public Cpp_object_bridge {
   FRIEND_TEST(Types_cpp, arg_check_overload_ambiguous);
 };
 
+class Shared_test_object : public Cpp_object_bridge {
+ public:
+  explicit Shared_test_object(int value)
+      : Cpp_object_bridge(method_table()), m_value(value) {
+    add_property("value");
+  }
+
+  std::string class_name() const override { return "Shared_test_object"; }
+
+  Value get_member(const std::string &prop) const override {
+    if (prop == "value") return Value(m_value);
+    return Cpp_object_bridge::get_member(prop);
+  }
+
+  void do_expose() { expose("local", &Shared_test_object::get_value); }
+
+  int get_value() const { return m_value; }
+
+  int add(int i, int j) { return m_value + i + j; }
+
+ private:
+  static const std::shared_ptr<Function_map> &method_table() {
+    static const auto table = []() {
+      auto t = make_method_table();
+      add_property_getter(t.get(), "value", "getValue");
+      expose(t.get(), "add", &Shared_test_object::add, "i", "?j");
+      return t;
+    }();
+
+    return table;
+  }
+
+  int m_value;
+};
+
 class Types_cpp : public ::testing::Test {
   virtual void SetUp() {}
 
@@ -452,4 +487,37 @@ TEST_F(Types_cpp, arg_check_overload_ambiguous) {
   EXPECT_EQ(obj.f_overload(11), obj.call("overload", make_args(11)).as_int());
   EXPECT_EQ(obj.f_overload(0), obj.call("overload", make_args()).as_int());
 }
+
+TEST_F(Types_cpp, shared_method_table) {
+  Shared_test_object a(1);
+  Shared_test_object b(2);
+
+  // value, help(), getValue(), add()
+  EXPECT_EQ(4, a.get_members().size());
+  EXPECT_EQ(4, b.get_members().size());
+
+  EXPECT_TRUE(a.has_method("help"));
+  EXPECT_EQ(1, a.call("getValue", make_args()).as_int());
+  EXPECT_EQ(2, b.call("getValue", make_args()).as_int());
+  EXPECT_EQ(11, a.call("add", make_args(10)).as_int());
+  EXPECT_EQ(13, b.call("add", make_args(10, 1)).as_int());
+  EXPECT_EQ(13, b.call_advanced("add", make_args(10, 1)).as_int());
+
+  // functions returned as members are bound to their objects
+  const auto fa = a.get_member("getValue").as_function();
+  const auto fb = b.get_member_advanced("add").as_function();
+  EXPECT_EQ(1, fa->invoke(make_args()).as_int());
+  EXPECT_EQ(12, fb->invoke(make_args(10)).as_int());
+  EXPECT_THROW(fb->invoke(make_args("x")), shcore::Exception);
+
+  // exposing a method in one object does not affect the others
+  a.do_expose();
+  EXPECT_EQ(5, a.get_members().size());
+  EXPECT_EQ(4, b.get_members().size());
+  EXPECT_TRUE(a.has_method("local"));
+  EXPECT_FALSE(b.has_method("local"));
+  EXPECT_EQ(1, a.call("local", make_args()).as_int());
+  EXPECT_EQ(11, a.call("add", make_args(10)).as_int());
+  EXPECT_EQ(2, b.call("getValue", make_args()).as_int());
+}
 }  // namespace shcore